@@ -135,6 +135,24 @@
 /*                                            resulting in version 6.2.1  */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added memory free lists,    */
+/*                                            added object pools,         */
+/*                                            added CDC-NCM trace events, */
+/*                                            added USBX trace buffer,    */
+/*                                            added endpoint transfer     */
+/*                                            queue,                      */
+/*                                            added device address set    */
+/*                                            time for enumeration        */
+/*                                            pipeline,                   */
+/*                                            added host descriptor       */
+/*                                            cache,                      */
+/*                                            added device descriptor     */
+/*                                            index,                      */
+/*                                            added class instance table, */
+/*                                            added class match index,    */
+/*                                            added completion queue,     */
+/*                                            added timer wheel,          */
+/*                                            added transfer segments,    */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -324,6 +342,39 @@ typedef signed char               SCHAR;
 #define UX_HOST_HNP_POLLING_THREAD_STACK                    UX_THREAD_STACK_SIZE
 #endif
 
+/* Define USBX Host descriptor cache number of devices (1 ~ n).  */
+#ifndef UX_HOST_DESCRIPTOR_CACHE_ENTRIES
+#define UX_HOST_DESCRIPTOR_CACHE_ENTRIES                    4
+#endif
+
+/* Define USBX Host descriptor cache serial number string descriptor max length.  */
+#ifndef UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH
+#define UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH              64
+#endif
+
+/* Define USBX Host class instance table size (power of 2, larger than the number of instances).  */
+#ifndef UX_HOST_CLASS_INSTANCE_TABLE_SIZE
+#define UX_HOST_CLASS_INSTANCE_TABLE_SIZE                   32
+#endif
+
+/* Define USBX Host class match index number of buckets per usage (power of 2).  */
+#ifndef UX_HOST_CLASS_MATCH_INDEX_BUCKETS
+#define UX_HOST_CLASS_MATCH_INDEX_BUCKETS                   16
+#endif
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE) && (UX_MAX_CLASS_DRIVER > 32)
+#error "UX_HOST_CLASS_MATCH_INDEX_ENABLE supports up to 32 class drivers"
+#endif
+
+/* Define USBX Host timer wheel number of slots per level, as a power of 2 (shift).  */
+#ifndef UX_HOST_TIMER_WHEEL_SLOTS_SHIFT
+#define UX_HOST_TIMER_WHEEL_SLOTS_SHIFT                     6
+#endif
+
+/* Define USBX Device descriptor index number of configurations per framework.  */
+#ifndef UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS
+#define UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS           4
+#endif
+
 /* Define basic constants for the USBX Stack.  */
 #define AZURE_RTOS_USBX
 #define USBX_MAJOR_VERSION            6
@@ -436,11 +487,13 @@ VOID _ux_utility_debug_log(UCHAR *debug_location, UCHAR *debug_message, ULONG de
     
 /* Determine if tracing is enabled.  */
 
-#if defined(TX_ENABLE_EVENT_TRACE) && !defined(UX_STANDALONE)
+#if defined(TX_ENABLE_EVENT_TRACE) && !defined(UX_STANDALONE) && !defined(UX_ENABLE_TRACE_BUFFER)
 #define UX_ENABLE_EVENT_TRACE
 #endif
 
-#ifdef UX_ENABLE_EVENT_TRACE
+#if defined(UX_ENABLE_EVENT_TRACE) || defined(UX_ENABLE_TRACE_BUFFER)
+
+#if defined(UX_ENABLE_EVENT_TRACE)
 
 /* Trace is enabled. Remap calls so that interrupts can be disabled around the actual event logging.  */
 
@@ -462,6 +515,99 @@ VOID    _ux_trace_object_unregister(VOID *object_ptr);
 VOID    _ux_trace_event_insert(ULONG event_id, ULONG info_field_1, ULONG info_field_2, ULONG info_field_3, ULONG info_field_4, ULONG filter, TX_TRACE_BUFFER_ENTRY **current_event, ULONG *current_timestamp);
 VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG event_id, ULONG info_field_1, ULONG info_field_2, ULONG info_field_3, ULONG info_field_4);
 
+#else
+
+/* USBX trace buffer is enabled. Events are recorded in per-core lock-free ring buffers, independent
+   of ThreadX trace, and extracted with _ux_trace_buffer_dump.  */
+
+/* Define the number of entries in each ring buffer, must be a power of 2.  */
+#ifndef UX_TRACE_BUFFER_ENTRIES
+#define UX_TRACE_BUFFER_ENTRIES                             1024
+#endif
+
+/* Define the number of ring buffers and how the current one is selected, one per core.  */
+#ifndef UX_TRACE_BUFFER_CORES
+#define UX_TRACE_BUFFER_CORES                               1
+#endif
+#ifndef UX_TRACE_BUFFER_CORE_GET
+#define UX_TRACE_BUFFER_CORE_GET()                          0
+#endif
+
+/* Define the event groups recorded (see UX_TRACE_ALL_EVENTS and associated filters below).  */
+#ifndef UX_TRACE_BUFFER_EVENT_FILTER
+#define UX_TRACE_BUFFER_EVENT_FILTER                        UX_TRACE_ALL_EVENTS
+#endif
+
+/* Define the timestamp source and its frequency in Hz, by default the USBX tick.  */
+#ifndef UX_TRACE_BUFFER_TIMESTAMP_GET
+#define UX_TRACE_BUFFER_TIMESTAMP_GET()                     ((ULONG64) _ux_utility_time_get())
+#endif
+#ifndef UX_TRACE_BUFFER_TIMESTAMP_FREQUENCY
+#define UX_TRACE_BUFFER_TIMESTAMP_FREQUENCY                 UX_PERIODIC_RATE
+#endif
+
+/* Define the atomic operations used to access the ring buffers. Without compiler atomics the index is
+   claimed with interrupts disabled, which is sufficient on single-core targets only.  */
+#ifndef UX_TRACE_BUFFER_INDEX_CLAIM
+#if defined(__GNUC__)
+#define UX_TRACE_BUFFER_INDEX_CLAIM(p)                      __atomic_fetch_add((p), 1, __ATOMIC_RELAXED)
+#define UX_TRACE_BUFFER_LOAD_ACQUIRE(p)                     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define UX_TRACE_BUFFER_STORE_RELEASE(p,v)                  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define UX_TRACE_BUFFER_FENCE_RELEASE()                     __atomic_thread_fence(__ATOMIC_RELEASE)
+#define UX_TRACE_BUFFER_FENCE_ACQUIRE()                     __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+#define UX_TRACE_BUFFER_INDEX_CLAIM(p)                      _ux_trace_buffer_index_claim(p)
+#define UX_TRACE_BUFFER_LOAD_ACQUIRE(p)                     (*(volatile ULONG *) (p))
+#define UX_TRACE_BUFFER_STORE_RELEASE(p,v)                  (*(volatile ULONG *) (p) =  (v))
+#define UX_TRACE_BUFFER_FENCE_RELEASE()
+#define UX_TRACE_BUFFER_FENCE_ACQUIRE()
+#endif
+#endif
+
+/* Define the binary dump format, all fields little endian.  */
+
+#define UX_TRACE_BUFFER_DUMP_MAGIC                          0x42545855u /* "UXTB"  */
+#define UX_TRACE_BUFFER_DUMP_VERSION                        1
+#define UX_TRACE_BUFFER_DUMP_HEADER_LENGTH                  24
+#define UX_TRACE_BUFFER_DUMP_RECORD_LENGTH                  (20 + 4 * sizeof(ULONG))
+
+typedef struct UX_TRACE_BUFFER_ENTRY_STRUCT
+{
+
+    ULONG           ux_trace_buffer_entry_sequence;
+    ULONG           ux_trace_buffer_entry_event_id;
+    ULONG64         ux_trace_buffer_entry_timestamp;
+    ULONG           ux_trace_buffer_entry_info[4];
+} UX_TRACE_BUFFER_ENTRY;
+
+typedef struct UX_TRACE_BUFFER_STRUCT
+{
+
+    ULONG           ux_trace_buffer_index;
+    UX_TRACE_BUFFER_ENTRY
+                    ux_trace_buffer_entries[UX_TRACE_BUFFER_ENTRIES];
+} UX_TRACE_BUFFER;
+
+extern UX_TRACE_BUFFER  _ux_trace_buffer[UX_TRACE_BUFFER_CORES];
+
+/* Map the trace macros to the trace buffer, events not in the filter are compiled out.  */
+
+#define UX_TRACE_OBJECT_REGISTER(t,p,n,a,b)
+#define UX_TRACE_OBJECT_UNREGISTER(o)
+#define UX_TRACE_IN_LINE_INSERT(i,a,b,c,d,f,g,h)            (((f) & UX_TRACE_BUFFER_EVENT_FILTER) ? _ux_trace_buffer_insert((ULONG) i, (ULONG) a, (ULONG) b, (ULONG) c, (ULONG) d) : (VOID) 0);
+#define UX_TRACE_EVENT_UPDATE(e,t,i,a,b,c,d)
+
+
+/* Define USBX trace buffer prototypes.  */
+
+VOID    _ux_trace_buffer_insert(ULONG event_id, ULONG info_field_1, ULONG info_field_2, ULONG info_field_3, ULONG info_field_4);
+UINT    _ux_trace_buffer_dump(UCHAR *buffer, ULONG buffer_length, ULONG *actual_length);
+ULONG   _ux_trace_buffer_index_claim(ULONG *index);
+
+#define ux_trace_buffer_dump                                _ux_trace_buffer_dump
+
+#endif
+
 
 /* Define USBX event trace constants.  */
 
@@ -714,6 +860,7 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_TRACE_DEVICE_STACK_TRANSFER_REQUEST                          (UX_TRACE_DEVICE_STACK_EVENTS_BASE + 20)            /* I1 = transfer request                                                                            */
 #define UX_TRACE_DEVICE_STACK_MICROSOFT_EXTENSION_REGISTER              (UX_TRACE_DEVICE_STACK_EVENTS_BASE + 21)            /* I1 = transfer request                                                                            */
 #define UX_TRACE_DEVICE_STACK_CLASS_UNREGISTER                          (UX_TRACE_DEVICE_STACK_EVENTS_BASE + 22)            /* I1 = class name                                                                                  */
+#define UX_TRACE_DEVICE_STACK_TRANSFER_QUEUE                            (UX_TRACE_DEVICE_STACK_EVENTS_BASE + 23)            /* I1 = transfer request                                                                            */
                                                                                                                                                                                                                               
 /* Define the USBX device stack events first.  */                                                                                                                                                                             
 
@@ -840,6 +987,14 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_TRACE_DEVICE_CLASS_CCID_TIME_EXTENSION                       (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 132)           /* I1 = class instance  , I2 = slot            , I3 = time                                          */
 #define UX_TRACE_DEVICE_CLASS_CCID_HARDWARE_ERROR                       (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 133)           /* I1 = class instance  , I2 = slot                                                                 */
 
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_ACTIVATE                          (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 140)           /* I1 = class instance                                                                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_DEACTIVATE                        (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 141)           /* I1 = class instance                                                                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_CHANGE                            (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 142)           /* I1 = class instance                                                                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_READ                              (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 143)           /* I1 = class instance  , I2 = buffer          , I3 = requested_length                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_WRITE                             (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 144)           /* I1 = class instance  , I2 = buffer          , I3 = requested_length                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_PACKET_TRANSMIT                   (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 145)           /* I1 = class instance  , I2 = buffer          , I3 = requested_length                              */
+#define UX_TRACE_DEVICE_CLASS_CDC_NCM_PACKET_RECEIVE                    (UX_TRACE_DEVICE_CLASS_EVENTS_BASE + 146)           /* I1 = class instance  , I2 = buffer          , I3 = requested_length                              */
+
 
 /* Define the USBX Error Event.  */
 
@@ -1138,6 +1293,7 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_MEMORY_USED                                                  0x80000000u
 #define UX_REGULAR_MEMORY                                               0
 #define UX_CACHE_SAFE_MEMORY                                            1
+#define UX_MEMORY_SIZE_CLASSES                                          32
 
 #define UX_NO_ALIGN                                                     0u
 #define UX_ALIGN_16                                                     0x0fu
@@ -1579,6 +1735,7 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_DCD_CHANGE_STATE                                             19
 #define UX_DCD_STALL_ENDPOINT                                           20
 #define UX_DCD_ENDPOINT_STATUS                                          21
+#define UX_DCD_TRANSFER_QUEUE                                           22
                                                                         
                                                                         
 /* Define USBX generic host controller constants.  */                   
@@ -1587,6 +1744,11 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_HCD_STATUS_HALTED                                            1
 #define UX_HCD_STATUS_OPERATIONAL                                       2
 #define UX_HCD_STATUS_DEAD                                              3
+
+/* Define USBX HCD capabilities.  */
+
+#define UX_HCD_CAPABILITY_TRANSFER_SEGMENTS                             1u
+#define UX_HCD_CAPABILITY_CONCURRENT_TRANSFERS                          2u
                                                                         
 /* Define USBX generic SLAVE controller constants.  */                  
                                                                         
@@ -1607,6 +1769,7 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_HOST_CLASS_COMMAND_DESTROY                                   4
 #define UX_HOST_CLASS_COMMAND_ACTIVATE_START                            UX_HOST_CLASS_COMMAND_ACTIVATE
 #define UX_HOST_CLASS_COMMAND_ACTIVATE_WAIT                             5
+#define UX_HOST_CLASS_COMMAND_MATCH_GET                                 6
                                                                         
 #define UX_SLAVE_CLASS_COMMAND_QUERY                                    1
 #define UX_SLAVE_CLASS_COMMAND_ACTIVATE                                 2
@@ -1620,6 +1783,12 @@ VOID    _ux_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, UL
 #define UX_HOST_CLASS_COMMAND_USAGE_CSP                                 2
 #define UX_HOST_CLASS_COMMAND_USAGE_DCSP                                3
                                                                         
+#define UX_HOST_CLASS_MATCH_VID                                         0x01
+#define UX_HOST_CLASS_MATCH_PID                                         0x02
+#define UX_HOST_CLASS_MATCH_CLASS                                       0x04
+#define UX_HOST_CLASS_MATCH_SUBCLASS                                    0x08
+#define UX_HOST_CLASS_MATCH_PROTOCOL                                    0x10
+                                                                        
 #define UX_HOST_CLASS_INSTANCE_FREE                                     0
 #define UX_HOST_CLASS_INSTANCE_LIVE                                     1
 #define UX_HOST_CLASS_INSTANCE_SHUTDOWN                                 2
@@ -1712,6 +1881,30 @@ typedef struct UX_HUB_TT_STRUCT
 } UX_HUB_TT;
 
 
+/* Define USBX Class match structure. A class lists the values a device or an interface
+   must have for the class QUERY to accept it, the list ends with a zero usage.  */
+
+typedef struct UX_HOST_CLASS_MATCH_STRUCT
+{
+
+    UCHAR           ux_host_class_match_usage;
+    UCHAR           ux_host_class_match_flags;
+    UCHAR           ux_host_class_match_class;
+    UCHAR           ux_host_class_match_subclass;
+    UCHAR           ux_host_class_match_protocol;
+    UCHAR           ux_host_class_match_reserved;
+    USHORT          ux_host_class_match_vid;
+    USHORT          ux_host_class_match_pid;
+} UX_HOST_CLASS_MATCH;
+
+#define UX_HOST_CLASS_MATCH_VID_PID(v, p)                   { UX_HOST_CLASS_COMMAND_USAGE_PIDVID, UX_HOST_CLASS_MATCH_VID | UX_HOST_CLASS_MATCH_PID, 0, 0, 0, 0, (v), (p) }
+#define UX_HOST_CLASS_MATCH_CSP(f, c, s, p)                 { UX_HOST_CLASS_COMMAND_USAGE_CSP, (f), (c), (s), (p), 0, 0, 0 }
+#define UX_HOST_CLASS_MATCH_DCSP(f, c, s, p)                { UX_HOST_CLASS_COMMAND_USAGE_DCSP, (f), (c), (s), (p), 0, 0, 0 }
+#define UX_HOST_CLASS_MATCH_END                             { 0, 0, 0, 0, 0, 0, 0, 0 }
+
+#define UX_HOST_CLASS_MATCH_INDEX_HASH(k)                   (((k) ^ ((k) >> 4) ^ ((k) >> 8) ^ ((k) >> 12)) & (UX_HOST_CLASS_MATCH_INDEX_BUCKETS - 1))
+
+
 /* Define USBX Class calling command structure.  */
 
 typedef struct UX_HOST_CLASS_COMMAND_STRUCT
@@ -1756,10 +1949,28 @@ typedef struct UX_HOST_CLASS_STRUCT
     VOID            *ux_host_class_client;
     VOID            *ux_host_class_media;
     VOID            *ux_host_class_ext;
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+    struct UX_OBJECT_POOL_STRUCT
+                    *ux_host_class_instance_pool;
+#endif
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    const UX_HOST_CLASS_MATCH
+                    *ux_host_class_match_list;
+#endif
 
 } UX_HOST_CLASS;
 
 
+/* Define USBX transfer request segment structure.  */
+
+typedef struct UX_TRANSFER_SEGMENT_STRUCT
+{
+
+    UCHAR           *ux_transfer_segment_data_pointer;
+    ULONG           ux_transfer_segment_length;
+} UX_TRANSFER_SEGMENT;
+
+
 /* Define USBX transfer request structure.  */
 
 typedef struct UX_TRANSFER_STRUCT
@@ -1794,8 +2005,71 @@ typedef struct UX_TRANSFER_STRUCT
     struct UX_TRANSFER_STRUCT
                     *ux_transfer_request_next_pending;
 #endif
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+    UX_TRANSFER_SEGMENT
+                    *ux_transfer_request_segments;
+    ULONG           ux_transfer_request_segment_count;
+#endif
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+    struct UX_TRANSFER_STRUCT
+                    *ux_transfer_request_timer_next;
+    struct UX_TRANSFER_STRUCT
+                    **ux_transfer_request_timer_link;
+    ULONG           ux_transfer_request_timer_deadline;
+    UINT            ux_transfer_request_timer_state;
+#endif
+#if defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+    struct UX_HOST_COMPLETION_QUEUE_STRUCT
+                    *ux_transfer_request_completion_queue;
+    VOID            (*ux_transfer_request_queue_completion_function) (struct UX_TRANSFER_STRUCT *);
+    struct UX_TRANSFER_STRUCT
+                    *ux_transfer_request_next_completed;
+    ULONG           ux_transfer_request_completion_queued;
+#endif
 } UX_TRANSFER;
 
+
+/* Define USBX Host completion queue structure.  */
+
+typedef struct UX_HOST_COMPLETION_QUEUE_STRUCT
+{
+
+    UX_TRANSFER     *ux_host_completion_queue_head;
+    UX_TRANSFER     *ux_host_completion_queue_tail;
+    ULONG           ux_host_completion_queue_bound;
+#if !defined(UX_HOST_STANDALONE)
+    UX_EVENT_FLAGS_GROUP
+                    ux_host_completion_queue_event_flags_group;
+#endif
+} UX_HOST_COMPLETION_QUEUE;
+
+#define UX_HOST_COMPLETION_QUEUE_EVENT                      1u
+
+
+/* Define USBX Host timer wheel structure.  */
+
+#define UX_HOST_TIMER_WHEEL_LEVELS                          2
+#define UX_HOST_TIMER_WHEEL_SLOTS                           (1u << UX_HOST_TIMER_WHEEL_SLOTS_SHIFT)
+#define UX_HOST_TIMER_WHEEL_SLOTS_MASK                      (UX_HOST_TIMER_WHEEL_SLOTS - 1)
+
+#define UX_HOST_TIMER_WHEEL_IDLE                            0
+#define UX_HOST_TIMER_WHEEL_ARMED                           1
+#define UX_HOST_TIMER_WHEEL_EXPIRED                         2
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+typedef struct UX_HOST_TIMER_WHEEL_STRUCT
+{
+
+    UX_TRANSFER     *ux_host_timer_wheel_slots[UX_HOST_TIMER_WHEEL_LEVELS][UX_HOST_TIMER_WHEEL_SLOTS];
+    ULONG           ux_host_timer_wheel_time;
+    ULONG           ux_host_timer_wheel_running;
+    ULONG           ux_host_timer_wheel_armed;
+    ULONG           ux_host_timer_wheel_armed_max;
+    ULONG           ux_host_timer_wheel_starts;
+    ULONG           ux_host_timer_wheel_expirations;
+} UX_HOST_TIMER_WHEEL;
+#endif
+
 #if defined(UX_HOST_STANDALONE)
 #define UX_TRANSFER_STATE_RESET(tr)             ((tr)->ux_transfer_request_state = UX_STATE_RESET)
 #define UX_TRANSFER_STATE_IDLE(tr)              ((tr)->ux_transfer_request_state = UX_STATE_IDLE)
@@ -1982,6 +2256,9 @@ typedef struct UX_DEVICE_STRUCT
     struct UX_HUB_TT_STRUCT                      
                     ux_device_hub_tt[UX_MAX_TT];
 #endif
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE) && !defined(UX_HOST_STANDALONE)
+    ULONG           ux_device_address_set_time;
+#endif
 
 #if defined(UX_HOST_STANDALONE)
     ULONG           ux_device_flags;
@@ -2258,6 +2535,8 @@ typedef struct UX_HCD_STRUCT
 #if defined(UX_HOST_STANDALONE)
     ULONG           ux_hcd_flags;
 #endif
+
+    ULONG           ux_hcd_capabilities;
 } UX_HCD;
 
 
@@ -2288,6 +2567,10 @@ typedef struct UX_SLAVE_TRANSFER_STRUCT
     ULONG           ux_slave_transfer_request_force_zlp;
     UCHAR           ux_slave_transfer_request_setup[UX_SETUP_SIZE];
     ULONG           ux_slave_transfer_request_status_phase_ignore;
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+    struct UX_SLAVE_TRANSFER_STRUCT
+                    *ux_slave_transfer_request_next_transfer_request;
+#endif
 } UX_SLAVE_TRANSFER;
 
 #if defined(UX_DEVICE_STANDALONE)
@@ -2313,6 +2596,12 @@ typedef struct UX_SLAVE_ENDPOINT_STRUCT
                     *ux_slave_endpoint_device;
     struct UX_SLAVE_TRANSFER_STRUCT             
                     ux_slave_endpoint_transfer_request;
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+    struct UX_SLAVE_TRANSFER_STRUCT
+                    *ux_slave_endpoint_transfer_queue_head;
+    struct UX_SLAVE_TRANSFER_STRUCT
+                    *ux_slave_endpoint_transfer_queue_tail;
+#endif
 } UX_SLAVE_ENDPOINT;
 
 
@@ -2441,8 +2730,45 @@ typedef struct UX_MEMORY_BLOCK_STRUCT
                     *ux_memory_block_next;
     struct  UX_MEMORY_BLOCK_STRUCT   
                     *ux_memory_block_previous;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+    struct  UX_MEMORY_BLOCK_STRUCT
+                    *ux_memory_block_free_next;
+    struct  UX_MEMORY_BLOCK_STRUCT
+                    *ux_memory_block_free_previous;
+#endif
 } UX_MEMORY_BLOCK;
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+/* Define USBX Memory size class free lists structure.  Free list N links the
+   free blocks whose size is in range [2^N, 2^(N+1)), bit N of the map is set
+   when free list N is not empty.  */
+
+typedef struct UX_MEMORY_FREE_LISTS_STRUCT
+{
+
+    ULONG           ux_memory_free_lists_map;
+    UX_MEMORY_BLOCK *ux_memory_free_lists_head[UX_MEMORY_SIZE_CLASSES];
+} UX_MEMORY_FREE_LISTS;
+#endif
+
+
+/* Define USBX fixed-size object pool structure.  Free objects are linked
+   through their first bytes.  */
+
+typedef struct UX_OBJECT_POOL_STRUCT
+{
+
+    VOID            *ux_object_pool_free_list;
+    UCHAR           *ux_object_pool_start;
+    UCHAR           *ux_object_pool_end;
+    ULONG           ux_object_pool_object_size;
+    ULONG           ux_object_pool_object_count;
+    ULONG           ux_object_pool_available;
+    ULONG           ux_object_pool_memory_alignment;
+    ULONG           ux_object_pool_memory_cache_flag;
+} UX_OBJECT_POOL;
+
 
 typedef struct UX_SYSTEM_STRUCT
 {                                        
@@ -2453,6 +2779,12 @@ typedef struct UX_SYSTEM_STRUCT
     UX_MEMORY_BLOCK *ux_system_cache_safe_memory_pool_start;
     ULONG           ux_system_cache_safe_memory_pool_size;
     ULONG           ux_system_cache_safe_memory_pool_free;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+    UX_MEMORY_FREE_LISTS
+                    ux_system_regular_memory_pool_free_lists;
+    UX_MEMORY_FREE_LISTS
+                    ux_system_cache_safe_memory_pool_free_lists;
+#endif
 #ifdef UX_ENABLE_MEMORY_STATISTICS
     UCHAR           *ux_system_regular_memory_pool_base;
     ALIGN_TYPE      ux_system_regular_memory_pool_max_start_offset;
@@ -2493,6 +2825,39 @@ typedef struct UX_SYSTEM_STRUCT
 } UX_SYSTEM;
 
 
+/* Define USBX Host descriptor cache entry structure.  */
+
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+typedef struct UX_HOST_CLASS_INSTANCE_ENTRY_STRUCT
+{
+
+    VOID            *ux_host_class_instance_entry_instance;
+    UX_HOST_CLASS   *ux_host_class_instance_entry_class;
+    UCHAR           *ux_host_class_instance_entry_name;
+} UX_HOST_CLASS_INSTANCE_ENTRY;
+
+#define UX_HOST_CLASS_INSTANCE_TABLE_HASH(i)    ((ULONG)(((ALIGN_TYPE)(i) >> 3) ^ ((ALIGN_TYPE)(i) >> 11)) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1))
+#endif
+
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+typedef struct UX_HOST_DESCRIPTOR_CACHE_ENTRY_STRUCT
+{
+
+    struct UX_DEVICE_DESCRIPTOR_STRUCT
+                    ux_host_descriptor_cache_entry_device_descriptor;
+    UCHAR           ux_host_descriptor_cache_entry_serial[UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH];
+    ULONG           ux_host_descriptor_cache_entry_serial_length;
+    ULONG           ux_host_descriptor_cache_entry_langid;
+    UCHAR           *ux_host_descriptor_cache_entry_configurations;
+    ULONG           ux_host_descriptor_cache_entry_length;
+    ULONG           ux_host_descriptor_cache_entry_count;
+    ULONG           ux_host_descriptor_cache_entry_use;
+    struct UX_DEVICE_STRUCT
+                    *ux_host_descriptor_cache_entry_device;
+} UX_HOST_DESCRIPTOR_CACHE_ENTRY;
+#endif
+
+
 /* Define USBX System Host Data structure.  */
 
 typedef struct UX_SYSTEM_HOST_STRUCT
@@ -2552,6 +2917,31 @@ typedef struct UX_SYSTEM_HOST_STRUCT
 #endif
 #endif
 
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+    UX_HOST_DESCRIPTOR_CACHE_ENTRY
+                    ux_system_host_descriptor_cache[UX_HOST_DESCRIPTOR_CACHE_ENTRIES];
+    ULONG           ux_system_host_descriptor_cache_use;
+    ULONG           ux_system_host_descriptor_cache_hits;
+    ULONG           ux_system_host_descriptor_cache_misses;
+#endif
+
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+    UX_HOST_CLASS_INSTANCE_ENTRY
+                    ux_system_host_class_instance_table[UX_HOST_CLASS_INSTANCE_TABLE_SIZE];
+    ULONG           ux_system_host_class_instance_table_count;
+    ULONG           ux_system_host_class_instance_table_overflow;
+#endif
+
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    ULONG           ux_system_host_class_match_any;
+    ULONG           ux_system_host_class_match_index[UX_HOST_CLASS_COMMAND_USAGE_DCSP][UX_HOST_CLASS_MATCH_INDEX_BUCKETS];
+#endif
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+    UX_HOST_TIMER_WHEEL
+                    ux_system_host_timer_wheel;
+#endif
+
     UINT            (*ux_system_host_change_function) (ULONG, UX_HOST_CLASS *, VOID *);
 } UX_SYSTEM_HOST;
 
@@ -2580,6 +2970,19 @@ typedef struct UX_SYSTEM_HOST_STRUCT
 #endif
 
 
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+typedef struct UX_SLAVE_DESCRIPTOR_INDEX_STRUCT
+{
+
+    UCHAR           *ux_slave_descriptor_index_framework;
+    UCHAR           *ux_slave_descriptor_index_device;
+    UCHAR           *ux_slave_descriptor_index_qualifier;
+    UCHAR           *ux_slave_descriptor_index_otg;
+    UCHAR           *ux_slave_descriptor_index_bos;
+    UCHAR           *ux_slave_descriptor_index_configuration[UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS];
+} UX_SLAVE_DESCRIPTOR_INDEX;
+#endif
+
 typedef struct UX_SYSTEM_SLAVE_STRUCT
 {                                        
 
@@ -2597,6 +3000,16 @@ typedef struct UX_SYSTEM_SLAVE_STRUCT
     ULONG           ux_system_slave_language_id_framework_length;
     UCHAR           *ux_system_slave_dfu_framework;
     ULONG           ux_system_slave_dfu_framework_length;
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+    UX_SLAVE_DESCRIPTOR_INDEX
+                    ux_system_slave_descriptor_index_high_speed;
+    UX_SLAVE_DESCRIPTOR_INDEX
+                    ux_system_slave_descriptor_index_full_speed;
+    UCHAR           **ux_system_slave_string_index;
+    USHORT          *ux_system_slave_string_index_language;
+    ULONG           ux_system_slave_string_index_languages;
+    ULONG           ux_system_slave_string_index_strings;
+#endif
 #if UX_MAX_SLAVE_CLASS_DRIVER > 1
     UINT            ux_system_slave_max_class;
 #endif
@@ -2697,8 +3110,13 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_host_stack_class_get                                 _uxe_host_stack_class_get
 #define ux_host_stack_class_instance_get                        _uxe_host_stack_class_instance_get
 #define ux_host_stack_class_register                            _uxe_host_stack_class_register
+#define ux_host_stack_completion_queue_bind                     _uxe_host_stack_completion_queue_bind
+#define ux_host_stack_completion_queue_create                   _uxe_host_stack_completion_queue_create
+#define ux_host_stack_completion_queue_delete                   _uxe_host_stack_completion_queue_delete
+#define ux_host_stack_completion_queue_get                      _uxe_host_stack_completion_queue_get
 #define ux_host_stack_device_configuration_activate             _uxe_host_stack_device_configuration_activate
 #define ux_host_stack_device_configuration_deactivate           _uxe_host_stack_device_configuration_deactivate
+#define ux_host_stack_descriptor_cache_statistics_get           _uxe_host_stack_descriptor_cache_statistics_get
 #define ux_host_stack_device_configuration_get                  _uxe_host_stack_device_configuration_get
 #define ux_host_stack_device_get                                _uxe_host_stack_device_get
 #define ux_host_stack_device_string_get                         _uxe_host_stack_device_string_get
@@ -2707,6 +3125,7 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_host_stack_hcd_unregister                            _uxe_host_stack_hcd_unregister
 #define ux_host_stack_interface_endpoint_get                    _uxe_host_stack_interface_endpoint_get
 #define ux_host_stack_interface_setting_select                  _uxe_host_stack_interface_setting_select
+#define ux_host_stack_timer_wheel_statistics_get                _uxe_host_stack_timer_wheel_statistics_get
 #define ux_host_stack_transfer_request                          _uxe_host_stack_transfer_request
 #define ux_host_stack_transfer_request_abort                    _uxe_host_stack_transfer_request_abort
 
@@ -2715,8 +3134,13 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_host_stack_class_get                                 _ux_host_stack_class_get
 #define ux_host_stack_class_instance_get                        _ux_host_stack_class_instance_get
 #define ux_host_stack_class_register                            _ux_host_stack_class_register
+#define ux_host_stack_completion_queue_bind                     _ux_host_stack_completion_queue_bind
+#define ux_host_stack_completion_queue_create                   _ux_host_stack_completion_queue_create
+#define ux_host_stack_completion_queue_delete                   _ux_host_stack_completion_queue_delete
+#define ux_host_stack_completion_queue_get                      _ux_host_stack_completion_queue_get
 #define ux_host_stack_device_configuration_activate             _ux_host_stack_device_configuration_activate
 #define ux_host_stack_device_configuration_deactivate           _ux_host_stack_device_configuration_deactivate
+#define ux_host_stack_descriptor_cache_statistics_get           _ux_host_stack_descriptor_cache_statistics_get
 #define ux_host_stack_device_configuration_get                  _ux_host_stack_device_configuration_get
 #define ux_host_stack_device_get                                _ux_host_stack_device_get
 #define ux_host_stack_device_string_get                         _ux_host_stack_device_string_get
@@ -2725,6 +3149,7 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_host_stack_hcd_unregister                            _ux_host_stack_hcd_unregister
 #define ux_host_stack_interface_endpoint_get                    _ux_host_stack_interface_endpoint_get
 #define ux_host_stack_interface_setting_select                  _ux_host_stack_interface_setting_select
+#define ux_host_stack_timer_wheel_statistics_get                _ux_host_stack_timer_wheel_statistics_get
 #define ux_host_stack_transfer_request                          _ux_host_stack_transfer_request
 #define ux_host_stack_transfer_request_abort                    _ux_host_stack_transfer_request_abort
 
@@ -2734,6 +3159,7 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_host_stack_class_instance_destroy                    _ux_host_stack_class_instance_destroy
 #define ux_host_stack_class_unregister                          _ux_host_stack_class_unregister
 #define ux_host_stack_configuration_interface_get               _ux_host_stack_configuration_interface_get
+#define ux_host_stack_descriptor_cache_flush                    _ux_host_stack_descriptor_cache_flush
 #define ux_host_stack_device_configuration_reset                _ux_host_stack_device_configuration_reset
 #define ux_host_stack_device_configuration_select               _ux_host_stack_device_configuration_select
 #define ux_host_stack_initialize                                _ux_host_stack_initialize
@@ -2778,6 +3204,7 @@ typedef struct UX_HOST_CLASS_DPUMP_STRUCT
 #define ux_device_stack_interface_start                         _ux_device_stack_interface_start
 #define ux_device_stack_transfer_request                        _ux_device_stack_transfer_request
 #define ux_device_stack_transfer_abort                          _ux_device_stack_transfer_abort
+#define ux_device_stack_transfer_queue                          _ux_device_stack_transfer_queue
 
 #define ux_device_stack_tasks_run                               _ux_device_stack_tasks_run
 #define ux_device_stack_transfer_run                            _ux_device_stack_transfer_run
@@ -2817,8 +3244,15 @@ UINT    ux_host_stack_class_instance_destroy(UX_HOST_CLASS *host_class, VOID *cl
 UINT    ux_host_stack_class_instance_get(UX_HOST_CLASS *host_class, UINT class_index, VOID **class_instance);
 UINT    ux_host_stack_class_register(UCHAR *class_name, UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *));
 UINT    ux_host_stack_class_unregister(UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *));
+UINT    ux_host_stack_completion_queue_bind(UX_TRANSFER *transfer_request, UX_HOST_COMPLETION_QUEUE *queue);
+UINT    ux_host_stack_completion_queue_create(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    ux_host_stack_completion_queue_delete(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    ux_host_stack_completion_queue_get(UX_HOST_COMPLETION_QUEUE *queue, UX_TRANSFER **transfer_requests,
+                                    ULONG max_transfers, ULONG *actual_transfers, ULONG wait_option);
 UINT    ux_host_stack_configuration_interface_get(UX_CONFIGURATION *configuration, UINT interface_index,
                                     UINT alternate_setting_index, UX_INTERFACE **ux_interface);
+UINT    ux_host_stack_descriptor_cache_flush(VOID);
+UINT    ux_host_stack_descriptor_cache_statistics_get(ULONG *hits, ULONG *misses);
 UINT    ux_host_stack_device_configuration_activate(UX_CONFIGURATION *configuration);
 UINT    ux_host_stack_device_configuration_deactivate(UX_DEVICE *device);
 UINT    ux_host_stack_device_configuration_get(UX_DEVICE *device, UINT configuration_index, UX_CONFIGURATION **configuration);
@@ -2832,6 +3266,7 @@ UINT    ux_host_stack_initialize(UINT (*ux_system_host_change_function)(ULONG, U
 UINT    ux_host_stack_uninitialize(VOID);
 UINT    ux_host_stack_interface_endpoint_get(UX_INTERFACE *ux_interface, UINT endpoint_index, UX_ENDPOINT **endpoint);
 UINT    ux_host_stack_interface_setting_select(UX_INTERFACE *ux_interface);
+UINT    ux_host_stack_timer_wheel_statistics_get(ULONG *armed, ULONG *armed_max, ULONG *starts, ULONG *expirations);
 UINT    ux_host_stack_transfer_request(UX_TRANSFER *transfer_request);
 UINT    ux_host_stack_transfer_request_abort(UX_TRANSFER *transfer_request);
 VOID    ux_host_stack_hnp_polling_thread_entry(ULONG id);
@@ -2878,6 +3313,7 @@ UINT    ux_device_stack_interface_set(UCHAR * device_framework, ULONG device_fra
 UINT    ux_device_stack_interface_start(UX_SLAVE_INTERFACE *ux_interface);
 UINT    ux_device_stack_transfer_request(UX_SLAVE_TRANSFER *transfer_request, ULONG slave_length, ULONG host_length);
 UINT    ux_device_stack_transfer_request_abort(UX_SLAVE_TRANSFER *transfer_request, ULONG completion_code);
+UINT    ux_device_stack_transfer_queue(UX_SLAVE_TRANSFER *transfer_request, ULONG slave_length, ULONG host_length);
 
 UINT    ux_device_stack_tasks_run(VOID);
 UINT    ux_device_stack_transfer_run(UX_SLAVE_TRANSFER *transfer_request, ULONG slave_length, ULONG host_length);
@@ -55,6 +55,9 @@
 /*                                            resulting in version 6.1.12 */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added endpoint transfer     */
+/*                                            queue,                      */
+/*                                            added descriptor index,     */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -86,6 +89,7 @@ UINT    _ux_device_stack_clear_feature(ULONG request_type, ULONG request_value,
 UINT    _ux_device_stack_configuration_get(VOID);
 UINT    _ux_device_stack_configuration_set(ULONG configuration_value);
 UINT    _ux_device_stack_control_request_process(UX_SLAVE_TRANSFER *transfer_request);
+VOID    _ux_device_stack_descriptor_index_build(VOID);
 UINT    _ux_device_stack_descriptor_send(ULONG descriptor_type, ULONG request_index, ULONG host_length);
 UINT    _ux_device_stack_disconnect(VOID);
 UINT    _ux_device_stack_endpoint_stall(UX_SLAVE_ENDPOINT *endpoint);
@@ -105,6 +109,7 @@ UINT    _ux_device_stack_set_feature(ULONG request_type, ULONG request_value, UL
 UINT    _ux_device_stack_transfer_all_request_abort(UX_SLAVE_ENDPOINT *endpoint, ULONG completion_code);
 UINT    _ux_device_stack_transfer_request(UX_SLAVE_TRANSFER *transfer_request, ULONG slave_length, ULONG host_length);
 UINT    _ux_device_stack_transfer_abort(UX_SLAVE_TRANSFER *transfer_request, ULONG completion_code);
+UINT    _ux_device_stack_transfer_queue(UX_SLAVE_TRANSFER *transfer_request, ULONG slave_length, ULONG host_length);
 UINT    _ux_device_stack_class_unregister(UCHAR *class_name, UINT (*class_entry_function)(struct UX_SLAVE_CLASS_COMMAND_STRUCT *));
 UINT    _ux_device_stack_microsoft_extension_register(ULONG vendor_request, UINT (*vendor_request_function)(ULONG, ULONG, ULONG, ULONG, UCHAR *, ULONG *));
 UINT    _ux_device_stack_uninitialize(VOID);
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_hcd_sim_host.h                                   PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -61,6 +61,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added fast loopback mode,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -81,7 +84,11 @@ extern   "C" {
 /* Define simulator host generic definitions.  */
 
 #define UX_HCD_SIM_HOST_CONTROLLER                              99
+#if defined(UX_SIM_FAST_LOOPBACK_ENABLE)
+#define UX_HCD_SIM_HOST_MAX_PAYLOAD                             0x7FFFFFFFu
+#else
 #define UX_HCD_SIM_HOST_MAX_PAYLOAD                             4096
+#endif
 #define UX_HCD_SIM_HOST_FRAME_DELAY                             4 
 #define UX_HCD_SIM_HOST_PERIODIC_ENTRY_NB                       32    
 #define UX_HCD_SIM_HOST_PERIODIC_ENTRY_MASK                     0x1f
@@ -258,6 +265,7 @@ UINT    _ux_hcd_sim_host_request_control_transfer(UX_HCD_SIM_HOST *hcd_sim_host,
 UINT    _ux_hcd_sim_host_request_interrupt_transfer(UX_HCD_SIM_HOST *hcd_sim_host, UX_TRANSFER *transfer_request);
 UINT    _ux_hcd_sim_host_request_isochronous_transfer(UX_HCD_SIM_HOST *hcd_sim_host, UX_TRANSFER *transfer_request);
 UINT    _ux_hcd_sim_host_request_transfer(UX_HCD_SIM_HOST *hcd_sim_host, UX_TRANSFER *transfer_request);
+VOID    _ux_hcd_sim_host_schedule_signal(VOID);
 VOID    _ux_hcd_sim_host_timer_function(ULONG hcd_sim_host_addr);
 UINT    _ux_hcd_sim_host_transaction_schedule(UX_HCD_SIM_HOST *hcd_sim_host, UX_HCD_SIM_HOST_ED *ed);
 UINT    _ux_hcd_sim_host_transfer_abort(UX_HCD_SIM_HOST *hcd_sim_host, UX_TRANSFER *transfer_request);
@@ -67,6 +67,18 @@
 /*                                            resulting in version 6.1.12 */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added class instance pools, */
+/*                                            added device address and    */
+/*                                            enumeration steps           */
+/*                                            prototypes,                 */
+/*                                            added descriptor cache      */
+/*                                            prototypes,                 */
+/*                                            added class match index     */
+/*                                            prototype,                  */
+/*                                            added completion queue      */
+/*                                            prototypes,                 */
+/*                                            added timer wheel           */
+/*                                            prototypes,                 */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -138,10 +150,27 @@ UINT    _ux_host_stack_class_instance_destroy(UX_HOST_CLASS *class, VOID *class_
 UINT    _ux_host_stack_class_instance_create(UX_HOST_CLASS *class, VOID *class_instance);
 UINT    _ux_host_stack_class_instance_get(UX_HOST_CLASS *class, UINT class_index, VOID **class_instance);
 UINT    _ux_host_stack_class_instance_verify(UCHAR *class_name, VOID *class_instance);
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+VOID   *_ux_host_stack_class_instance_allocate(UX_HOST_CLASS *host_class, ULONG memory_alignment,
+                                              ULONG memory_cache_flag, ULONG memory_size_requested);
+VOID    _ux_host_stack_class_instance_free(UX_HOST_CLASS *host_class, VOID *class_instance);
+#else
+#define _ux_host_stack_class_instance_allocate(c,a,f,s)          _ux_utility_memory_allocate(a,f,s)
+#define _ux_host_stack_class_instance_free(c,i)                  _ux_utility_memory_free(i)
+#endif
 UINT    _ux_host_stack_class_interface_scan(UX_DEVICE *device);
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+VOID    _ux_host_stack_class_match_index_build(VOID);
+#endif
 UINT    _ux_host_stack_class_register(UCHAR *class_name,
                         UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *));
 UINT    _ux_host_stack_class_unregister(UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *));
+UINT    _ux_host_stack_completion_queue_bind(UX_TRANSFER *transfer_request, UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _ux_host_stack_completion_queue_create(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _ux_host_stack_completion_queue_delete(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _ux_host_stack_completion_queue_get(UX_HOST_COMPLETION_QUEUE *queue, UX_TRANSFER **transfer_requests,
+                                    ULONG max_transfers, ULONG *actual_transfers, ULONG wait_option);
+VOID    _ux_host_stack_completion_queue_transfer_done(UX_TRANSFER *transfer_request);
 UINT    _ux_host_stack_configuration_descriptor_parse(UX_DEVICE *device, UX_CONFIGURATION *configuration, UINT configuration_index);
 UINT    _ux_host_stack_configuration_enumerate(UX_DEVICE *device);
 UINT    _ux_host_stack_configuration_instance_create(UX_CONFIGURATION *configuration);
@@ -152,6 +181,11 @@ UINT    _ux_host_stack_configuration_interface_get(UX_CONFIGURATION *configurati
 UINT    _ux_host_stack_configuration_interface_scan(UX_CONFIGURATION *configuration);
 UINT    _ux_host_stack_configuration_set(UX_CONFIGURATION *configuration);
 VOID    _ux_host_stack_delay_ms(ULONG time);
+UINT    _ux_host_stack_descriptor_cache_flush(VOID);
+UINT    _ux_host_stack_descriptor_cache_lookup(UX_DEVICE *device, UCHAR **configurations);
+VOID    _ux_host_stack_descriptor_cache_save(UX_DEVICE *device, UINT configuration_index,
+                                UCHAR *descriptor, ULONG length);
+UINT    _ux_host_stack_descriptor_cache_statistics_get(ULONG *hits, ULONG *misses);
 UINT    _ux_host_stack_device_address_set(UX_DEVICE *device);
 UINT    _ux_host_stack_device_configuration_activate(UX_CONFIGURATION *configuration);
 UINT    _ux_host_stack_device_configuration_deactivate(UX_DEVICE *device);
@@ -188,11 +222,21 @@ UINT    _ux_host_stack_new_device_create(UX_HCD *hcd, UX_DEVICE *device_owner,
                                 UINT port_index, UINT device_speed,
                                 UINT port_max_power,
                                 UX_DEVICE **created_device);
+UINT    _ux_host_stack_new_device_address(UX_HCD *hcd, UX_DEVICE *device_owner,
+                                UINT port_index, UINT device_speed,
+                                UINT port_max_power,
+                                UX_DEVICE **created_device);
+UINT    _ux_host_stack_new_device_enumerate(UX_DEVICE *device);
 UINT    _ux_host_stack_new_endpoint_create(UX_INTERFACE *ux_interface, UCHAR * interface_endpoint);
 UINT    _ux_host_stack_new_interface_create(UX_CONFIGURATION *configuration, UCHAR * descriptor, ULONG length);
 VOID    _ux_host_stack_rh_change_process(VOID);
 UINT    _ux_host_stack_rh_device_extraction(UX_HCD *hcd, UINT port_index);
 UINT    _ux_host_stack_rh_device_insertion(UX_HCD *hcd, UINT port_index);
+VOID    _ux_host_stack_timer_wheel_insert(UX_TRANSFER *transfer_request);
+VOID    _ux_host_stack_timer_wheel_run(VOID);
+UINT    _ux_host_stack_timer_wheel_statistics_get(ULONG *armed, ULONG *armed_max, ULONG *starts, ULONG *expirations);
+VOID    _ux_host_stack_transfer_timer_start(UX_TRANSFER *transfer_request, ULONG timeout);
+VOID    _ux_host_stack_transfer_timer_stop(UX_TRANSFER *transfer_request);
 UINT    _ux_host_stack_transfer_request(UX_TRANSFER *transfer_request);
 UINT    _ux_host_stack_transfer_request_abort(UX_TRANSFER *transfer_request);
 UINT    _ux_host_stack_role_swap(UX_DEVICE *device);
@@ -209,9 +253,15 @@ UINT    _uxe_host_stack_class_get(UCHAR *class_name, UX_HOST_CLASS **ux_class);
 UINT    _uxe_host_stack_class_instance_get(UX_HOST_CLASS *class, UINT class_index, VOID **class_instance);
 UINT    _uxe_host_stack_class_register(UCHAR *class_name,
                         UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *));
+UINT    _uxe_host_stack_completion_queue_bind(UX_TRANSFER *transfer_request, UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _uxe_host_stack_completion_queue_create(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _uxe_host_stack_completion_queue_delete(UX_HOST_COMPLETION_QUEUE *queue);
+UINT    _uxe_host_stack_completion_queue_get(UX_HOST_COMPLETION_QUEUE *queue, UX_TRANSFER **transfer_requests,
+                                    ULONG max_transfers, ULONG *actual_transfers, ULONG wait_option);
 UINT    _uxe_host_stack_configuration_interface_get(UX_CONFIGURATION *configuration, 
                                                 UINT interface_index, UINT alternate_setting_index,
                                                 UX_INTERFACE **ux_interface);
+UINT    _uxe_host_stack_descriptor_cache_statistics_get(ULONG *hits, ULONG *misses);
 UINT    _uxe_host_stack_device_configuration_activate(UX_CONFIGURATION *configuration);
 UINT    _uxe_host_stack_device_configuration_deactivate(UX_DEVICE *device);
 UINT    _uxe_host_stack_device_configuration_get(UX_DEVICE *device, UINT configuration_index,
@@ -224,6 +274,7 @@ UINT    _uxe_host_stack_hcd_register(UCHAR *hcd_name,
 UINT    _uxe_host_stack_hcd_unregister(UCHAR *hcd_name, ULONG hcd_param1, ULONG hcd_param2);
 UINT    _uxe_host_stack_interface_endpoint_get(UX_INTERFACE *ux_interface, UINT endpoint_index, UX_ENDPOINT **endpoint);
 UINT    _uxe_host_stack_interface_setting_select(UX_INTERFACE *ux_interface);
+UINT    _uxe_host_stack_timer_wheel_statistics_get(ULONG *armed, ULONG *armed_max, ULONG *starts, ULONG *expirations);
 UINT    _uxe_host_stack_transfer_request(UX_TRANSFER *transfer_request);
 UINT    _uxe_host_stack_transfer_request_abort(UX_TRANSFER *transfer_request);
 UINT    _uxe_host_stack_transfer_run(UX_TRANSFER *transfer_request);
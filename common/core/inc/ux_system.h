@@ -55,6 +55,7 @@
 /*                                            resulting in version 6.1.11 */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added device CDC-NCM name,  */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -151,6 +152,7 @@ extern UCHAR _ux_system_slave_class_pima_name[];
 extern UCHAR _ux_system_slave_class_hid_name[]; 
 extern UCHAR _ux_system_slave_class_rndis_name[]; 
 extern UCHAR _ux_system_slave_class_cdc_ecm_name[]; 
+extern UCHAR _ux_system_slave_class_cdc_ncm_name[];
 extern UCHAR _ux_system_slave_class_dfu_name[];
 
 extern UCHAR _ux_system_device_class_printer_name[];
@@ -26,7 +26,7 @@
 /*  PORT SPECIFIC C INFORMATION                            RELEASE        */ 
 /*                                                                        */ 
 /*    ux_user.h                                           PORTABLE C      */ 
-/*                                                           6.2.1        */
+/*                                                           6.x          */
 /*                                                                        */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -99,6 +99,31 @@
 /*                                            added option to enable      */
 /*                                            basic USBX error checking,  */
 /*                                            resulting in version 6.2.1  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added option to enable      */
+/*                                            memory free lists,          */
+/*                                            added device CDC-NCM        */
+/*                                            options,                    */
+/*                                            added trace buffer options, */
+/*                                            added endpoint transfer     */
+/*                                            queue option,               */
+/*                                            added audio samples float   */
+/*                                            format option,              */
+/*                                            added host video frame      */
+/*                                            assembly option,            */
+/*                                            added host enumeration      */
+/*                                            pipeline option,            */
+/*                                            added host descriptor cache */
+/*                                            options,                    */
+/*                                            added device descriptor     */
+/*                                            index,                      */
+/*                                            added class instance table, */
+/*                                            added class match index,    */
+/*                                            added completion queue,     */
+/*                                            added timer wheel,          */
+/*                                            added transfer segments,    */
+/*                                            added CDC ECM receive ring, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -231,6 +256,44 @@
 /* #define UX_SLAVE_CLASS_STORAGE_INCLUDE_MMC   */
 
 
+/* Defined, this value enables double buffered media access in the device storage class in RTOS mode.
+   A media thread reads/writes one endpoint buffer while the other one is transferred on USB, so
+   media access time overlaps USB transfer time. It costs one more thread (UX_THREAD_STACK_SIZE).
+   Standalone mode always overlaps them, so the value is not used there.  */
+
+/* #define UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE   */
+
+
+/* Defined, this value represents the maximum number of Ethernet packets the device RNDIS class
+   concatenates in one bulk transfer (MaxPacketsPerTransfer of RNDIS INITIALIZE response), in both
+   directions. Bulk IN aggregation is also limited by the MaxTransferSize requested by the host. The
+   default is 1 (no aggregation). If it's more than 1, UX_DEVICE_CLASS_RNDIS_MAX_PACKET_TRANSFER_SIZE
+   defaults to UX_SLAVE_REQUEST_DATA_MAX_LENGTH, which should be large enough for several packets.  */
+
+/* #define UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER       4  */
+
+
+/* Defined, these values represent the maximum NTB sizes (dwNtbInMaxSize/dwNtbOutMaxSize) of the
+   device CDC-NCM class. NTBs are built in/parsed from the endpoint transfer buffers, so they can not
+   exceed UX_SLAVE_REQUEST_DATA_MAX_LENGTH, which is the default. Increase both for high speed rates.  */
+
+/* #define UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE             (1024 * 16)  */
+/* #define UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE            (1024 * 16)  */
+
+
+/* Defined, this value represents the maximum number of datagrams the device CDC-NCM class packs in
+   one IN NTB. The default is 16.  */
+
+/* #define UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_DATAGRAMS        16  */
+
+
+/* Defined, this value represents the time (in ms) the device CDC-NCM class waits for more packets
+   before sending an IN NTB that is not full. The default is 0, the NTB is sent as soon as the
+   transmit queue is empty.  */
+
+/* #define UX_DEVICE_CLASS_CDC_NCM_NTB_FLUSH_TIMEOUT           1  */
+
+
 /* Defined, this value represents the maximum number of bytes that a storage payload can send/receive.
    The default is 8K bytes but can be reduced in memory constrained environments.  */
 #define UX_HOST_CLASS_STORAGE_MEMORY_BUFFER_SIZE            (1024 * 8)
@@ -311,6 +374,40 @@
 
 /* #define UX_ENFORCE_SAFE_ALIGNMENT   */
 
+/* Defined, this value enables the memory size class free lists. Free memory blocks are linked
+   in power-of-two size class lists (per regular and cache safe pool), so allocation does not
+   scan all memory blocks of the pool and free merges only the adjacent blocks.
+   Each memory block header is enlarged by two pointers.
+*/
+
+/* #define UX_ENABLE_MEMORY_FREE_LISTS   */
+
+/* Defined, this value represents the number of instances kept in the instance pool of each
+   host class. The pool is allocated on first instance activation of the class, then instances
+   are taken from and returned to the pool in constant time, without the memory pool search
+   and the system mutex. When the pool is exhausted, instances are allocated from the memory
+   pool. Supported by storage, HID, CDC-ACM, CDC-ECM and DPUMP host classes.
+*/
+
+/* #define UX_HOST_CLASS_INSTANCE_POOL_ENTRIES   4 */
+
+/* Defined, this value enables word access in memory copy, set and compare utilities. Memory is
+   accessed in ALIGN_TYPE words when the blocks have the same word alignment, bytes are used
+   for the unaligned head and tail. Note the port may define UX_UTILITY_MEMORY_COPY,
+   UX_UTILITY_MEMORY_SET and UX_UTILITY_MEMORY_COMPARE (memcpy/memset/memcmp style) to use its
+   own optimized functions instead, in this case this value has no effect.
+*/
+
+/* #define UX_ENABLE_MEMORY_WORD_ACCESS   */
+
+/* Defined, this value enables fast loopback between host simulator and device simulator.
+   Bulk and control transfers are not split in 4K TDs, so data moves between host and device
+   buffers in a single copy as long as the host and device requests allow, and the host simulator
+   is signaled on each host or device transfer request instead of waiting for next timer tick.
+*/
+
+/* #define UX_SIM_FAST_LOOPBACK_ENABLE   */
+
 /* Defined, this value represents the number of packets in the CDC_ECM device class.
    The default is 16.
 */
@@ -337,6 +434,15 @@
 
 /* #define UX_HOST_CLASS_CDC_ECM_PACKET_POOL_INSTANCE_WAIT  10 */
 
+/* Defined, this value enables the receive ring of the CDC_ECM host class and represents its
+   number of packets. The packets are allocated from the IP instance packet pool ahead of time, and
+   frames are received in them directly. Each packet of the pool must hold a full Ethernet frame
+   (1538 bytes after 2 bytes of alignment).
+   Received frames are passed to NetX in batches and the ring is refilled in bulk.
+ */
+
+/* #define UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE          8 */
+
 /* Defined, this enables CDC ECM class to use the packet pool from NetX instance.
    It's deprecated, packet pool from NetX instance is always used now.
  */
@@ -415,10 +521,22 @@
 
 /* define UX_DEVICE_CLASS_AUDIO_INTERRUPT_SUPPORT  */
 
+/* Defined, device audio block samples read supports float format.  */
+
+/* #define UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT  */
+
 /* Defined, this macro enables device bi-directional-endpoint support.  */
 
 /* #define UX_DEVICE_BIDIRECTIONAL_ENDPOINT_SUPPORT  */
 
+/* Defined, this macro enables device endpoint transfer queues (RTOS mode only): ux_device_stack_transfer_queue
+   queues transfer requests on a non-control endpoint without waiting, they are served back to back and
+   completed through their completion functions. The DCD must support UX_DCD_TRANSFER_QUEUE (the simulator
+   does). Device CDC-ACM uses it to keep two transfers in flight in transmission (write with callback) mode.
+*/
+
+/* #define UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT  */
+
 /* Defined, this macro disables interface alternate setting support.
    Device stalls 
  */
@@ -442,6 +560,16 @@
  */
 /* #define UX_MAX_DEVICE_INTERFACES                        1  */
 
+/* Defined, this macro enables device descriptor index.
+   The device frameworks and the string framework are indexed by _ux_device_stack_initialize,
+   so GET_DESCRIPTOR requests are answered without walking the frameworks.
+   UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS is the number of configurations indexed per
+   framework, default 4. Higher configuration indexes are searched in the framework.
+ */
+
+/* #define UX_DEVICE_DESCRIPTOR_INDEX_ENABLE  */
+/* #define UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS  4  */
+
 
 /* Defined, this macro enables device/host PIMA MTP support.  */
 
@@ -455,6 +583,80 @@
 
 /* #define UX_HOST_DEVICE_CLASS_CODE_VALIDATION_ENABLE  */
 
+/* Defined, this macro enables host enumeration pipeline (RTOS mode only).
+   When several ports of a hub change together, the ports are debounced together and
+   each device is reset and addressed in turn, then the addressed devices are enumerated.
+   Only one device is at the default address at a time, the waits are overlapped.
+ */
+
+/* #define UX_HOST_ENUMERATION_PIPELINE_ENABLE  */
+
+/* Defined, this macro enables host descriptor cache (RTOS mode only).
+   The configuration descriptors of attached devices are kept, keyed by device descriptor
+   (VID, PID, bcdDevice ...) and serial number. When a known device is attached again,
+   its configurations are built from the cache instead of being read from the device.
+   The serial number is only read when a device of the same model is cached, in the first
+   language of the device. A serial number longer than the max length is not cached.
+   UX_HOST_DESCRIPTOR_CACHE_ENTRIES is the number of devices kept, default 4.
+   UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH is the max serial number string descriptor length, default 64.
+ */
+
+/* #define UX_HOST_DESCRIPTOR_CACHE_ENABLE  */
+/* #define UX_HOST_DESCRIPTOR_CACHE_ENTRIES         4  */
+/* #define UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH   64  */
+
+/* Defined, this macro enables host class instance table.
+   Class instances are kept in a hash table indexed by instance pointer, so that the
+   instance check done by host classes on each read/write does not scan all classes and
+   instances. UX_HOST_CLASS_INSTANCE_TABLE_SIZE is the table size, a power of 2 larger
+   than the number of class instances, default 32. Instances beyond it are still found by scan.
+ */
+
+/* #define UX_HOST_CLASS_INSTANCE_TABLE_ENABLE  */
+/* #define UX_HOST_CLASS_INSTANCE_TABLE_SIZE        32  */
+
+/* Defined, this macro enables host class match index.
+   On registration, a class gives its list of PID/VID and class/subclass/protocol matches
+   (UX_HOST_CLASS_COMMAND_MATCH_GET). When a device or interface is enumerated, the QUERY
+   command is only sent to the classes whose list accepts it, and to the classes without list.
+   UX_HOST_CLASS_MATCH_INDEX_BUCKETS is the number of hash buckets per match usage, default 16.
+   UX_MAX_CLASS_DRIVER must not be larger than 32.
+ */
+
+/* #define UX_HOST_CLASS_MATCH_INDEX_ENABLE  */
+/* #define UX_HOST_CLASS_MATCH_INDEX_BUCKETS        16  */
+
+/* Defined, this macro enables host transfer completion queues: ux_host_stack_completion_queue_*.
+   A transfer request bound to a completion queue is put in the queue when it completes, so
+   a single thread (or the standalone main loop) can wait on the queue for the completed
+   transfers of many endpoints, instead of one thread waiting on each transfer semaphore.
+ */
+
+/* #define UX_HOST_COMPLETION_QUEUE_ENABLE  */
+
+/* Defined, this macro enables host transfer timer wheel.
+   Transfer timeouts are kept in a two level timer wheel, so arming, stopping and expiring a
+   timeout are O(1) whatever the number of pending transfers. It is used for the transfers of
+   standalone mode, instead of checking elapsed time on each transfer run, and for the transfers
+   bound to a completion queue, which have no waiting thread (the wheel is then run by
+   ux_host_stack_completion_queue_get). Expired transfers are aborted and completed with
+   UX_TRANSFER_TIMEOUT. ux_host_stack_timer_wheel_statistics_get reports the wheel counters.
+   UX_HOST_TIMER_WHEEL_SLOTS_SHIFT gives the number of slots per level (1 << shift), default 6.
+ */
+
+/* #define UX_HOST_TIMER_WHEEL_ENABLE  */
+/* #define UX_HOST_TIMER_WHEEL_SLOTS_SHIFT          6  */
+
+/* Defined, this macro enables host transfer request segments (scatter-gather).
+   A transfer request can give a list of data segments (ux_transfer_request_segments) instead
+   of a single buffer. Each segment is sent as its own packets: a segment that is not a multiple
+   of the endpoint max packet size ends with a short packet, an empty segment is a ZLP. So several
+   Ethernet frames, or a frame in several NX packets, can be sent in one transfer. Only the HCDs
+   with UX_HCD_CAPABILITY_TRANSFER_SEGMENTS accept them, it's EHCI bulk OUT for now.
+ */
+
+/* #define UX_HOST_TRANSFER_SEGMENTS_ENABLE  */
+
 
 /* Defined, host HID interrupt OUT transfer is supported.  */
 
@@ -474,6 +676,10 @@
 /* Defined, host audio optional interrupt endpoint is support.  */
 /* #define UX_HOST_CLASS_AUDIO_INTERRUPT_SUPPORT  */
 
+/* Defined, host video class assembles payloads into frame buffers, stripping the payload headers.  */
+
+/* #define UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT  */
+
 /* Defined, this value controls host configuration instance creation, include all
    interfaces and endpoints physical resources.
    Possible settings:
@@ -523,6 +729,11 @@
 
 /* Defined, this value represents the maximum size of single transfers for the SCSI data phase.
    By default it's 1024.
+   The data phase is split in transfers of this size, each one waited for before the next is
+   issued, so the bus is idle between them. The EHCI, OHCI and host simulator controller drivers
+   chain the TDs of a large transfer themselves (16K, 4K and 4K per TD), with them this value can
+   be set to the largest data phase (e.g., sectors per media read/write times sector size) so the
+   data phase is done in one transfer, as long as UX_MAX_TD covers the TDs needed.
 */
 
 #define UX_HOST_CLASS_STORAGE_MAX_TRANSFER_SIZE             (1024 * 1)
@@ -531,6 +742,25 @@
 */
 #define UX_DEBUG_LOG_SIZE                                   (1024 * 16)
 
+/* Defined, this enables the USBX trace buffer: trace events are recorded with timestamps in
+   lock-free ring buffers, one per core, instead of the ThreadX trace buffer. It works in
+   standalone mode and without TX_ENABLE_EVENT_TRACE. The events are extracted by
+   ux_trace_buffer_dump() in a binary format, see support/trace for the offline decoder.
+   UX_TRACE_BUFFER_ENTRIES is the number of events kept per core, must be a power of 2.
+   UX_TRACE_BUFFER_CORES and UX_TRACE_BUFFER_CORE_GET() define the number of ring buffers and
+   the index of the one to use for the running core.
+   UX_TRACE_BUFFER_EVENT_FILTER selects the recorded event groups, events of other groups are
+   compiled out.
+   UX_TRACE_BUFFER_TIMESTAMP_GET() returns a ULONG64 timestamp, ticking at
+   UX_TRACE_BUFFER_TIMESTAMP_FREQUENCY Hz. By default it's _ux_utility_time_get() ticking at
+   UX_PERIODIC_RATE, a port may map it to a high resolution counter.
+*/
+/* #define UX_ENABLE_TRACE_BUFFER  */
+/* #define UX_TRACE_BUFFER_ENTRIES                             1024  */
+/* #define UX_TRACE_BUFFER_CORES                               1  */
+/* #define UX_TRACE_BUFFER_CORE_GET()                          0  */
+/* #define UX_TRACE_BUFFER_EVENT_FILTER                        (UX_TRACE_ERRORS | UX_TRACE_HOST_STACK_EVENTS)  */
+
 /* Defined, this macro represents the non-blocking function to return time tick.
    This macro is used only in standalone mode.
    The tick rate is defined by UX_PERIODIC_RATE.
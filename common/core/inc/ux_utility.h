@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_utility.h                                        PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,10 @@
 /*                                            added macros for RTOS calls,*/
 /*                                            fixed OHCI PRSC issue,      */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added memory free lists,    */
+/*                                            added object pools,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -82,6 +86,24 @@ ULONG            _ux_utility_string_length_get(UCHAR *string);
 UINT             _ux_utility_string_length_check(UCHAR *input_string, UINT *string_length_ptr, UINT max_string_length);
 UX_MEMORY_BLOCK *_ux_utility_memory_free_block_best_get(ULONG memory_cache_flag, ULONG memory_size_requested);
 VOID             _ux_utility_memory_set(VOID *destination, UCHAR value, ULONG length);
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+UINT             _ux_utility_memory_free_list_index_get(ULONG memory_size);
+VOID             _ux_utility_memory_free_list_insert(UX_MEMORY_FREE_LISTS *free_lists, UX_MEMORY_BLOCK *memory_block);
+VOID             _ux_utility_memory_free_list_remove(UX_MEMORY_FREE_LISTS *free_lists, UX_MEMORY_BLOCK *memory_block);
+
+/* Free lists of the pool a memory block with given cache flag belongs to.  */
+#define _ux_utility_memory_free_lists_get(flag)                                               \
+            (((flag) == UX_CACHE_SAFE_MEMORY &&                                               \
+              _ux_system -> ux_system_cache_safe_memory_pool_start !=                         \
+              _ux_system -> ux_system_regular_memory_pool_start) ?                            \
+                &_ux_system -> ux_system_cache_safe_memory_pool_free_lists :                  \
+                &_ux_system -> ux_system_regular_memory_pool_free_lists)
+#endif
+UX_OBJECT_POOL  *_ux_utility_object_pool_create(ULONG memory_alignment, ULONG memory_cache_flag,
+                                                ULONG object_size, ULONG object_count);
+VOID             _ux_utility_object_pool_delete(UX_OBJECT_POOL *pool);
+VOID            *_ux_utility_object_pool_get(UX_OBJECT_POOL *pool);
+VOID             _ux_utility_object_pool_put(UX_OBJECT_POOL *pool, VOID *object);
 ULONG            _ux_utility_pci_class_scan(ULONG pci_class, ULONG bus_number, ULONG device_number, 
                             ULONG function_number, ULONG *current_bus_number,
                             ULONG *current_device_number, ULONG *current_function_number);
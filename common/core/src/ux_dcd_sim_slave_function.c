@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_dcd_sim_slave_function                          PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -66,6 +66,7 @@
 /*    _ux_dcd_sim_slave_state_change        Change state                  */
 /*    _ux_dcd_sim_slave_transfer_abort      Abort transfer                */
 /*    _ux_dcd_sim_slave_transfer_request    Request transfer              */
+/*    _ux_dcd_sim_slave_transfer_queue      Queue transfer                */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -81,6 +82,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transfer queue,       */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT   _ux_dcd_sim_slave_function(UX_SLAVE_DCD *dcd, UINT function, VOID *parameter)
@@ -125,6 +129,13 @@ UX_DCD_SIM_SLAVE        *dcd_sim_slave;
 
         status =  _ux_dcd_sim_slave_transfer_request(dcd_sim_slave, (UX_SLAVE_TRANSFER *) parameter);
         break;
+
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+    case UX_DCD_TRANSFER_QUEUE:
+
+        status =  _ux_dcd_sim_slave_transfer_queue(dcd_sim_slave, (UX_SLAVE_TRANSFER *) parameter);
+        break;
+#endif
 #endif
 
     case UX_DCD_TRANSFER_ABORT:
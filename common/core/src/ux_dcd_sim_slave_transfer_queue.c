@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Slave Simulator Controller Driver                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_dcd_sim_slave.h"
+#include "ux_hcd_sim_host.h"
+#include "ux_device_stack.h"
+
+
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_dcd_sim_slave_transfer_queue                    PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends a transfer request to the queue of its        */
+/*    endpoint and returns. The host simulator serves the queued          */
+/*    requests in order and invokes their completion functions.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dcd_sim_slave                         Pointer to device controller  */
+/*    transfer_request                      Pointer to transfer request   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_hcd_sim_host_schedule_signal      Signal host simulator         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Slave Simulator Controller Driver                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_dcd_sim_slave_transfer_queue(UX_DCD_SIM_SLAVE *dcd_sim_slave, UX_SLAVE_TRANSFER *transfer_request)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_SLAVE_ENDPOINT       *endpoint;
+UX_DCD_SIM_SLAVE_ED     *ed;
+
+    UX_PARAMETER_NOT_USED(dcd_sim_slave);
+
+    /* Get the pointer to the logical endpoint from the transfer request.  */
+    endpoint =  transfer_request -> ux_slave_transfer_request_endpoint;
+
+    /* Get the slave endpoint.  */
+    ed = (UX_DCD_SIM_SLAVE_ED *) endpoint -> ux_slave_endpoint_ed;
+
+    /* Protect the queue from the host simulator.  */
+    UX_DISABLE
+
+    /* Append the request.  */
+    transfer_request -> ux_slave_transfer_request_next_transfer_request =  UX_NULL;
+    if (endpoint -> ux_slave_endpoint_transfer_queue_tail != UX_NULL)
+        endpoint -> ux_slave_endpoint_transfer_queue_tail -> ux_slave_transfer_request_next_transfer_request =  transfer_request;
+    else
+        endpoint -> ux_slave_endpoint_transfer_queue_head =  transfer_request;
+    endpoint -> ux_slave_endpoint_transfer_queue_tail =  transfer_request;
+
+    /* Set the ED to TRANSFER status.  */
+    ed -> ux_sim_slave_ed_status |= UX_DCD_SIM_SLAVE_ED_STATUS_TRANSFER;
+
+    /* Restore interrupts.  */
+    UX_RESTORE
+
+#if defined(UX_SIM_FAST_LOOPBACK_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+    /* Let host simulator serve the transfer now, instead of next timer tick.  */
+    _ux_hcd_sim_host_schedule_signal();
+#endif
+
+    /* Return to caller with success.  */
+    return(UX_SUCCESS);
+}
+#endif
@@ -27,6 +27,7 @@
 
 #include "ux_api.h"
 #include "ux_dcd_sim_slave.h"
+#include "ux_hcd_sim_host.h"
 
 
 /**************************************************************************/
@@ -34,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_dcd_sim_slave_transfer_request                  PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -61,6 +62,7 @@
 /*                                                                        */ 
 /*    _ux_utility_semaphore_get             Get semaphore                 */ 
 /*    _ux_dcd_sim_slave_transfer_abort      Abort transfer                */
+/*    _ux_hcd_sim_host_schedule_signal      Signal host simulator         */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -79,6 +81,9 @@
 /*                                            before semaphore wakeup to  */
 /*                                            avoid a race condition,     */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added fast loopback mode,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_dcd_sim_slave_transfer_request(UX_DCD_SIM_SLAVE *dcd_sim_slave, UX_SLAVE_TRANSFER *transfer_request)
@@ -104,6 +109,12 @@ UINT                    status;
         /* Set the ED to TRANSFER status.  */
         ed -> ux_sim_slave_ed_status |= UX_DCD_SIM_SLAVE_ED_STATUS_TRANSFER;
 
+#if defined(UX_SIM_FAST_LOOPBACK_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+        /* Let host simulator serve the transfer now, instead of next timer tick.  */
+        _ux_hcd_sim_host_schedule_signal();
+#endif
+
         /* We should wait for the semaphore to wake us up.  */
         status =  _ux_device_semaphore_get(&transfer_request -> ux_slave_transfer_request_semaphore,
                                             transfer_request -> ux_slave_transfer_request_timeout);
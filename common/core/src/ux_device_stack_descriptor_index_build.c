@@ -0,0 +1,271 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device Stack                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_stack.h"
+
+
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_stack_descriptor_index_build             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function indexes the device frameworks and the string          */
+/*    framework, so that _ux_device_stack_descriptor_send finds the       */
+/*    descriptors without walking the frameworks.                         */
+/*                                                                        */
+/*    For each of the high speed and full speed frameworks the first      */
+/*    device, qualifier, OTG and BOS descriptors and the first            */
+/*    UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS configuration descriptors */
+/*    are recorded. A framework with a broken descriptor is not indexed.  */
+/*                                                                        */
+/*    The strings are recorded in a table by language and string index.   */
+/*    If the table can not be built the string framework is searched.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_allocate           Allocate memory               */
+/*    _ux_utility_memory_free               Free memory                   */
+/*    _ux_utility_memory_set                Set memory                    */
+/*    _ux_utility_short_get                 Get 16-bit value              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Device Stack                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_stack_descriptor_index_build(VOID)
+{
+
+UX_SLAVE_DESCRIPTOR_INDEX       *framework_index;
+UCHAR                           *device_framework;
+ULONG                           device_framework_length;
+ULONG                           descriptor_length;
+ULONG                           configuration_count;
+ULONG                           speed;
+UCHAR                           *string_framework;
+ULONG                           string_framework_length;
+UCHAR                           *string;
+ULONG                           languages;
+ULONG                           strings;
+ULONG                           language;
+UCHAR                           **string_index;
+USHORT                          *string_language;
+
+
+    /* Index the high speed framework, then the full speed framework.  */
+    for (speed = 0; speed < 2; speed ++)
+    {
+
+        if (speed == 0)
+        {
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_high_speed;
+            device_framework =  _ux_system_slave -> ux_system_slave_device_framework_high_speed;
+            device_framework_length =  _ux_system_slave -> ux_system_slave_device_framework_length_high_speed;
+        }
+        else
+        {
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_full_speed;
+            device_framework =  _ux_system_slave -> ux_system_slave_device_framework_full_speed;
+            device_framework_length =  _ux_system_slave -> ux_system_slave_device_framework_length_full_speed;
+        }
+
+        /* Reset the index. It is not used until the framework is recorded.  */
+        _ux_utility_memory_set(framework_index, 0, sizeof(UX_SLAVE_DESCRIPTOR_INDEX)); /* Use case of memset is verified. */
+        if (device_framework == UX_NULL)
+            continue;
+        configuration_count =  0;
+
+        /* Parse the device framework and record the descriptors.  */
+        while (device_framework_length != 0)
+        {
+
+            /* Get descriptor length, it must be inside the framework.  */
+            descriptor_length =  (ULONG) *device_framework;
+            if ((descriptor_length < 2) || (descriptor_length > device_framework_length))
+                break;
+
+            /* Record the first descriptor of each type.  */
+            switch (*(device_framework + 1))
+            {
+
+            case UX_DEVICE_DESCRIPTOR_ITEM:
+
+                if (framework_index -> ux_slave_descriptor_index_device == UX_NULL)
+                    framework_index -> ux_slave_descriptor_index_device =  device_framework;
+                break;
+
+            case UX_DEVICE_QUALIFIER_DESCRIPTOR_ITEM:
+
+                if (framework_index -> ux_slave_descriptor_index_qualifier == UX_NULL)
+                    framework_index -> ux_slave_descriptor_index_qualifier =  device_framework;
+                break;
+
+            case UX_OTG_DESCRIPTOR_ITEM:
+
+                if (framework_index -> ux_slave_descriptor_index_otg == UX_NULL)
+                    framework_index -> ux_slave_descriptor_index_otg =  device_framework;
+                break;
+
+            case UX_BOS_DESCRIPTOR_ITEM:
+
+                if (framework_index -> ux_slave_descriptor_index_bos == UX_NULL)
+                    framework_index -> ux_slave_descriptor_index_bos =  device_framework;
+                break;
+
+            case UX_CONFIGURATION_DESCRIPTOR_ITEM:
+
+                /* Configurations are recorded in order.  */
+                if (configuration_count < UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS)
+                    framework_index -> ux_slave_descriptor_index_configuration[configuration_count] =  device_framework;
+                configuration_count ++;
+                break;
+
+            default:
+                break;
+            }
+
+            /* Adjust what is left of the device framework.  */
+            device_framework_length -=  descriptor_length;
+
+            /* Point to the next descriptor.  */
+            device_framework +=  descriptor_length;
+        }
+
+        /* The framework is indexed only if it is parsed to the end.  */
+        if (device_framework_length == 0)
+        {
+            if (speed == 0)
+                framework_index -> ux_slave_descriptor_index_framework =  _ux_system_slave -> ux_system_slave_device_framework_high_speed;
+            else
+                framework_index -> ux_slave_descriptor_index_framework =  _ux_system_slave -> ux_system_slave_device_framework_full_speed;
+        }
+    }
+
+    /* Free the previous string index.  */
+    if (_ux_system_slave -> ux_system_slave_string_index != UX_NULL)
+    {
+        _ux_utility_memory_free(_ux_system_slave -> ux_system_slave_string_index);
+        _ux_system_slave -> ux_system_slave_string_index =  UX_NULL;
+    }
+
+    /* Count the languages and find the highest string index.  */
+    string_framework =  _ux_system_slave -> ux_system_slave_string_framework;
+    string_framework_length =  _ux_system_slave -> ux_system_slave_string_framework_length;
+    languages =  0;
+    strings =  0;
+    while (string_framework_length != 0)
+    {
+
+        /* Each string is language ID, index, length and the string itself.  */
+        if ((string_framework_length < 4) ||
+            ((ULONG) *(string_framework + 3) + 4 > string_framework_length))
+            return;
+
+        /* A language is counted at its first string.  */
+        string =  _ux_system_slave -> ux_system_slave_string_framework;
+        while ((string != string_framework) &&
+               (_ux_utility_short_get(string) != _ux_utility_short_get(string_framework)))
+            string +=  (ULONG) *(string + 3) + 4;
+        if (string == string_framework)
+            languages ++;
+
+        /* Keep the highest string index.  */
+        if ((ULONG) *(string_framework + 2) >= strings)
+            strings =  (ULONG) *(string_framework + 2) + 1;
+
+        /* Next string.  */
+        string_framework_length -=  (ULONG) *(string_framework + 3) + 4;
+        string_framework +=  (ULONG) *(string_framework + 3) + 4;
+    }
+    if (languages == 0)
+        return;
+
+    /* Allocate the table of strings by language, followed by the language IDs.  */
+    string_index =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY,
+                                                languages * (strings * sizeof(UCHAR *) + sizeof(USHORT)));
+    if (string_index == UX_NULL)
+        return;
+    string_language =  (USHORT *) (string_index + languages * strings);
+
+    /* Record the strings, the first one of a language and index is used.  */
+    string_framework =  _ux_system_slave -> ux_system_slave_string_framework;
+    string_framework_length =  _ux_system_slave -> ux_system_slave_string_framework_length;
+    languages =  0;
+    while (string_framework_length != 0)
+    {
+
+        /* Find the language row of this string, add it if it is new.  */
+        for (language = 0; language < languages; language ++)
+        {
+            if (string_language[language] == (USHORT) _ux_utility_short_get(string_framework))
+                break;
+        }
+        if (language == languages)
+        {
+            string_language[language] =  (USHORT) _ux_utility_short_get(string_framework);
+            languages ++;
+        }
+
+        /* Record the string.  */
+        if (string_index[language * strings + *(string_framework + 2)] == UX_NULL)
+            string_index[language * strings + *(string_framework + 2)] =  string_framework;
+
+        /* Next string.  */
+        string_framework_length -=  (ULONG) *(string_framework + 3) + 4;
+        string_framework +=  (ULONG) *(string_framework + 3) + 4;
+    }
+
+    /* Save the string index.  */
+    _ux_system_slave -> ux_system_slave_string_index_language =  string_language;
+    _ux_system_slave -> ux_system_slave_string_index_languages =  languages;
+    _ux_system_slave -> ux_system_slave_string_index_strings =  strings;
+    _ux_system_slave -> ux_system_slave_string_index =  string_index;
+}
+#endif
@@ -91,6 +91,7 @@
 /*                                            resulting in version 6.1.11 */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            moved compile option check, */
+/*                                            added descriptor index,     */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -118,6 +119,10 @@ UCHAR                           *string_memory;
 UCHAR                           *string_framework;
 ULONG                           string_framework_length;
 ULONG                           string_length;
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+UX_SLAVE_DESCRIPTOR_INDEX       *framework_index;
+ULONG                           language;
+#endif
 
 
     /* Build option check.  */
@@ -186,6 +191,29 @@ ULONG                           string_length;
         device_framework_length =  _ux_system_slave -> ux_system_slave_device_framework_length;
         device_framework_end = device_framework + device_framework_length;
 
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+
+        /* Get the index of the current framework.  */
+        if (device_framework == _ux_system_slave -> ux_system_slave_descriptor_index_high_speed.ux_slave_descriptor_index_framework)
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_high_speed;
+        else if (device_framework == _ux_system_slave -> ux_system_slave_descriptor_index_full_speed.ux_slave_descriptor_index_framework)
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_full_speed;
+        else
+            framework_index =  UX_NULL;
+
+        /* If the framework is indexed, only the indexed descriptor is parsed.  */
+        if (framework_index != UX_NULL)
+        {
+            if (descriptor_type == UX_DEVICE_DESCRIPTOR_ITEM)
+                device_framework =  framework_index -> ux_slave_descriptor_index_device;
+            else if (descriptor_type == UX_DEVICE_QUALIFIER_DESCRIPTOR_ITEM)
+                device_framework =  framework_index -> ux_slave_descriptor_index_qualifier;
+            else
+                device_framework =  framework_index -> ux_slave_descriptor_index_otg;
+            device_framework_end =  (device_framework == UX_NULL) ? UX_NULL : device_framework + *device_framework;
+        }
+#endif
+
         /* Parse the device framework and locate a device qualifier descriptor.  */
         while (device_framework < device_framework_end)
         {
@@ -242,6 +270,32 @@ ULONG                           string_length;
             device_framework_end = device_framework + device_framework_length;
         }
 
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+
+        /* Get the index of the framework.  */
+        if (device_framework == _ux_system_slave -> ux_system_slave_descriptor_index_high_speed.ux_slave_descriptor_index_framework)
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_high_speed;
+        else if (device_framework == _ux_system_slave -> ux_system_slave_descriptor_index_full_speed.ux_slave_descriptor_index_framework)
+            framework_index =  &_ux_system_slave -> ux_system_slave_descriptor_index_full_speed;
+        else
+            framework_index =  UX_NULL;
+
+        /* If the framework is indexed, only the indexed descriptor is parsed.
+           Configurations beyond the index are searched in the framework.  */
+        if ((framework_index != UX_NULL) &&
+            ((descriptor_type == UX_BOS_DESCRIPTOR_ITEM) || (descriptor_index < UX_DEVICE_DESCRIPTOR_INDEX_CONFIGURATIONS)))
+        {
+            if (descriptor_type == UX_BOS_DESCRIPTOR_ITEM)
+                device_framework =  framework_index -> ux_slave_descriptor_index_bos;
+            else
+            {
+                device_framework =  framework_index -> ux_slave_descriptor_index_configuration[descriptor_index];
+                parsed_descriptor_index =  descriptor_index;
+            }
+            device_framework_end =  (device_framework == UX_NULL) ? UX_NULL : device_framework + *device_framework;
+        }
+#endif
+
         /* Parse the device framework and locate a configuration descriptor.  */
         while (device_framework < device_framework_end)
         {
@@ -405,6 +459,28 @@ ULONG                           string_length;
             string_framework =  _ux_system_slave -> ux_system_slave_string_framework;
             string_framework_length =  _ux_system_slave -> ux_system_slave_string_framework_length;
 
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+
+            /* If the strings are indexed, only the indexed string is parsed.  */
+            if (_ux_system_slave -> ux_system_slave_string_index != UX_NULL)
+            {
+                string_framework =  UX_NULL;
+                if (descriptor_index < _ux_system_slave -> ux_system_slave_string_index_strings)
+                {
+                    for (language = 0; language < _ux_system_slave -> ux_system_slave_string_index_languages; language ++)
+                    {
+                        if (_ux_system_slave -> ux_system_slave_string_index_language[language] == request_index)
+                        {
+                            string_framework =  _ux_system_slave -> ux_system_slave_string_index[language *
+                                                    _ux_system_slave -> ux_system_slave_string_index_strings + descriptor_index];
+                            break;
+                        }
+                    }
+                }
+                string_framework_length =  (string_framework == UX_NULL) ? 0 : (ULONG) *(string_framework + 3) + 4;
+            }
+#endif
+
             /* We search through the string framework until we find the right index.
                The index is in the lower byte of the descriptor type. */
             while (string_framework_length != 0)
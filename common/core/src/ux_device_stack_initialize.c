@@ -39,6 +39,7 @@ UCHAR _ux_system_slave_class_pima_name[] =                                  "ux_
 UCHAR _ux_system_slave_class_hid_name[] =                                   "ux_slave_class_hid";
 UCHAR _ux_system_slave_class_rndis_name[] =                                 "ux_slave_class_rndis";
 UCHAR _ux_system_slave_class_cdc_ecm_name[] =                               "ux_slave_class_cdc_ecm";
+UCHAR _ux_system_slave_class_cdc_ncm_name[] =                               "ux_slave_class_cdc_ncm";
 UCHAR _ux_system_slave_class_dfu_name[] =                                   "ux_slave_class_dfu";
 UCHAR _ux_system_slave_class_audio_name[] =                                 "ux_slave_class_audio";
 
@@ -54,7 +55,7 @@ UX_SYSTEM_SLAVE *_ux_system_slave;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_device_stack_initialize                         PORTABLE C      */
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -83,6 +84,8 @@ UX_SYSTEM_SLAVE *_ux_system_slave;
 /*                                                                        */
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_device_stack_descriptor_index_build                             */
+/*                                          Build descriptor index        */
 /*    _ux_utility_memory_allocate           Allocate memory               */ 
 /*    _ux_utility_memory_free               Free memory                   */ 
 /*    _ux_utility_semaphore_create          Create semaphore              */
@@ -109,6 +112,10 @@ UX_SYSTEM_SLAVE *_ux_system_slave;
 /*                                            added CCID support,         */
 /*                                            added video support,        */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added device CDC-NCM name,  */
+/*                                            added descriptor index,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_stack_initialize(UCHAR * device_framework_high_speed, ULONG device_framework_length_high_speed,
@@ -415,7 +422,14 @@ UCHAR                           *memory;
 
     /* Return successful completion.  */
     if (status == UX_SUCCESS)
+    {
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+
+        /* Index the frameworks for GET_DESCRIPTOR requests.  */
+        _ux_device_stack_descriptor_index_build();
+#endif
         return(UX_SUCCESS);
+    }
     
     /* Free resources when there is error.  */
 
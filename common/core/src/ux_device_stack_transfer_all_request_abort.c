@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_device_stack_transfer_all_request_abort         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -43,7 +43,8 @@
 /*                                                                        */
 /*    This function cancels all the transfer requests attached to an      */
 /*    endpoint. The endpoint is not reset and its toggle state is left    */
-/*    the same.                                                           */
+/*    the same. The requests queued by _ux_device_stack_transfer_queue    */
+/*    are completed with the completion code.                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -57,6 +58,9 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_device_stack_transfer_abort       Transfer abort                */ 
+/*    (ux_slave_dcd_function)               Slave DCD dispatch function   */
+/*    (ux_slave_transfer_request_completion_function)                     */
+/*                                          Transfer request completion   */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -69,16 +73,56 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            aborted queued transfers,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_stack_transfer_all_request_abort(UX_SLAVE_ENDPOINT *endpoint, ULONG completion_code)
 {
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+UX_INTERRUPT_SAVE_AREA
+
+UX_SLAVE_DCD            *dcd;
+UX_SLAVE_TRANSFER       *next_transfer_request;
+#endif
 UX_SLAVE_TRANSFER       *transfer_request;    
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_STACK_TRANSFER_ALL_REQUEST_ABORT, endpoint, completion_code, 0, 0, UX_TRACE_DEVICE_STACK_EVENTS, 0, 0)
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+
+    /* Get the pointer to the DCD.  */
+    dcd =  &_ux_system_slave -> ux_system_slave_dcd;
+
+    /* Detach the queued requests first, so the DCD no longer serves them and the
+       endpoint request is no longer pending if it was queued.  */
+    UX_DISABLE
+    transfer_request =  endpoint -> ux_slave_endpoint_transfer_queue_head;
+    endpoint -> ux_slave_endpoint_transfer_queue_head =  UX_NULL;
+    endpoint -> ux_slave_endpoint_transfer_queue_tail =  UX_NULL;
+    UX_RESTORE
+
+    /* Abort the transfer at the DCD level, the DCD may flush FIFOs or wait,
+       so it's done with interrupts enabled.  */
+    if (transfer_request != UX_NULL)
+        dcd -> ux_slave_dcd_function(dcd, UX_DCD_TRANSFER_ABORT, (VOID *) transfer_request);
+
+    /* Complete the detached requests, in order.  */
+    while (transfer_request != UX_NULL)
+    {
+        next_transfer_request =  transfer_request -> ux_slave_transfer_request_next_transfer_request;
+        transfer_request -> ux_slave_transfer_request_next_transfer_request =  UX_NULL;
+        transfer_request -> ux_slave_transfer_request_completion_code =  completion_code;
+        transfer_request -> ux_slave_transfer_request_status =  UX_TRANSFER_STATUS_ABORT;
+        if (transfer_request -> ux_slave_transfer_request_completion_function != UX_NULL)
+            transfer_request -> ux_slave_transfer_request_completion_function(transfer_request);
+        transfer_request =  next_transfer_request;
+    }
+#endif
+
     /* Get the transfer request for this endpoint.  */
     transfer_request =  &endpoint -> ux_slave_endpoint_transfer_request;
     
@@ -0,0 +1,176 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device Stack                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_stack.h"
+
+
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_stack_transfer_queue                     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function queues a USB transaction on a non-control endpoint    */
+/*    and returns without waiting for it. The transfer requests queued    */
+/*    on an endpoint are served in order, back to back, so that the       */
+/*    pipe does not go idle between transfers.                            */
+/*                                                                        */
+/*    On entry the transfer request gives the endpoint, the data buffer   */
+/*    and the completion function. The completion function is invoked    */
+/*    by the DCD, or by _ux_device_stack_transfer_all_request_abort,      */
+/*    with the completion code set in the request. The request and its    */
+/*    buffer must stay valid until then. Its semaphore is not used, so    */
+/*    requests other than the endpoint's own one can be used.             */
+/*                                                                        */
+/*    The endpoint's own request must not be used with                    */
+/*    _ux_device_stack_transfer_request while requests are queued. A      */
+/*    request still pending is rejected with UX_TRANSFER_NOT_READY.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*    slave_length                          Length returned by host       */
+/*    host_length                           Length asked by host          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (ux_slave_dcd_function)               Slave DCD dispatch function   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*    Device Stack                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_stack_transfer_queue(UX_SLAVE_TRANSFER *transfer_request,
+                                            ULONG slave_length,
+                                            ULONG host_length)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_SLAVE_DCD            *dcd;
+UINT                    status;
+UX_SLAVE_ENDPOINT       *endpoint;
+ULONG                   device_state;
+
+
+    /* Get the endpoint associated with this transaction.  */
+    endpoint =  transfer_request -> ux_slave_transfer_request_endpoint;
+
+    /* Only non-control endpoints have transfer queues.  */
+    if ((endpoint -> ux_slave_endpoint_descriptor.bmAttributes & UX_MASK_ENDPOINT_TYPE) == UX_CONTROL_ENDPOINT)
+        return(UX_FUNCTION_NOT_SUPPORTED);
+
+    /* Disable interrupts to prevent the disconnection ISR from preempting us
+       while we check the device state and set the transfer status.  */
+    UX_DISABLE
+
+    /* Get the device state.  */
+    device_state =  _ux_system_slave -> ux_system_slave_device.ux_slave_device_state;
+
+    /* We can only transfer when the device is CONFIGURED, and a request
+       already pending is still linked in the DCD queue.  */
+    if ((device_state == UX_DEVICE_CONFIGURED) &&
+        (transfer_request -> ux_slave_transfer_request_status != UX_TRANSFER_STATUS_PENDING))
+
+        /* Set the transfer to pending.  */
+        transfer_request -> ux_slave_transfer_request_status =  UX_TRANSFER_STATUS_PENDING;
+
+    else
+    {
+
+        /* The device is in an invalid state or the request is pending. Restore interrupts and return error.  */
+        UX_RESTORE
+        return(UX_TRANSFER_NOT_READY);
+    }
+
+    /* Restore interrupts.  */
+    UX_RESTORE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_STACK_TRANSFER_QUEUE, transfer_request, 0, 0, 0, UX_TRACE_DEVICE_STACK_EVENTS, 0, 0)
+
+    /* Get the pointer to the DCD.  */
+    dcd =  &_ux_system_slave -> ux_system_slave_dcd;
+
+    /* Isolate the direction from the endpoint address.  */
+    if ((endpoint -> ux_slave_endpoint_descriptor.bEndpointAddress & UX_ENDPOINT_DIRECTION) == UX_ENDPOINT_IN)
+        transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_OUT;
+    else
+        transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_IN;
+
+    /* See if we need to force a zero length packet at the end of the transfer,
+       see _ux_device_stack_transfer_request.  */
+    if ((transfer_request -> ux_slave_transfer_request_phase ==  UX_TRANSFER_PHASE_DATA_OUT) &&
+        (slave_length != 0) && (host_length != slave_length) &&
+        (slave_length % endpoint -> ux_slave_endpoint_descriptor.wMaxPacketSize) == 0)
+        transfer_request -> ux_slave_transfer_request_force_zlp =  UX_TRUE;
+    else
+        transfer_request -> ux_slave_transfer_request_force_zlp =  UX_FALSE;
+
+    /* Reset the number of bytes sent/received.  */
+    transfer_request -> ux_slave_transfer_request_actual_length =  0;
+
+    /* Set the lengths and the working buffer pointer.  */
+    transfer_request -> ux_slave_transfer_request_requested_length =    slave_length;
+    transfer_request -> ux_slave_transfer_request_in_transfer_length =  slave_length;
+    transfer_request -> ux_slave_transfer_request_current_data_pointer =
+                            transfer_request -> ux_slave_transfer_request_data_pointer;
+
+    /* Reset the completion code.  */
+    transfer_request -> ux_slave_transfer_request_completion_code =  UX_SUCCESS;
+
+    /* Call the DCD driver to append the request to the endpoint queue.  */
+    status =  dcd -> ux_slave_dcd_function(dcd, UX_DCD_TRANSFER_QUEUE, transfer_request);
+
+    /* The request is not queued if the DCD does not support it.  */
+    if (status != UX_SUCCESS)
+        transfer_request -> ux_slave_transfer_request_status =  UX_TRANSFER_STATUS_COMPLETED;
+
+    /* And return the status.  */
+    return(status);
+}
+#endif
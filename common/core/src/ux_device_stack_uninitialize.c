@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_device_stack_uninitialize                       PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -72,6 +72,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added descriptor index,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_stack_uninitialize(VOID)
@@ -123,6 +126,16 @@ ULONG                           endpoints_found;
     /* Free memory for interface pool.  */
     _ux_utility_memory_free(device -> ux_slave_device_interfaces_pool);
 
+#if defined(UX_DEVICE_DESCRIPTOR_INDEX_ENABLE)
+
+    /* Free the string index.  */
+    if (_ux_system_slave -> ux_system_slave_string_index != UX_NULL)
+    {
+        _ux_utility_memory_free(_ux_system_slave -> ux_system_slave_string_index);
+        _ux_system_slave -> ux_system_slave_string_index =  UX_NULL;
+    }
+#endif
+
     /* Return successful completion.  */
     return(UX_SUCCESS);
 }
@@ -81,6 +81,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            set HCD capabilities,       */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_sim_host_initialize(UX_HCD *hcd)
@@ -115,6 +118,10 @@ UINT                status;
     hcd -> ux_hcd_available_bandwidth =  UX_HCD_SIM_HOST_AVAILABLE_BANDWIDTH;
 #endif
 
+    /* The host simulator appends each request behind the tail TD of the ED,
+       several requests can be outstanding on an endpoint.  */
+    hcd -> ux_hcd_capabilities |=  UX_HCD_CAPABILITY_CONCURRENT_TRANSFERS;
+
     /* Set the state of the controller to HALTED first.  */
     hcd -> ux_hcd_status =  UX_HCD_STATUS_HALTED;
 
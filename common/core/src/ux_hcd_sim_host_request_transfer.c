@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_sim_host_request_transfer                   PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -66,6 +66,7 @@
 /*                                                  transfer              */ 
 /*    _ux_hcd_sim_host_request_isochronous_transfer Request isochronous   */ 
 /*                                                  transfer              */ 
+/*    _ux_hcd_sim_host_schedule_signal              Signal scheduler      */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -81,6 +82,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added fast loopback mode,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_sim_host_request_transfer(UX_HCD_SIM_HOST *hcd_sim_host, UX_TRANSFER *transfer_request)
@@ -123,6 +127,13 @@ UINT            status = 0;
 
     }
 
+#if defined(UX_SIM_FAST_LOOPBACK_ENABLE)
+
+    /* Schedule the transfer now, instead of waiting for next timer tick.  */
+    if (status == UX_SUCCESS)
+        _ux_hcd_sim_host_schedule_signal();
+#endif
+
     /* Note that it is physically impossible to have a wrong endpoint type here
        so no error checking.  */
     return(status);         
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Host Simulator Controller Driver                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_hcd_sim_host.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_SIM_FAST_LOOPBACK_ENABLE) && !defined(UX_HOST_STANDALONE)
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_hcd_sim_host_schedule_signal                    PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function signals the HCD thread to run the host simulator      */ 
+/*    schedule immediately, without waiting for next timer tick. It's     */ 
+/*    invoked in fast loopback mode when a transfer is requested on       */ 
+/*    either the host simulator or the device simulator side.             */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_host_semaphore_put                Put semaphore                 */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    Host Simulator Controller Driver                                    */ 
+/*    Slave Simulator Controller Driver                                   */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_hcd_sim_host_schedule_signal(VOID)
+{
+
+UX_INTERRUPT_SAVE_AREA
+UX_HCD          *hcd;
+UINT            hcd_index;
+UINT            signaled = UX_FALSE;
+
+
+    /* Host stack may not be initialized (device only).  */
+    if (_ux_system_host == UX_NULL)
+        return;
+
+    /* Signal all operational host simulators.  */
+    for (hcd_index = 0; hcd_index < _ux_system_host -> ux_system_host_max_hcd; hcd_index++)
+    {
+
+        /* Pickup HCD pointer.  */
+        hcd =  &_ux_system_host -> ux_system_host_hcd_array[hcd_index];
+
+        /* Check if it's an operational host simulator.  */
+        if ((hcd -> ux_hcd_controller_type == UX_HCD_SIM_HOST_CONTROLLER) &&
+            (hcd -> ux_hcd_status == UX_HCD_STATUS_OPERATIONAL))
+        {
+
+            /* Post work for the HCD thread.  */
+            UX_DISABLE
+            hcd -> ux_hcd_thread_signal++;
+            UX_RESTORE
+            signaled = UX_TRUE;
+        }
+    }
+
+    /* Wake up the HCD thread.  */
+    if (signaled)
+        _ux_host_semaphore_put(&_ux_system_host -> ux_system_host_hcd_semaphore);
+}
+#endif
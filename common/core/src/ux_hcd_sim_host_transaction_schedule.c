@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_hcd_sim_host_transaction_schedule               PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -96,6 +96,9 @@
 /*                                            adjusted control request    */
 /*                                            data length handling,       */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            served queued transfers,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_sim_host_transaction_schedule(UX_HCD_SIM_HOST *hcd_sim_host, UX_HCD_SIM_HOST_ED *ed)
@@ -118,6 +121,10 @@ UX_SLAVE_TRANSFER       *slave_transfer_request;
 UX_TRANSFER             *transfer_request;
 ULONG                   endpoint_index;
 UX_SLAVE_DCD            *dcd;
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+UX_INTERRUPT_SAVE_AREA
+UCHAR                   queued;
+#endif
 
     UX_PARAMETER_NOT_USED(hcd_sim_host);
 
@@ -168,6 +175,17 @@ UX_SLAVE_DCD            *dcd;
     /* Get the pointer to the transfer request.  */
     slave_transfer_request =  &slave_endpoint -> ux_slave_endpoint_transfer_request;
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+
+    /* If requests are queued, serve the queue head.  */
+    queued =  UX_FALSE;
+    if (slave_endpoint -> ux_slave_endpoint_transfer_queue_head != UX_NULL)
+    {
+        slave_transfer_request =  slave_endpoint -> ux_slave_endpoint_transfer_queue_head;
+        queued =  UX_TRUE;
+    }
+#endif
+
     /* Check the phase for this transfer, if this is the SETUP phase, treatment is different.  Explanation of how 
        control transfers are handled in the simulator: if the data phase is OUT, we handle it immediately, meaning we 
        send all the data to the device and remove the STATUS TD in the same scheduler call. If the data phase is IN, we 
@@ -491,6 +509,44 @@ UX_SLAVE_DCD            *dcd;
                 }
             }
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT) && !defined(UX_DEVICE_STANDALONE)
+
+            /* A queued request is dequeued and its completion function invoked.  */
+            if ((wake_slave == UX_TRUE) && (queued == UX_TRUE))
+            {
+
+                wake_slave =  UX_FALSE;
+
+                /* Protect the queue, the request may have been aborted meanwhile.  */
+                UX_DISABLE
+                if (slave_transfer_request == slave_endpoint -> ux_slave_endpoint_transfer_queue_head)
+                {
+
+                    /* Dequeue it, the next request is served from the next transaction.  */
+                    slave_endpoint -> ux_slave_endpoint_transfer_queue_head =
+                                    slave_transfer_request -> ux_slave_transfer_request_next_transfer_request;
+                    if (slave_endpoint -> ux_slave_endpoint_transfer_queue_head == UX_NULL)
+                    {
+
+                        /* Clear pending flag.  */
+                        slave_endpoint -> ux_slave_endpoint_transfer_queue_tail =  UX_NULL;
+                        slave_ed -> ux_sim_slave_ed_status &= ~(ULONG)UX_DCD_SIM_SLAVE_ED_STATUS_TRANSFER;
+                    }
+                    slave_transfer_request -> ux_slave_transfer_request_next_transfer_request =  UX_NULL;
+                    slave_transfer_request -> ux_slave_transfer_request_completion_code =  UX_SUCCESS;
+                    slave_transfer_request -> ux_slave_transfer_request_status =  UX_TRANSFER_STATUS_COMPLETED;
+                }
+                else
+                    queued =  UX_FALSE;
+                UX_RESTORE
+
+                /* Invoke the completion function.  */
+                if ((queued == UX_TRUE) &&
+                    (slave_transfer_request -> ux_slave_transfer_request_completion_function != UX_NULL))
+                    slave_transfer_request -> ux_slave_transfer_request_completion_function(slave_transfer_request);
+            }
+#endif
+
             if (wake_slave == UX_TRUE)
             {
 
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_dpump_activate                       PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,7 @@
 /*                                                                        */ 
 /*    _ux_host_class_dpump_configure          Configure dpump class       */ 
 /*    _ux_host_class_dpump_endpoints_get      Get endpoints of dpump      */ 
+/*    _ux_host_stack_class_instance_allocate Allocate class instance      */
 /*    _ux_host_stack_class_instance_create    Create class instance       */ 
 /*    _ux_host_stack_class_instance_destroy   Destroy the class instance  */ 
 /*    _ux_utility_memory_allocate             Allocate memory block       */ 
@@ -82,6 +83,9 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_dpump_activate(UX_HOST_CLASS_COMMAND *command)
@@ -97,7 +101,8 @@ UINT                        status;
     interface_ptr =  (UX_INTERFACE *) command -> ux_host_class_command_container;
 
     /* Obtain memory for this class instance.  */
-    dpump =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_HOST_CLASS_DPUMP));
+    dpump =  _ux_host_stack_class_instance_allocate(command -> ux_host_class_command_class_ptr,
+                    UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_HOST_CLASS_DPUMP));
     if (dpump == UX_NULL)
         return(UX_MEMORY_INSUFFICIENT);
 
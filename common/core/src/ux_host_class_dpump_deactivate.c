@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_dpump_deactivate                     PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_destroy Destroy the class instance    */ 
 /*    _ux_host_stack_endpoint_transfer_abort Abort endpoint transfer      */ 
 /*    _ux_utility_memory_free               Free memory block             */ 
@@ -77,6 +78,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_dpump_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -133,7 +137,7 @@ UINT                        status;
     UX_TRACE_OBJECT_UNREGISTER(dpump);
 
     /* Free the dpump instance memory.  */
-    _ux_utility_memory_free(dpump);
+    _ux_host_stack_class_instance_free(dpump -> ux_host_class_dpump_class, dpump);
 
     /* Return successful status.  */
     return(UX_SUCCESS);         
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_class_call                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -44,6 +44,10 @@
 /*    This function will call all the registered classes to the USBX      */
 /*    stack. Each class will have the possibility to own the device or    */
 /*    one of the interfaces of a device.                                  */ 
+/*                                                                        */
+/*    With UX_HOST_CLASS_MATCH_INDEX_ENABLE, a QUERY is only sent to the  */
+/*    classes whose match list accepts the device or interface, and to    */
+/*    the classes without match list.                                     */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -70,6 +74,9 @@
 /*                                            optimized based on compile  */
 /*                                            definitions,                */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match index,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UX_HOST_CLASS  *_ux_host_stack_class_call(UX_HOST_CLASS_COMMAND *class_command)
@@ -77,8 +84,78 @@ UX_HOST_CLASS  *_ux_host_stack_class_call(UX_HOST_CLASS_COMMAND *class_command)
 
 UINT            status = UX_NO_CLASS_MATCH;
 UX_HOST_CLASS   *class_inst;
-#if UX_MAX_CLASS_DRIVER > 1
+#if UX_MAX_CLASS_DRIVER > 1 || defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
 ULONG           class_index;
+#endif
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+const UX_HOST_CLASS_MATCH   *match;
+ULONG           candidates;
+UINT            usage;
+UINT            key;
+#endif
+
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+
+    /* Get the classes that may own the device or interface from the match index.  */
+    usage =  class_command -> ux_host_class_command_usage;
+    if ((class_command -> ux_host_class_command_request == UX_HOST_CLASS_COMMAND_QUERY) &&
+        (usage >= UX_HOST_CLASS_COMMAND_USAGE_PIDVID) && (usage <= UX_HOST_CLASS_COMMAND_USAGE_DCSP))
+    {
+
+        /* PID/VID matches are indexed by VID, the others by class code.  */
+        if (usage == UX_HOST_CLASS_COMMAND_USAGE_PIDVID)
+            key =  class_command -> ux_host_class_command_vid;
+        else
+            key =  class_command -> ux_host_class_command_class;
+        candidates =  _ux_system_host -> ux_system_host_class_match_any |
+                      _ux_system_host -> ux_system_host_class_match_index[usage - 1][UX_HOST_CLASS_MATCH_INDEX_HASH(key)];
+
+        /* Parse the candidates in registration order, as a scan would do.  */
+        class_inst =  _ux_system_host -> ux_system_host_class_array;
+        for (class_index = 0; candidates != 0; class_index++, candidates >>= 1)
+        {
+
+            if ((candidates & 1) == 0)
+                continue;
+
+            /* Check the class match list.  */
+            match =  class_inst[class_index].ux_host_class_match_list;
+            if (match != UX_NULL)
+            {
+                while (match -> ux_host_class_match_usage != 0)
+                {
+                    if ((match -> ux_host_class_match_usage == usage) &&
+                        (!(match -> ux_host_class_match_flags & UX_HOST_CLASS_MATCH_VID) ||
+                            (match -> ux_host_class_match_vid == class_command -> ux_host_class_command_vid)) &&
+                        (!(match -> ux_host_class_match_flags & UX_HOST_CLASS_MATCH_PID) ||
+                            (match -> ux_host_class_match_pid == class_command -> ux_host_class_command_pid)) &&
+                        (!(match -> ux_host_class_match_flags & UX_HOST_CLASS_MATCH_CLASS) ||
+                            (match -> ux_host_class_match_class == class_command -> ux_host_class_command_class)) &&
+                        (!(match -> ux_host_class_match_flags & UX_HOST_CLASS_MATCH_SUBCLASS) ||
+                            (match -> ux_host_class_match_subclass == class_command -> ux_host_class_command_subclass)) &&
+                        (!(match -> ux_host_class_match_flags & UX_HOST_CLASS_MATCH_PROTOCOL) ||
+                            (match -> ux_host_class_match_protocol == class_command -> ux_host_class_command_protocol)))
+                        break;
+                    match ++;
+                }
+
+                /* No entry in the list matches.  */
+                if (match -> ux_host_class_match_usage == 0)
+                    continue;
+            }
+
+            /* The class QUERY makes the final decision.  */
+            if (class_inst[class_index].ux_host_class_status == UX_USED)
+            {
+                status =  class_inst[class_index].ux_host_class_entry_function(class_command);
+                if (status == UX_SUCCESS)
+                    return(&class_inst[class_index]);
+            }
+        }
+
+        /* There is no driver who want to own this class!  */
+        return(UX_NULL);
+    }
 #endif
 
     /* Start from the 1st registered classes with USBX.  */
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_host_stack_class_instance_allocate              PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function allocates a cleared class instance memory for a       */
+/*    class container. The memory is taken from the class instance pool,  */
+/*    which is created on first allocation with                           */
+/*    UX_HOST_CLASS_INSTANCE_POOL_ENTRIES instances of the requested      */
+/*    size. When the pool is exhausted, or the requested size does not    */
+/*    match the pool object size, regular memory allocate is used.        */
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    host_class                            Pointer to class              */ 
+/*    memory_alignment                      Memory alignment required     */ 
+/*    memory_cache_flag                     Memory pool source            */ 
+/*    memory_size_requested                 Number of bytes required      */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Pointer to class instance memory                                    */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_allocate           Allocate memory block         */ 
+/*    _ux_utility_mutex_on                  Start system protection       */ 
+/*    _ux_utility_mutex_off                 End system protection         */ 
+/*    _ux_utility_object_pool_create        Create object pool            */ 
+/*    _ux_utility_object_pool_get           Get object from pool          */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+VOID  *_ux_host_stack_class_instance_allocate(UX_HOST_CLASS *host_class, ULONG memory_alignment,
+                                              ULONG memory_cache_flag, ULONG memory_size_requested)
+{
+
+UX_OBJECT_POOL      *pool;
+
+
+    /* Create the pool on first instance allocation, protected against
+       concurrent creation or deletion by the system mutex.  */
+    _ux_system_mutex_on(&_ux_system -> ux_system_mutex);
+    pool =  host_class -> ux_host_class_instance_pool;
+    if (pool == UX_NULL)
+    {
+        pool =  _ux_utility_object_pool_create(memory_alignment, memory_cache_flag,
+                                    memory_size_requested, UX_HOST_CLASS_INSTANCE_POOL_ENTRIES);
+        host_class -> ux_host_class_instance_pool =  pool;
+    }
+    _ux_system_mutex_off(&_ux_system -> ux_system_mutex);
+
+    /* Get instance from pool if it's for this kind of instance.  */
+    if (pool != UX_NULL &&
+        pool -> ux_object_pool_object_size == memory_size_requested &&
+        pool -> ux_object_pool_memory_alignment == memory_alignment &&
+        pool -> ux_object_pool_memory_cache_flag == memory_cache_flag)
+        return(_ux_utility_object_pool_get(pool));
+
+    /* Allocate from memory pool.  */
+    return(_ux_utility_memory_allocate(memory_alignment, memory_cache_flag, memory_size_requested));
+}
+#endif
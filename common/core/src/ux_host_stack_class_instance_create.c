@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_class_instance_create                PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,7 +57,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    _ux_utility_interrupt_disable         Disable interrupts            */
+/*    _ux_utility_interrupt_restore         Restore interrupts            */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -71,12 +72,20 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class instance table, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_class_instance_create(UX_HOST_CLASS *host_class, VOID *class_instance)
 {
     
 VOID    **current_class_instance;
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+UX_INTERRUPT_SAVE_AREA
+UX_HOST_CLASS_INSTANCE_ENTRY    *table;
+ULONG                           entry_index;
+#endif
     
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_STACK_CLASS_INSTANCE_CREATE, host_class, class_instance, 0, 0, UX_TRACE_HOST_STACK_EVENTS, 0, 0)
@@ -84,6 +93,32 @@ VOID    **current_class_instance;
     /* If trace is enabled, register this object.  */
     UX_TRACE_OBJECT_REGISTER(UX_TRACE_HOST_OBJECT_TYPE_CLASS_INSTANCE, class_instance, 0, 0, 0)
 
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+
+    /* Add the instance to the instance table, one entry is kept free to end the probes.  */
+    table =  _ux_system_host -> ux_system_host_class_instance_table;
+    UX_DISABLE
+    if (_ux_system_host -> ux_system_host_class_instance_table_count < UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1)
+    {
+
+        /* Find a free entry from the hashed one.  */
+        entry_index =  UX_HOST_CLASS_INSTANCE_TABLE_HASH(class_instance);
+        while (table[entry_index].ux_host_class_instance_entry_instance != UX_NULL)
+            entry_index =  (entry_index + 1) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1);
+
+        /* Save the instance and its class, the name is checked on first verify.  */
+        table[entry_index].ux_host_class_instance_entry_class =  host_class;
+        table[entry_index].ux_host_class_instance_entry_name =  UX_NULL;
+        table[entry_index].ux_host_class_instance_entry_instance =  class_instance;
+        _ux_system_host -> ux_system_host_class_instance_table_count ++;
+    }
+    else
+
+        /* The instance can only be found by scan.  */
+        _ux_system_host -> ux_system_host_class_instance_table_overflow ++;
+    UX_RESTORE
+#endif
+
     /* Start with the first class instance attached to the class container.  */
     current_class_instance =  host_class -> ux_host_class_first_instance;
     
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_class_instance_destroy               PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -54,7 +54,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    _ux_utility_interrupt_disable         Disable interrupts            */
+/*    _ux_utility_interrupt_restore         Restore interrupts            */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -68,6 +69,9 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class instance table, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_class_instance_destroy(UX_HOST_CLASS *host_class, VOID *class_instance)
@@ -75,6 +79,13 @@ UINT  _ux_host_stack_class_instance_destroy(UX_HOST_CLASS *host_class, VOID *cla
     
 VOID    **current_class_instance;
 VOID    **next_class_instance;
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+UX_INTERRUPT_SAVE_AREA
+UX_HOST_CLASS_INSTANCE_ENTRY    *table;
+ULONG                           entry_index;
+ULONG                           next_index;
+ULONG                           hash_index;
+#endif
     
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_STACK_CLASS_INSTANCE_DESTROY, host_class, class_instance, 0, 0, UX_TRACE_HOST_STACK_EVENTS, 0, 0)
@@ -82,6 +93,49 @@ VOID    **next_class_instance;
     /* If trace is enabled, register this object.  */
     UX_TRACE_OBJECT_UNREGISTER(class_instance);
 
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+
+    /* Remove the instance from the instance table.  */
+    table =  _ux_system_host -> ux_system_host_class_instance_table;
+    UX_DISABLE
+    entry_index =  UX_HOST_CLASS_INSTANCE_TABLE_HASH(class_instance);
+    while ((table[entry_index].ux_host_class_instance_entry_instance != UX_NULL) &&
+           (table[entry_index].ux_host_class_instance_entry_instance != class_instance))
+        entry_index =  (entry_index + 1) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1);
+    if (table[entry_index].ux_host_class_instance_entry_instance == UX_NULL)
+    {
+
+        /* Not in table, it was an overflow one.  */
+        if (_ux_system_host -> ux_system_host_class_instance_table_overflow)
+            _ux_system_host -> ux_system_host_class_instance_table_overflow --;
+    }
+    else
+    {
+
+        /* Move back the following entries that can take the freed entry, so that
+           probes still end on the first free entry.  */
+        next_index =  entry_index;
+        while (1)
+        {
+            next_index =  (next_index + 1) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1);
+            if (table[next_index].ux_host_class_instance_entry_instance == UX_NULL)
+                break;
+
+            /* Move if the freed entry is between the hashed entry and this one.  */
+            hash_index =  UX_HOST_CLASS_INSTANCE_TABLE_HASH(table[next_index].ux_host_class_instance_entry_instance);
+            if (((next_index - hash_index) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1)) >=
+                ((next_index - entry_index) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1)))
+            {
+                table[entry_index] =  table[next_index];
+                entry_index =  next_index;
+            }
+        }
+        table[entry_index].ux_host_class_instance_entry_instance =  UX_NULL;
+        _ux_system_host -> ux_system_host_class_instance_table_count --;
+    }
+    UX_RESTORE
+#endif
+
     /* Get the pointer to the instance pointed by the instance to destroy.  */
     next_class_instance =  class_instance;
     next_class_instance =  *next_class_instance;
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_host_stack_class_instance_free                  PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function frees a class instance memory allocated by            */
+/*    _ux_host_stack_class_instance_allocate.                             */
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    host_class                            Pointer to class              */ 
+/*    class_instance                        Pointer to class instance     */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_free               Free memory block             */ 
+/*    _ux_utility_mutex_on                  Start system protection       */ 
+/*    _ux_utility_mutex_off                 End system protection         */ 
+/*    _ux_utility_object_pool_delete        Delete object pool            */ 
+/*    _ux_utility_object_pool_put           Put object back to pool       */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+VOID  _ux_host_stack_class_instance_free(UX_HOST_CLASS *host_class, VOID *class_instance)
+{
+
+UX_OBJECT_POOL      *pool;
+
+
+    /* Put back to pool, objects out of pool are freed there.  */
+    pool =  host_class -> ux_host_class_instance_pool;
+    if (pool == UX_NULL)
+    {
+        _ux_utility_memory_free(class_instance);
+        return;
+    }
+    _ux_utility_object_pool_put(pool, class_instance);
+
+    /* The pool of an unregistered class is kept until its last instance is
+       back, delete it now.  */
+    _ux_system_mutex_on(&_ux_system -> ux_system_mutex);
+    if (host_class -> ux_host_class_status == UX_UNUSED &&
+        host_class -> ux_host_class_instance_pool == pool &&
+        pool -> ux_object_pool_available == pool -> ux_object_pool_object_count)
+    {
+        _ux_utility_object_pool_delete(pool);
+        host_class -> ux_host_class_instance_pool =  UX_NULL;
+    }
+    _ux_system_mutex_off(&_ux_system -> ux_system_mutex);
+}
+#endif
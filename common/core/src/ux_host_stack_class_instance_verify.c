@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_class_instance_verify                PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -45,6 +45,11 @@
 /*    is not responsible for keeping the instance valid pointer. The      */ 
 /*    class is responsible for the instance checks if the instance is     */ 
 /*    still valid.                                                        */ 
+/*                                                                        */
+/*    With UX_HOST_CLASS_INSTANCE_TABLE_ENABLE, the instance is found in  */
+/*    the instance table and the class name is compared only on first     */
+/*    verify with a given name pointer. Instances not in the table are    */
+/*    found by scan.                                                      */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -60,6 +65,8 @@
 /*    _ux_utility_string_length_check       Check C string and return its */
 /*                                          length if null-terminated     */
 /*    _ux_utility_memory_compare            Compare blocks of memory      */ 
+/*    _ux_utility_interrupt_disable         Disable interrupts            */
+/*    _ux_utility_interrupt_restore         Restore interrupts            */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -74,6 +81,9 @@
 /*                                            optimized based on compile  */
 /*                                            definitions,                */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class instance table, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_class_instance_verify(UCHAR *class_name, VOID *class_instance)
@@ -88,6 +98,70 @@ VOID            **current_class_instance;
 UINT            status;
 UINT            class_name_length =  0;
 #endif
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+UX_INTERRUPT_SAVE_AREA
+UX_HOST_CLASS_INSTANCE_ENTRY    *table;
+ULONG                           entry_index;
+UCHAR                           *entry_name;
+#endif
+
+#if defined(UX_HOST_CLASS_INSTANCE_TABLE_ENABLE)
+
+    /* Look for the instance in the instance table.  */
+    table =  _ux_system_host -> ux_system_host_class_instance_table;
+    class_inst =  UX_NULL;
+    entry_name =  UX_NULL;
+    UX_DISABLE
+    entry_index =  UX_HOST_CLASS_INSTANCE_TABLE_HASH(class_instance);
+    while (table[entry_index].ux_host_class_instance_entry_instance != UX_NULL)
+    {
+        if (table[entry_index].ux_host_class_instance_entry_instance == class_instance)
+        {
+            class_inst =  table[entry_index].ux_host_class_instance_entry_class;
+            entry_name =  table[entry_index].ux_host_class_instance_entry_name;
+            break;
+        }
+        entry_index =  (entry_index + 1) & (UX_HOST_CLASS_INSTANCE_TABLE_SIZE - 1);
+    }
+    UX_RESTORE
+
+    if (class_inst != UX_NULL && class_inst -> ux_host_class_status == UX_USED)
+    {
+
+        /* Same class name pointer as the one already checked, no compare.  */
+        if (entry_name == class_name)
+            return(UX_SUCCESS);
+
+#if !defined(UX_NAME_REFERENCED_BY_POINTER)
+        /* Get the length of the class name (exclude null-terminator).  */
+        status =  _ux_utility_string_length_check(class_name, &class_name_length, UX_MAX_CLASS_NAME_LENGTH);
+        if (status)
+            return(status);
+#endif
+
+        /* Check the class name (compare including null-terminator).  */
+        if (ux_utility_name_match(class_inst -> ux_host_class_name, class_name, class_name_length + 1))
+        {
+
+            /* Keep the name pointer for next verify, if the entry is not moved.  */
+            UX_DISABLE
+            if (table[entry_index].ux_host_class_instance_entry_instance == class_instance)
+                table[entry_index].ux_host_class_instance_entry_name =  class_name;
+            UX_RESTORE
+            return(UX_SUCCESS);
+        }
+    }
+
+    /* Not found, only instances not in table need scan.  */
+    if (class_inst != UX_NULL || _ux_system_host -> ux_system_host_class_instance_table_overflow == 0)
+    {
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        UX_TRACE_IN_LINE_INSERT(UX_TRACE_ERROR, UX_HOST_CLASS_INSTANCE_UNKNOWN, class_instance, 0, 0, UX_TRACE_ERRORS, 0, 0)
+
+        return(UX_HOST_CLASS_INSTANCE_UNKNOWN);
+    }
+#endif
 
 #if !defined(UX_NAME_REFERENCED_BY_POINTER)
     /* Get the length of the class name (exclude null-terminator).  */
@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_class_match_index_build              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds the class match index from the match lists     */
+/*    of the registered classes. For each usage (PID/VID, CSP and DCSP)   */
+/*    the index keeps a bitmap of classes per VID or class code hash.     */
+/*    Classes without match list are in the "any" bitmap, match entries   */
+/*    without VID or class code are put in all the buckets of the usage.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_set                Set memory block              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host Stack                                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_class_match_index_build(VOID)
+{
+
+UX_HOST_CLASS               *class_inst;
+const UX_HOST_CLASS_MATCH   *match;
+ULONG                       class_index;
+ULONG                       class_bit;
+ULONG                       *buckets;
+UINT                        usage;
+UINT                        key;
+UINT                        key_flag;
+UINT                        bucket;
+
+
+    /* Reset the index.  */
+    _ux_system_host -> ux_system_host_class_match_any =  0;
+    _ux_utility_memory_set(_ux_system_host -> ux_system_host_class_match_index, 0,
+                           sizeof(_ux_system_host -> ux_system_host_class_match_index)); /* Use case of memset is verified. */
+
+    /* Add all used classes, the bit number is the class index.  */
+    class_inst =  _ux_system_host -> ux_system_host_class_array;
+    for (class_index = 0; class_index < UX_SYSTEM_HOST_MAX_CLASS_GET(); class_index++, class_inst++)
+    {
+
+        if (class_inst -> ux_host_class_status != UX_USED)
+            continue;
+        class_bit =  (ULONG)1u << class_index;
+
+        /* A class without match list is queried for all.  */
+        match =  class_inst -> ux_host_class_match_list;
+        if (match == UX_NULL)
+        {
+            _ux_system_host -> ux_system_host_class_match_any |=  class_bit;
+            continue;
+        }
+
+        /* Add each entry of the list.  */
+        for (; match -> ux_host_class_match_usage != 0; match++)
+        {
+
+            usage =  match -> ux_host_class_match_usage;
+            if (usage > UX_HOST_CLASS_COMMAND_USAGE_DCSP)
+                continue;
+            buckets =  _ux_system_host -> ux_system_host_class_match_index[usage - 1];
+
+            /* PID/VID entries are indexed by VID, the others by class code.  */
+            if (usage == UX_HOST_CLASS_COMMAND_USAGE_PIDVID)
+            {
+                key =  match -> ux_host_class_match_vid;
+                key_flag =  UX_HOST_CLASS_MATCH_VID;
+            }
+            else
+            {
+                key =  match -> ux_host_class_match_class;
+                key_flag =  UX_HOST_CLASS_MATCH_CLASS;
+            }
+
+            if (match -> ux_host_class_match_flags & key_flag)
+                buckets[UX_HOST_CLASS_MATCH_INDEX_HASH(key)] |=  class_bit;
+            else
+            {
+
+                /* Any key, put in all buckets.  */
+                for (bucket = 0; bucket < UX_HOST_CLASS_MATCH_INDEX_BUCKETS; bucket++)
+                    buckets[bucket] |=  class_bit;
+            }
+        }
+    }
+}
+#endif
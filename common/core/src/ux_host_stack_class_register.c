@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_stack_class_register                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -48,6 +48,7 @@
 /*                  UX_HOST_CLASS_COMMAND_QUERY                           */
 /*                  UX_HOST_CLASS_COMMAND_ACTIVATE                        */
 /*                  UX_HOST_CLASS_COMMAND_DESTROY                         */
+/*                  UX_HOST_CLASS_COMMAND_MATCH_GET                       */
 /*                                                                        */
 /*    Note: The C string of class_name must be NULL-terminated and the    */
 /*    length of it (without the NULL-terminator itself) must be no larger */
@@ -67,6 +68,9 @@
 /*    _ux_utility_string_length_check       Check C string and return     */
 /*                                          length if null-terminated     */
 /*    _ux_utility_memory_copy               Copy memory block             */
+/*    (class_entry_function)                Entry function of the class   */
+/*    _ux_host_stack_class_match_index_build                              */
+/*                                          Build class match index       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -83,6 +87,11 @@
 /*                                            definitions, verified       */
 /*                                            memset and memcpy cases,    */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match index,    */
+/*                                            skipped containers holding  */
+/*                                            an instance pool,           */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_class_register(UCHAR *class_name,
@@ -90,6 +99,9 @@ UINT  _ux_host_stack_class_register(UCHAR *class_name,
 {
 
 UX_HOST_CLASS       *class_inst;
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+UX_HOST_CLASS_COMMAND   class_command;
+#endif
 #if !defined(UX_NAME_REFERENCED_BY_POINTER)
 UINT                status;
 UINT                class_name_length =  0;
@@ -117,6 +129,19 @@ ULONG               class_index;
     {
 #endif
 
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+
+        /* An unregistered class keeps its instance pool until all its instances
+           are freed, the container is not free until then.  */
+        if ((class_inst -> ux_host_class_status == UX_UNUSED) &&
+            (class_inst -> ux_host_class_instance_pool != UX_NULL))
+        {
+
+            /* Skip this container.  */
+        }
+        else
+#endif
+
         /* Check if this class is already used.  */
         if (class_inst -> ux_host_class_status == UX_UNUSED)
         {
@@ -135,6 +160,21 @@ ULONG               class_index;
             /* Mark it as used.  */
             class_inst -> ux_host_class_status =  UX_USED;
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+
+            /* Get the match list of the class, a class without list is queried for all.  */
+            class_command.ux_host_class_command_request =  UX_HOST_CLASS_COMMAND_MATCH_GET;
+            class_command.ux_host_class_command_container =  UX_NULL;
+            class_command.ux_host_class_command_class_ptr =  class_inst;
+            if (class_entry_function(&class_command) == UX_SUCCESS)
+                class_inst -> ux_host_class_match_list =  (const UX_HOST_CLASS_MATCH *)class_command.ux_host_class_command_container;
+            else
+                class_inst -> ux_host_class_match_list =  UX_NULL;
+
+            /* Add the class to the match index.  */
+            _ux_host_stack_class_match_index_build();
+#endif
+
             /* Return successful completion.  */
             return(UX_SUCCESS);
         }
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_stack_class_unregister                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,6 +60,11 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    (class_entry_function)                Entry function of the class   */
+/*    _ux_utility_mutex_on                  Start system protection       */
+/*    _ux_utility_mutex_off                 End system protection         */
+/*    _ux_utility_object_pool_delete        Delete object pool            */
+/*    _ux_host_stack_class_match_index_build                              */
+/*                                          Build class match index       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -71,6 +76,10 @@
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  09-30-2020     Chaoqiong Xiao           Initial Version 6.1           */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            deleted instance pool,      */
+/*                                            added class match index,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_class_unregister(UINT (*class_entry_function)(struct UX_HOST_CLASS_COMMAND_STRUCT *))
@@ -80,6 +89,9 @@ UX_HOST_CLASS           *class_inst;
 UX_HOST_CLASS_COMMAND   class_command;
 #if UX_MAX_CLASS_DRIVER > 1
 ULONG                   class_index;
+#endif
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+UX_OBJECT_POOL          *pool;
 #endif
 
 
@@ -106,9 +118,37 @@ ULONG                   class_index;
             /* Invoke command for class destroy.  */
             class_inst -> ux_host_class_entry_function(&class_command);
 
+#if defined(UX_HOST_CLASS_INSTANCE_POOL_ENTRIES)
+
+            /* Delete the instance pool if no instance is in use. Otherwise
+               instances of devices still attached live in the pool, it is
+               deleted when the last one is freed.  */
+            _ux_system_mutex_on(&_ux_system -> ux_system_mutex);
+            pool =  class_inst -> ux_host_class_instance_pool;
+            if (pool != UX_NULL &&
+                pool -> ux_object_pool_available == pool -> ux_object_pool_object_count)
+            {
+                _ux_utility_object_pool_delete(pool);
+                class_inst -> ux_host_class_instance_pool =  UX_NULL;
+            }
+
             /* Mark as free.  */
             class_inst -> ux_host_class_entry_function = UX_NULL;
             class_inst -> ux_host_class_status = UX_UNUSED;
+            _ux_system_mutex_off(&_ux_system -> ux_system_mutex);
+#else
+
+            /* Mark as free.  */
+            class_inst -> ux_host_class_entry_function = UX_NULL;
+            class_inst -> ux_host_class_status = UX_UNUSED;
+#endif
+
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+
+            /* Remove the class from the match index.  */
+            class_inst -> ux_host_class_match_list =  UX_NULL;
+            _ux_host_stack_class_match_index_build();
+#endif
 
             /* Class unregistered success.  */
             return(UX_SUCCESS);
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_bind                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function binds a transfer request to a completion queue, or    */
+/*    unbinds it if the queue is NULL. When a bound request completes,    */
+/*    its completion function is called and the request is put in the     */
+/*    queue. The completion function must be set before binding.          */
+/*                                                                        */
+/*    When a request is unbound, its completion function is restored and  */
+/*    it is removed from the queue if it is still there. A request should */
+/*    not be pending when bound or unbound.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_transfer_timer_stop    Stop transfer timer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*    USBX Components                                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_completion_queue_bind(UX_TRANSFER *transfer_request, UX_HOST_COMPLETION_QUEUE *queue)
+{
+#if !defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+    UX_PARAMETER_NOT_USED(transfer_request);
+    UX_PARAMETER_NOT_USED(queue);
+
+    /* Completion queue is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_COMPLETION_QUEUE    *bound_queue;
+UX_TRANSFER                 *previous;
+
+
+    UX_DISABLE
+
+    /* Unbind from the current queue.  */
+    bound_queue =  transfer_request -> ux_transfer_request_completion_queue;
+    if (bound_queue != UX_NULL)
+    {
+
+        /* Remove the request from the queue.  */
+        if (transfer_request -> ux_transfer_request_completion_queued)
+        {
+            previous =  UX_NULL;
+            if (bound_queue -> ux_host_completion_queue_head != transfer_request)
+            {
+                previous =  bound_queue -> ux_host_completion_queue_head;
+                while (previous -> ux_transfer_request_next_completed != transfer_request)
+                    previous =  previous -> ux_transfer_request_next_completed;
+            }
+            if (previous == UX_NULL)
+                bound_queue -> ux_host_completion_queue_head =  transfer_request -> ux_transfer_request_next_completed;
+            else
+                previous -> ux_transfer_request_next_completed =  transfer_request -> ux_transfer_request_next_completed;
+            if (bound_queue -> ux_host_completion_queue_tail == transfer_request)
+                bound_queue -> ux_host_completion_queue_tail =  previous;
+            transfer_request -> ux_transfer_request_completion_queued =  UX_FALSE;
+        }
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+        /* Stop the timeout.  */
+        _ux_host_stack_transfer_timer_stop(transfer_request);
+#endif
+
+        /* Restore the completion function.  */
+        transfer_request -> ux_transfer_request_completion_function =
+                            transfer_request -> ux_transfer_request_queue_completion_function;
+        transfer_request -> ux_transfer_request_completion_queue =  UX_NULL;
+        bound_queue -> ux_host_completion_queue_bound --;
+    }
+
+    /* Bind to the new queue.  */
+    if (queue != UX_NULL)
+    {
+        transfer_request -> ux_transfer_request_queue_completion_function =
+                            transfer_request -> ux_transfer_request_completion_function;
+        transfer_request -> ux_transfer_request_completion_function =  _ux_host_stack_completion_queue_transfer_done;
+        transfer_request -> ux_transfer_request_completion_queued =  UX_FALSE;
+        transfer_request -> ux_transfer_request_completion_queue =  queue;
+        queue -> ux_host_completion_queue_bound ++;
+    }
+
+    UX_RESTORE
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_completion_queue_bind               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack completion queue bind     */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_bind  Bind to completion queue      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_completion_queue_bind(UX_TRANSFER *transfer_request, UX_HOST_COMPLETION_QUEUE *queue)
+{
+
+    /* Sanity check.  */
+    if (transfer_request == UX_NULL)
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke completion queue bind function.  */
+    return(_ux_host_stack_completion_queue_bind(transfer_request, queue));
+}
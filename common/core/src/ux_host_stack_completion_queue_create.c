@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_create              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a transfer completion queue. Transfer         */
+/*    requests bound to the queue by                                      */
+/*    _ux_host_stack_completion_queue_bind are put in the queue when      */
+/*    they complete, and are taken out by                                 */
+/*    _ux_host_stack_completion_queue_get.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_event_flags_create           Create event flags group      */
+/*    _ux_utility_memory_set                Set memory block              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_completion_queue_create(UX_HOST_COMPLETION_QUEUE *queue)
+{
+#if !defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+    UX_PARAMETER_NOT_USED(queue);
+
+    /* Completion queue is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UINT    status;
+
+
+    /* Reset the queue.  */
+    _ux_utility_memory_set(queue, 0, sizeof(UX_HOST_COMPLETION_QUEUE)); /* Use case of memset is verified. */
+
+    /* Create the event flags group the queue waiters are blocked on.  */
+    status =  _ux_host_event_flags_create(&queue -> ux_host_completion_queue_event_flags_group,
+                                          "ux_host_completion_queue_event_flags_group");
+    if (status != UX_SUCCESS)
+        return(UX_EVENT_ERROR);
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_completion_queue_create             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack completion queue create   */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_create                              */
+/*                                          Create completion queue       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_completion_queue_create(UX_HOST_COMPLETION_QUEUE *queue)
+{
+
+    /* Sanity check.  */
+    if (queue == UX_NULL)
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke completion queue create function.  */
+    return(_ux_host_stack_completion_queue_create(queue));
+}
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_delete              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes a transfer completion queue. All transfer     */
+/*    requests must be unbound from the queue before.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_event_flags_delete           Delete event flags group      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_completion_queue_delete(UX_HOST_COMPLETION_QUEUE *queue)
+{
+#if !defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+    UX_PARAMETER_NOT_USED(queue);
+
+    /* Completion queue is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+    /* Transfer requests still refer to the queue.  */
+    if (queue -> ux_host_completion_queue_bound != 0)
+        return(UX_ERROR);
+
+#if !defined(UX_HOST_STANDALONE)
+
+    /* Delete the event flags group.  */
+    _ux_host_event_flags_delete(&queue -> ux_host_completion_queue_event_flags_group);
+#endif
+
+    /* Reset the queue.  */
+    queue -> ux_host_completion_queue_head =  UX_NULL;
+    queue -> ux_host_completion_queue_tail =  UX_NULL;
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_completion_queue_delete             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack completion queue delete   */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_delete                              */
+/*                                          Delete completion queue       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_completion_queue_delete(UX_HOST_COMPLETION_QUEUE *queue)
+{
+
+    /* Sanity check.  */
+    if (queue == UX_NULL)
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke completion queue delete function.  */
+    return(_ux_host_stack_completion_queue_delete(queue));
+}
@@ -0,0 +1,258 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_get                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes up to max_transfers completed transfer          */
+/*    requests from a completion queue, in completion order. If the queue */
+/*    is empty it waits for a completion, up to wait_option ticks.        */
+/*    UX_NO_WAIT polls the queue, UX_WAIT_FOREVER waits without timeout.  */
+/*                                                                        */
+/*    In standalone mode, the host tasks are run while waiting.           */
+/*    Otherwise, when the host timer wheel is enabled, it is run while    */
+/*    waiting to expire the transfer timeouts.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*    transfer_requests                     Array to fill with requests   */
+/*    max_transfers                         Size of the array             */
+/*    actual_transfers                      Number of requests returned   */
+/*    wait_option                           Wait option (ticks)           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_event_flags_get              Get event flags               */
+/*    _ux_host_stack_timer_wheel_run        Run host timer wheel          */
+/*    _ux_system_host_tasks_run             Run host tasks                */
+/*    _ux_utility_time_elapsed              Get elapsed time              */
+/*    _ux_utility_time_get                  Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*    USBX Components                                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_completion_queue_get(UX_HOST_COMPLETION_QUEUE *queue, UX_TRANSFER **transfer_requests,
+                                    ULONG max_transfers, ULONG *actual_transfers, ULONG wait_option)
+{
+#if !defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+    UX_PARAMETER_NOT_USED(queue);
+    UX_PARAMETER_NOT_USED(transfer_requests);
+    UX_PARAMETER_NOT_USED(max_transfers);
+    UX_PARAMETER_NOT_USED(wait_option);
+
+    /* Completion queue is not enabled.  */
+    *actual_transfers =  0;
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_TRANSFER     *transfer_request;
+ULONG           count;
+#if !defined(UX_HOST_STANDALONE)
+UINT            status;
+ULONG           actual_flags;
+ULONG           wait_ticks;
+#endif
+#if defined(UX_HOST_STANDALONE) || defined(UX_HOST_TIMER_WHEEL_ENABLE)
+ULONG           time_start;
+#endif
+#if !defined(UX_HOST_STANDALONE) && defined(UX_HOST_TIMER_WHEEL_ENABLE)
+ULONG           time_elapsed;
+#endif
+
+
+#if defined(UX_HOST_STANDALONE) || defined(UX_HOST_TIMER_WHEEL_ENABLE)
+    time_start =  _ux_utility_time_get();
+#endif
+
+    while(1)
+    {
+#if !defined(UX_HOST_STANDALONE) && defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+        /* Expire transfer timeouts, aborted requests are put in their queues.  */
+        _ux_host_stack_timer_wheel_run();
+#endif
+
+        /* Take the completed requests.  */
+        count =  0;
+        UX_DISABLE
+        while ((count < max_transfers) && (queue -> ux_host_completion_queue_head != UX_NULL))
+        {
+            transfer_request =  queue -> ux_host_completion_queue_head;
+            queue -> ux_host_completion_queue_head =  transfer_request -> ux_transfer_request_next_completed;
+            transfer_request -> ux_transfer_request_completion_queued =  UX_FALSE;
+            transfer_requests[count ++] =  transfer_request;
+        }
+        if (queue -> ux_host_completion_queue_head == UX_NULL)
+            queue -> ux_host_completion_queue_tail =  UX_NULL;
+        UX_RESTORE
+
+        if (count != 0)
+        {
+            *actual_transfers =  count;
+            return(UX_SUCCESS);
+        }
+
+        /* Nothing completed, poll mode.  */
+        if (wait_option == UX_NO_WAIT)
+            break;
+
+#if !defined(UX_HOST_STANDALONE)
+        wait_ticks =  wait_option;
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+        /* Check timeout.  */
+        if (wait_option != UX_WAIT_FOREVER)
+        {
+            time_elapsed =  _ux_utility_time_elapsed(time_start, _ux_utility_time_get());
+            if (time_elapsed >= wait_option)
+                break;
+            wait_ticks =  wait_option - time_elapsed;
+        }
+
+        /* While transfer timeouts are armed, wake up on each first level turn
+           of the timer wheel to run it.  */
+        if ((_ux_system_host -> ux_system_host_timer_wheel.ux_host_timer_wheel_armed != 0) &&
+            (wait_ticks > UX_HOST_TIMER_WHEEL_SLOTS))
+            wait_ticks =  UX_HOST_TIMER_WHEEL_SLOTS;
+#endif
+
+        /* Wait for the queue to be filled. The event may be left from requests already
+           taken, in this case the queue is checked and waited again.  */
+        status =  _ux_host_event_flags_get(&queue -> ux_host_completion_queue_event_flags_group,
+                                           UX_HOST_COMPLETION_QUEUE_EVENT, UX_OR_CLEAR,
+                                           &actual_flags, wait_ticks);
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+        /* On timeout, the total wait time is checked in next loop.  */
+        if ((status != UX_SUCCESS) && (status != UX_NO_EVENTS))
+            break;
+#else
+        if (status != UX_SUCCESS)
+            break;
+#endif
+#else
+
+        /* Check timeout.  */
+        if ((wait_option != UX_WAIT_FOREVER) &&
+            (_ux_utility_time_elapsed(time_start, _ux_utility_time_get()) >= wait_option))
+            break;
+
+        /* Run host tasks to complete transfers.  */
+        _ux_system_host_tasks_run();
+#endif
+    }
+
+    /* No completed request.  */
+    *actual_transfers =  0;
+    return(UX_NO_EVENTS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_completion_queue_get                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack completion queue get      */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue                                 Pointer to completion queue   */
+/*    transfer_requests                     Array to fill with requests   */
+/*    max_transfers                         Size of the array             */
+/*    actual_transfers                      Number of requests returned   */
+/*    wait_option                           Wait option (ticks)           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_get   Get completed requests        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_completion_queue_get(UX_HOST_COMPLETION_QUEUE *queue, UX_TRANSFER **transfer_requests,
+                                    ULONG max_transfers, ULONG *actual_transfers, ULONG wait_option)
+{
+
+    /* Sanity checks.  */
+    if ((queue == UX_NULL) || (transfer_requests == UX_NULL) ||
+        (max_transfers == 0) || (actual_transfers == UX_NULL))
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke completion queue get function.  */
+    return(_ux_host_stack_completion_queue_get(queue, transfer_requests, max_transfers, actual_transfers, wait_option));
+}
@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_completion_queue_transfer_done       PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the completion function of transfer requests       */
+/*    bound to a completion queue. It calls the completion function the   */
+/*    transfer request had when bound, then appends the request to the    */
+/*    queue and wakes up the waiting thread if the queue was empty.       */
+/*                                                                        */
+/*    A request completed again before being taken from the queue stays   */
+/*    in the queue once.                                                  */
+/*                                                                        */
+/*    The transfer timeout armed in the timer wheel is stopped. A request */
+/*    aborted on timeout by the wheel is completed with                   */
+/*    UX_TRANSFER_TIMEOUT.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (ux_transfer_request_queue_completion_function)                     */
+/*                                          Transfer completion function  */
+/*    _ux_host_event_flags_set              Set event flags               */
+/*    _ux_host_stack_transfer_timer_stop    Stop transfer timer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    HCD                                                                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_completion_queue_transfer_done(UX_TRANSFER *transfer_request)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_COMPLETION_QUEUE    *queue;
+UINT                        queue_was_empty =  UX_FALSE;
+
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+    /* Stop the timeout. A request aborted by the timer wheel completes with timeout.  */
+    if ((transfer_request -> ux_transfer_request_timer_state == UX_HOST_TIMER_WHEEL_EXPIRED) &&
+        (transfer_request -> ux_transfer_request_completion_code == UX_TRANSFER_STATUS_ABORT))
+        transfer_request -> ux_transfer_request_completion_code =  UX_TRANSFER_TIMEOUT;
+    _ux_host_stack_transfer_timer_stop(transfer_request);
+#endif
+
+    /* Call the completion function of the transfer request owner.  */
+    if (transfer_request -> ux_transfer_request_queue_completion_function != UX_NULL)
+        transfer_request -> ux_transfer_request_queue_completion_function(transfer_request);
+
+    /* Append the request to the queue.  */
+    UX_DISABLE
+    queue =  transfer_request -> ux_transfer_request_completion_queue;
+    if ((queue != UX_NULL) && (transfer_request -> ux_transfer_request_completion_queued == UX_FALSE))
+    {
+        transfer_request -> ux_transfer_request_completion_queued =  UX_TRUE;
+        transfer_request -> ux_transfer_request_next_completed =  UX_NULL;
+        if (queue -> ux_host_completion_queue_tail != UX_NULL)
+            queue -> ux_host_completion_queue_tail -> ux_transfer_request_next_completed =  transfer_request;
+        else
+        {
+            queue -> ux_host_completion_queue_head =  transfer_request;
+            queue_was_empty =  UX_TRUE;
+        }
+        queue -> ux_host_completion_queue_tail =  transfer_request;
+    }
+    UX_RESTORE
+
+    /* Wake up the waiting thread.  */
+    if (queue_was_empty)
+        _ux_host_event_flags_set(&queue -> ux_host_completion_queue_event_flags_group,
+                                 UX_HOST_COMPLETION_QUEUE_EVENT, UX_OR);
+}
+#endif
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_configuration_descriptor_parse       PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -59,6 +59,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_descriptor_cache_save  Save to descriptor cache      */
 /*    _ux_host_stack_interfaces_scan        Scan host interfaces          */ 
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
 /*    _ux_utility_memory_allocate           Allocate block of memory      */
@@ -75,6 +76,10 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added descriptor cache      */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_configuration_descriptor_parse(UX_DEVICE *device, UX_CONFIGURATION *configuration,
@@ -127,6 +132,15 @@ ULONG           total_configuration_length;
                the interface(s) descriptors, all alternate settings, endpoints
                and descriptor specific to the class. The descriptor is parsed for all interfaces.  */
             status =  _ux_host_stack_interfaces_scan(configuration, descriptor);
+
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+            /* Save the descriptor so that next time the device is attached,
+               its configurations are built without reading it.  */
+            if (status == UX_SUCCESS)
+                _ux_host_stack_descriptor_cache_save(device, configuration_index,
+                                            descriptor, total_configuration_length);
+#endif
         }
     }
 
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_configuration_enumerate              PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -63,6 +63,9 @@
 /*                                          Parse configuration descriptor*/ 
 /*    _ux_host_stack_configuration_instance_delete                        */ 
 /*                                          Delete configuration instance */ 
+/*    _ux_host_stack_descriptor_cache_lookup                              */
+/*                                          Look up descriptor cache      */
+/*    _ux_host_stack_interfaces_scan        Scan host interfaces          */
 /*    _ux_host_stack_new_configuration_create                             */ 
 /*                                          Create new configuration      */ 
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
@@ -81,6 +84,10 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added descriptor cache      */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_configuration_enumerate(UX_DEVICE *device)
@@ -101,6 +108,52 @@ ULONG               configuration_index;
     control_endpoint =  &device -> ux_device_control_endpoint;
     transfer_request =  &control_endpoint -> ux_endpoint_transfer_request;
 
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+    /* The configurations of a known device are built from the descriptor cache,
+       without reading the descriptors from the device.  */
+    if (_ux_host_stack_descriptor_cache_lookup(device, &descriptor) == UX_SUCCESS)
+    {
+
+        /* Parse all the configurations attached to the device.  */
+        nb_configurations =  device -> ux_device_descriptor.bNumConfigurations;
+        for (configuration_index = 0; configuration_index < nb_configurations; configuration_index++)
+        {
+
+            /* Allocate some memory for the container of this descriptor.  */
+            configuration =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_CONFIGURATION));
+            if (configuration == UX_NULL)
+                return(UX_MEMORY_INSUFFICIENT);
+
+            /* This configuration must be linked to the device.  */
+            _ux_host_stack_new_configuration_create(device, configuration);
+
+            /* The descriptor is in a packed format, parse it locally.  */
+            _ux_utility_descriptor_parse(descriptor, _ux_system_configuration_descriptor_structure,
+                                UX_CONFIGURATION_DESCRIPTOR_ENTRIES, (UCHAR *) &configuration -> ux_configuration_descriptor);
+
+            /* Parse the interfaces and endpoints of this configuration.  */
+            status =  _ux_host_stack_interfaces_scan(configuration, descriptor);
+
+            /* Check the completion status.  */
+            if (status != UX_SUCCESS)
+            {
+                /* Error, delete the configuration instance.  */
+                _ux_host_stack_configuration_instance_delete(configuration);
+
+                /* Stop at the first error, as when descriptors are read.  */
+                return(status);
+            }
+
+            /* Next configuration.  */
+            descriptor +=  configuration -> ux_configuration_descriptor.wTotalLength;
+        }
+
+        /* Return completion status.  */
+        return(status);
+    }
+#endif
+
     /* Need to allocate memory for the configuration descriptor the first time we read 
        only the configuration descriptor when we have the configuration descriptor, we have 
        the length of the entire configuration\interface\endpoint descriptors.  */
@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_descriptor_cache_flush               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes all devices from the descriptor cache, so     */
+/*    the descriptors of next attached devices are read from the devices. */
+/*    It can be used after a firmware update that does not change the     */
+/*    device descriptor. The hit and miss counters are not changed.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_free               Free memory block             */
+/*    _ux_utility_memory_set                Set memory block              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*    Host Stack                                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_descriptor_cache_flush(VOID)
+{
+#if !defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) || defined(UX_HOST_STANDALONE)
+
+    /* Descriptor cache is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UX_HOST_DESCRIPTOR_CACHE_ENTRY  *entry;
+UINT                            entry_index;
+
+
+    /* Free the configurations of all entries.  */
+    for (entry_index = 0; entry_index < UX_HOST_DESCRIPTOR_CACHE_ENTRIES; entry_index++)
+    {
+        entry =  &_ux_system_host -> ux_system_host_descriptor_cache[entry_index];
+        if (entry -> ux_host_descriptor_cache_entry_configurations != UX_NULL)
+            _ux_utility_memory_free(entry -> ux_host_descriptor_cache_entry_configurations);
+    }
+
+    /* Reset all entries.  */
+    _ux_utility_memory_set(_ux_system_host -> ux_system_host_descriptor_cache, 0,
+                           sizeof(_ux_system_host -> ux_system_host_descriptor_cache)); /* Use case of memset is verified. */
+    _ux_system_host -> ux_system_host_descriptor_cache_use =  0;
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
@@ -0,0 +1,289 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+static inline VOID _ux_host_stack_descriptor_cache_entry_reserve(UX_HOST_DESCRIPTOR_CACHE_ENTRY *cache_entry,
+                                UX_DEVICE *device, UCHAR *serial, ULONG serial_length, ULONG langid);
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_descriptor_cache_lookup              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function looks for a device in the descriptor cache. A device  */
+/*    is known if its device descriptor and its serial number string are  */
+/*    the same as the ones of a complete cache entry, the descriptor      */
+/*    includes VID, PID and bcdDevice.                                    */
+/*                                                                        */
+/*    The serial number string is read, in the first language of the     */
+/*    device, only if the device has one and an entry of the same device  */
+/*    descriptor is cached. The first entry of a model is kept without    */
+/*    serial number, it's read when the model is attached again.          */
+/*                                                                        */
+/*    On hit, the configuration descriptors of the device, stored one     */
+/*    after the other, are returned so the configurations are built       */
+/*    without reading them. On miss, the least recently used entry is     */
+/*    reserved for the device and filled by                               */
+/*    _ux_host_stack_descriptor_cache_save while the configurations are   */
+/*    read.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    device                                Pointer to device             */
+/*    configurations                        Destination to fill cached    */
+/*                                            configuration descriptors   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*    UX_SUCCESS is returned on hit only, otherwise the configurations    */
+/*    must be read from the device.                                       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_transfer_request       Process transfer request      */
+/*    _ux_utility_memory_allocate           Allocate memory block         */
+/*    _ux_utility_memory_compare            Compare memory blocks         */
+/*    _ux_utility_memory_copy               Copy memory block             */
+/*    _ux_utility_memory_free               Free memory block             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host Stack                                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_descriptor_cache_lookup(UX_DEVICE *device, UCHAR **configurations)
+{
+
+UX_HOST_DESCRIPTOR_CACHE_ENTRY  *entry;
+UX_HOST_DESCRIPTOR_CACHE_ENTRY  *cache_entry;
+UX_HOST_DESCRIPTOR_CACHE_ENTRY  *model_entry;
+UX_TRANSFER                     *transfer_request;
+UCHAR                           *serial;
+ULONG                           serial_length;
+ULONG                           langid;
+UINT                            status;
+UINT                            entry_index;
+
+
+    /* The device container may be reused, forget any entry it was filling.
+       Look for an entry of the same device descriptor, and for the least
+       recently used entry, unused entries first.  */
+    cache_entry =  UX_NULL;
+    model_entry =  UX_NULL;
+    langid =  0;
+    for (entry_index = 0; entry_index < UX_HOST_DESCRIPTOR_CACHE_ENTRIES; entry_index++)
+    {
+        entry =  &_ux_system_host -> ux_system_host_descriptor_cache[entry_index];
+        if (entry -> ux_host_descriptor_cache_entry_device == device)
+            entry -> ux_host_descriptor_cache_entry_device =  UX_NULL;
+
+        if (cache_entry == UX_NULL ||
+            entry -> ux_host_descriptor_cache_entry_use < cache_entry -> ux_host_descriptor_cache_entry_use)
+            cache_entry =  entry;
+
+        if (entry -> ux_host_descriptor_cache_entry_use != 0 &&
+            _ux_utility_memory_compare(&entry -> ux_host_descriptor_cache_entry_device_descriptor,
+                                       &device -> ux_device_descriptor, sizeof(UX_DEVICE_DESCRIPTOR)) == UX_SUCCESS)
+        {
+
+            /* The entry of the model whose serial number is not read yet is preferred.  */
+            if (model_entry == UX_NULL || entry -> ux_host_descriptor_cache_entry_serial_length == 0)
+                model_entry =  entry;
+
+            /* The model gives the language of the serial number.  */
+            if (entry -> ux_host_descriptor_cache_entry_langid != 0)
+                langid =  entry -> ux_host_descriptor_cache_entry_langid;
+        }
+    }
+
+    /* Without any entry of the same model the device is not known,
+       no serial number is read.  */
+    if (model_entry == UX_NULL)
+    {
+
+        /* Cache miss, the serial number is read if the model is attached again.  */
+        _ux_system_host -> ux_system_host_descriptor_cache_misses++;
+        _ux_host_stack_descriptor_cache_entry_reserve(cache_entry, device, UX_NULL, 0, 0);
+
+        /* The configurations must be read.  */
+        return(UX_ERROR);
+    }
+
+    /* The serial number tells apart devices of a same model.  */
+    serial =  UX_NULL;
+    serial_length =  0;
+    if (device -> ux_device_descriptor.iSerialNumber != 0)
+    {
+
+        /* Need to allocate memory for the string descriptors.  */
+        serial =  _ux_utility_memory_allocate(UX_SAFE_ALIGN, UX_CACHE_SAFE_MEMORY, UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH);
+        if (serial == UX_NULL)
+            return(UX_MEMORY_INSUFFICIENT);
+
+        /* Get the first language of the device, unless it's known for the model.  */
+        transfer_request =  &device -> ux_device_control_endpoint.ux_endpoint_transfer_request;
+        status =  UX_SUCCESS;
+        if (langid == 0)
+        {
+
+            /* Create a transfer_request for the GET_DESCRIPTOR request of string 0.  */
+            transfer_request -> ux_transfer_request_data_pointer =      serial;
+            transfer_request -> ux_transfer_request_requested_length =  4;
+            transfer_request -> ux_transfer_request_function =          UX_GET_DESCRIPTOR;
+            transfer_request -> ux_transfer_request_type =              UX_REQUEST_IN | UX_REQUEST_TYPE_STANDARD | UX_REQUEST_TARGET_DEVICE;
+            transfer_request -> ux_transfer_request_value =             (UX_STRING_DESCRIPTOR_ITEM << 8);
+            transfer_request -> ux_transfer_request_index =             0;
+
+            /* Send request to HCD layer.  */
+            status =  _ux_host_stack_transfer_request(transfer_request);
+            if (status == UX_SUCCESS && transfer_request -> ux_transfer_request_actual_length == 4)
+                langid =  _ux_utility_short_get(serial + 2);
+        }
+
+        if (langid != 0)
+        {
+
+            /* Create a transfer_request for the GET_DESCRIPTOR request of the serial number.  */
+            transfer_request -> ux_transfer_request_data_pointer =      serial;
+            transfer_request -> ux_transfer_request_requested_length =  UX_HOST_DESCRIPTOR_CACHE_SERIAL_LENGTH;
+            transfer_request -> ux_transfer_request_function =          UX_GET_DESCRIPTOR;
+            transfer_request -> ux_transfer_request_type =              UX_REQUEST_IN | UX_REQUEST_TYPE_STANDARD | UX_REQUEST_TARGET_DEVICE;
+            transfer_request -> ux_transfer_request_value =             (UX_STRING_DESCRIPTOR_ITEM << 8) | device -> ux_device_descriptor.iSerialNumber;
+            transfer_request -> ux_transfer_request_index =             langid;
+
+            /* Send request to HCD layer.  */
+            status =  _ux_host_stack_transfer_request(transfer_request);
+            serial_length =  transfer_request -> ux_transfer_request_actual_length;
+        }
+
+        /* Without the complete serial number the device is not looked up,
+           a truncated serial number may not tell apart devices.  */
+        if (langid == 0 || status != UX_SUCCESS || serial_length < 2 || *serial != serial_length)
+        {
+            _ux_utility_memory_free(serial);
+            return(UX_ERROR);
+        }
+    }
+
+    /* Look for the device among the entries.  */
+    for (entry_index = 0; entry_index < UX_HOST_DESCRIPTOR_CACHE_ENTRIES; entry_index++)
+    {
+
+        /* Get the cache entry.  */
+        entry =  &_ux_system_host -> ux_system_host_descriptor_cache[entry_index];
+
+        /* Check the device descriptor and serial number.  */
+        if (entry -> ux_host_descriptor_cache_entry_use != 0 &&
+            entry -> ux_host_descriptor_cache_entry_serial_length == serial_length &&
+            _ux_utility_memory_compare(&entry -> ux_host_descriptor_cache_entry_device_descriptor,
+                                       &device -> ux_device_descriptor, sizeof(UX_DEVICE_DESCRIPTOR)) == UX_SUCCESS &&
+            _ux_utility_memory_compare(entry -> ux_host_descriptor_cache_entry_serial,
+                                       serial, serial_length) == UX_SUCCESS)
+        {
+
+            /* Check if all the configurations are there.  */
+            if (entry -> ux_host_descriptor_cache_entry_count == device -> ux_device_descriptor.bNumConfigurations)
+            {
+
+                /* Cache hit, this entry is the most recently used now.  */
+                entry -> ux_host_descriptor_cache_entry_use =  ++_ux_system_host -> ux_system_host_descriptor_cache_use;
+                _ux_system_host -> ux_system_host_descriptor_cache_hits++;
+
+                /* Return the cached configuration descriptors.  */
+                *configurations =  entry -> ux_host_descriptor_cache_entry_configurations;
+                if (serial != UX_NULL)
+                    _ux_utility_memory_free(serial);
+                return(UX_SUCCESS);
+            }
+
+            /* Fill this entry again.  */
+            cache_entry =  entry;
+            break;
+        }
+    }
+
+    /* Cache miss. The entry of the model without serial number is completed
+       with this one, another unit of the model takes the least recently used
+       entry.  */
+    _ux_system_host -> ux_system_host_descriptor_cache_misses++;
+    if (entry_index == UX_HOST_DESCRIPTOR_CACHE_ENTRIES &&
+        model_entry -> ux_host_descriptor_cache_entry_serial_length == 0)
+        cache_entry =  model_entry;
+    _ux_host_stack_descriptor_cache_entry_reserve(cache_entry, device, serial, serial_length, langid);
+
+    /* Free all used resources.  */
+    if (serial != UX_NULL)
+        _ux_utility_memory_free(serial);
+
+    /* The configurations must be read.  */
+    return(UX_ERROR);
+}
+
+static inline VOID _ux_host_stack_descriptor_cache_entry_reserve(UX_HOST_DESCRIPTOR_CACHE_ENTRY *cache_entry,
+                                UX_DEVICE *device, UCHAR *serial, ULONG serial_length, ULONG langid)
+{
+
+    /* Free the configurations of the replaced device.  */
+    if (cache_entry -> ux_host_descriptor_cache_entry_configurations != UX_NULL)
+    {
+        _ux_utility_memory_free(cache_entry -> ux_host_descriptor_cache_entry_configurations);
+        cache_entry -> ux_host_descriptor_cache_entry_configurations =  UX_NULL;
+    }
+    cache_entry -> ux_host_descriptor_cache_entry_length =  0;
+    cache_entry -> ux_host_descriptor_cache_entry_count =  0;
+
+    /* Store the device keys, the configurations are saved as they are read.  */
+    _ux_utility_memory_copy(&cache_entry -> ux_host_descriptor_cache_entry_device_descriptor,
+                            &device -> ux_device_descriptor, sizeof(UX_DEVICE_DESCRIPTOR)); /* Use case of memcpy is verified. */
+    if (serial_length != 0)
+        _ux_utility_memory_copy(cache_entry -> ux_host_descriptor_cache_entry_serial, serial, serial_length); /* Use case of memcpy is verified. */
+    cache_entry -> ux_host_descriptor_cache_entry_serial_length =  serial_length;
+    cache_entry -> ux_host_descriptor_cache_entry_langid =  langid;
+    cache_entry -> ux_host_descriptor_cache_entry_use =  ++_ux_system_host -> ux_system_host_descriptor_cache_use;
+    cache_entry -> ux_host_descriptor_cache_entry_device =  device;
+}
+#endif
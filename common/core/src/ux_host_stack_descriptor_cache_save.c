@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_descriptor_cache_save                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function saves a configuration descriptor read from a device   */
+/*    to the cache entry reserved for the device by                       */
+/*    _ux_host_stack_descriptor_cache_lookup. The configurations are      */
+/*    saved in index order, the entry is complete once all of them are    */
+/*    saved. Nothing is saved if the device has no entry, if a previous   */
+/*    configuration is missing or if the descriptor is not consistent.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    device                                Pointer to device             */
+/*    configuration_index                   Index of configuration        */
+/*    descriptor                            Configuration descriptor,     */
+/*                                            with all the interface and  */
+/*                                            endpoint descriptors        */
+/*    length                                Length of descriptor          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_allocate           Allocate memory block         */
+/*    _ux_utility_memory_copy               Copy memory block             */
+/*    _ux_utility_memory_free               Free memory block             */
+/*    _ux_utility_short_get                 Get 16-bit word               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host Stack                                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_descriptor_cache_save(UX_DEVICE *device, UINT configuration_index,
+                                           UCHAR *descriptor, ULONG length)
+{
+
+UX_HOST_DESCRIPTOR_CACHE_ENTRY  *entry;
+UCHAR                           *configurations;
+UINT                            entry_index;
+
+
+    /* Find the entry filled for this device.  */
+    for (entry_index = 0; entry_index < UX_HOST_DESCRIPTOR_CACHE_ENTRIES; entry_index++)
+    {
+        entry =  &_ux_system_host -> ux_system_host_descriptor_cache[entry_index];
+        if (entry -> ux_host_descriptor_cache_entry_device == device)
+            break;
+    }
+    if (entry_index == UX_HOST_DESCRIPTOR_CACHE_ENTRIES)
+        return;
+
+    /* Configurations must be saved in order, and the descriptor must be a
+       configuration descriptor of the given length.  */
+    if ((configuration_index != entry -> ux_host_descriptor_cache_entry_count) ||
+        (length < UX_CONFIGURATION_DESCRIPTOR_LENGTH) ||
+        (*(descriptor + 1) != UX_CONFIGURATION_DESCRIPTOR_ITEM) ||
+        (_ux_utility_short_get(descriptor + 2) != length))
+    {
+
+        /* The entry can not be completed.  */
+        entry -> ux_host_descriptor_cache_entry_device =  UX_NULL;
+        return;
+    }
+
+    /* Allocate memory for the configurations saved so far plus this one.  */
+    configurations =  _ux_utility_memory_allocate_add_safe(UX_NO_ALIGN, UX_REGULAR_MEMORY,
+                                            entry -> ux_host_descriptor_cache_entry_length, length);
+    if (configurations == UX_NULL)
+    {
+
+        /* The entry can not be completed.  */
+        entry -> ux_host_descriptor_cache_entry_device =  UX_NULL;
+        return;
+    }
+
+    /* Move the configurations saved so far.  */
+    if (entry -> ux_host_descriptor_cache_entry_configurations != UX_NULL)
+    {
+        _ux_utility_memory_copy(configurations, entry -> ux_host_descriptor_cache_entry_configurations,
+                                entry -> ux_host_descriptor_cache_entry_length); /* Use case of memcpy is verified. */
+        _ux_utility_memory_free(entry -> ux_host_descriptor_cache_entry_configurations);
+    }
+
+    /* Append this configuration.  */
+    _ux_utility_memory_copy(configurations + entry -> ux_host_descriptor_cache_entry_length,
+                            descriptor, length); /* Use case of memcpy is verified. */
+    entry -> ux_host_descriptor_cache_entry_configurations =  configurations;
+    entry -> ux_host_descriptor_cache_entry_length +=  length;
+    entry -> ux_host_descriptor_cache_entry_count++;
+
+    /* Once all the configurations are saved, the entry is complete.  */
+    if (entry -> ux_host_descriptor_cache_entry_count ==
+        entry -> ux_host_descriptor_cache_entry_device_descriptor.bNumConfigurations)
+        entry -> ux_host_descriptor_cache_entry_device =  UX_NULL;
+}
+#endif
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_descriptor_cache_statistics_get      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of enumerations that built the     */
+/*    device configurations from the descriptor cache (hits) and the      */
+/*    number of enumerations that read them from the device (misses).     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hits                                  Destination for hit count     */
+/*    misses                                Destination for miss count    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_descriptor_cache_statistics_get(ULONG *hits, ULONG *misses)
+{
+#if !defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) || defined(UX_HOST_STANDALONE)
+    UX_PARAMETER_NOT_USED(hits);
+    UX_PARAMETER_NOT_USED(misses);
+
+    /* Descriptor cache is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+    /* Return the counters.  */
+    *hits =  _ux_system_host -> ux_system_host_descriptor_cache_hits;
+    *misses =  _ux_system_host -> ux_system_host_descriptor_cache_misses;
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_descriptor_cache_statistics_get     PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack descriptor cache          */
+/*    statistics get function call.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hits                                  Destination for hit count     */
+/*    misses                                Destination for miss count    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_descriptor_cache_statistics_get                      */
+/*                                          Get cache statistics          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_descriptor_cache_statistics_get(ULONG *hits, ULONG *misses)
+{
+
+    /* Sanity check.  */
+    if ((hits == UX_NULL) || (misses == UX_NULL))
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke descriptor cache statistics get function.  */
+    return(_ux_host_stack_descriptor_cache_statistics_get(hits, misses));
+}
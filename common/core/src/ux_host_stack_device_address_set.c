@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_device_address_set                   PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -54,6 +54,7 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_utility_delay_ms                  Thread sleep                  */ 
+/*    _ux_utility_time_get                  Get current time              */
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -72,6 +73,10 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            deferred address wait for   */
+/*                                            enumeration pipeline,       */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_device_address_set(UX_DEVICE *device)
@@ -175,8 +180,16 @@ UCHAR           device_address_byte;
         /* Mark the device as ADDRESSED now.  */
         device -> ux_device_state = UX_DEVICE_ADDRESSED;
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+
+        /* Some devices need some time to accept this address, the wait is
+           done before next request, see _ux_host_stack_new_device_enumerate.  */
+        device -> ux_device_address_set_time =  _ux_utility_time_get();
+#else
+
         /* Some devices need some time to accept this address.  */
         _ux_utility_delay_ms(UX_DEVICE_ADDRESS_SET_WAIT);
+#endif
 
         /* Return successful status.  */
         return(status);
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_stack_hcd_register                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -81,6 +81,9 @@
 /*                                            definitions, verified       */
 /*                                            memset and memcpy cases,    */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            initialized capabilities,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_hcd_register(UCHAR *hcd_name,
@@ -135,6 +138,9 @@ ULONG       hcd_index;
             hcd -> ux_hcd_io =   hcd_param1;
             hcd -> ux_hcd_irq =  hcd_param2;
 
+            /* Capabilities are set by the HCD initialization.  */
+            hcd -> ux_hcd_capabilities =  0;
+
             /* This controller is now used */
             hcd -> ux_hcd_status =  UX_USED;
 
@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if !defined(UX_HOST_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_new_device_enumerate                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enumerates a device addressed by                      */
+/*    _ux_host_stack_new_device_address, it is the second step of         */
+/*    _ux_host_stack_new_device_create. The descriptors are read, the     */
+/*    configurations are parsed and a class driver is searched for the    */
+/*    device or its interfaces.                                           */
+/*                                                                        */
+/*    With UX_HOST_ENUMERATION_PIPELINE_ENABLE, the time the device needs */
+/*    to accept its address is counted from the SET_ADDRESS request, so   */
+/*    the wait is shortened by the time spent since then.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    device                                Pointer to addressed device   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*    If there's an error, the device resources should be freed by the    */
+/*    caller, see _ux_host_stack_new_device_create.                       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_class_device_scan      Scan class devices            */
+/*    _ux_host_stack_class_interface_scan   Scan class interfaces         */
+/*    _ux_host_stack_device_descriptor_read Read device descriptor        */
+/*    _ux_host_stack_configuration_enumerate                              */
+/*                                          Enumerate device config       */
+/*    _ux_utility_memory_free               Free memory                   */
+/*    _ux_utility_thread_sleep              Sleep thread                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host Stack                                                          */
+/*    HUB Class                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_new_device_enumerate(UX_DEVICE *device)
+{
+
+UINT                status;
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+ULONG               elapsed;
+
+
+    /* Some devices need some time to accept the address, wait what is left.  */
+    elapsed =  (ULONG) _ux_utility_time_elapsed(device -> ux_device_address_set_time, _ux_utility_time_get());
+    if (elapsed < UX_MS_TO_TICK(UX_DEVICE_ADDRESS_SET_WAIT))
+
+        /* For safety add 1 to ticks, as _ux_utility_delay_ms does.  */
+        _ux_utility_thread_sleep(UX_MS_TO_TICK(UX_DEVICE_ADDRESS_SET_WAIT) - elapsed + 1);
+#endif
+
+    /* Get the device descriptor.  */
+    status =  _ux_host_stack_device_descriptor_read(device);
+    if (status == UX_SUCCESS)
+    {
+
+        /* Get the configuration descriptor(s) for the device
+           and parse all the configuration, interface, endpoints...  */
+        status =  _ux_host_stack_configuration_enumerate(device);
+    }
+
+    /* Check the status of the previous operations. If there was an
+       error during any of the phases, the device resources must be
+       freed based on if we want to retry.  */
+    if (status == UX_SUCCESS)
+    {
+
+        /* The device, configuration(s), interface(s), endpoint(s) are
+           now in order for this device to work. No configuration is set
+           yet. First we need to find a class driver that wants to own
+           it. There is no need to have an orphan device in a configured state.   */
+        status =  _ux_host_stack_class_device_scan(device);
+        if (status == UX_NO_CLASS_MATCH)
+        {
+
+            status =  _ux_host_stack_class_interface_scan(device);
+
+        }
+
+        /* Check if there is unnecessary resource to free.  */
+        if (device -> ux_device_packed_configuration &&
+            device -> ux_device_packed_configuration_keep_count == 0)
+        {
+            _ux_utility_memory_free(device -> ux_device_packed_configuration);
+            device -> ux_device_packed_configuration = UX_NULL;
+        }
+
+        /* If trace is enabled, register this object.  */
+        UX_TRACE_OBJECT_REGISTER(UX_TRACE_HOST_OBJECT_TYPE_DEVICE, UX_DEVICE_HCD_GET(device),
+                                 UX_DEVICE_PARENT_GET(device), UX_DEVICE_PORT_LOCATION_GET(device), 0);
+    }
+
+    /* Return status. If there's an error, device resources that have been 
+       allocated until this point should be freed by the caller via _ux_host_stack_device_resources_free.  */
+    return(status);
+}
+#endif
@@ -44,7 +44,7 @@ static inline VOID _ux_host_stack_pending_transfers_run(VOID);
 /*  FUNCTION                                                 RELEASE      */
 /*                                                                        */
 /*    _ux_host_stack_tasks_run                              PORTABLE C    */
-/*                                                             6.2.0      */
+/*                                                             6.x        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -70,6 +70,7 @@ static inline VOID _ux_host_stack_pending_transfers_run(VOID);
 /*    (ux_system_host_change_function)      Host change callback function */
 /*    (ux_system_host_enum_hub_function)    Host hub enumeration function */
 /*    _ux_host_stack_rh_change_process      Host Root Hub process         */
+/*    _ux_host_stack_timer_wheel_run        Run host timer wheel          */
 /*    _ux_host_stack_device_address_set     Start process to set address  */
 /*    _ux_host_stack_configuration_set      Start process to set config   */
 /*    _ux_host_stack_device_descriptor_read Start process to read device  */
@@ -110,6 +111,9 @@ static inline VOID _ux_host_stack_pending_transfers_run(VOID);
 /*                                            fixed activation issue on   */
 /*                                            no class linked interfaces, */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added timer wheel support,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT _ux_host_stack_tasks_run(VOID)
@@ -146,6 +150,12 @@ ULONG class_index;
         class_inst -> ux_host_class_task_function(class_inst);
     }
 
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+    /* =========== Run transfer timeouts.  */
+    _ux_host_stack_timer_wheel_run();
+#endif
+
     /* =========== Run pending transfer tasks.  */
     _ux_host_stack_pending_transfers_run();
 
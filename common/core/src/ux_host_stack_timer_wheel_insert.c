@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_insert                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function puts a transfer request in the timer wheel slot of    */
+/*    its deadline. Deadlines within the first level span go to the slot  */
+/*    of their tick. Later deadlines go to the second level slot of their */
+/*    span, and are put in the first level when this slot is cascaded.    */
+/*    Deadlines beyond the wheel go to an earlier second level slot and   */
+/*    are put again when it is cascaded.                                  */
+/*                                                                        */
+/*    It must be called with interrupts disabled.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    USBX Components                                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_timer_wheel_insert(UX_TRANSFER *transfer_request)
+{
+
+UX_HOST_TIMER_WHEEL     *wheel;
+UX_TRANSFER             **slot;
+ULONG                   deadline;
+ULONG                   delta;
+
+
+    /* Get the wheel.  */
+    wheel =  &_ux_system_host -> ux_system_host_timer_wheel;
+
+    /* Get the ticks to the deadline, a passed deadline expires on current tick.  */
+    deadline =  transfer_request -> ux_transfer_request_timer_deadline;
+    delta =  deadline - wheel -> ux_host_timer_wheel_time;
+    if ((LONG)delta < 0)
+    {
+        deadline =  wheel -> ux_host_timer_wheel_time;
+        delta =  0;
+    }
+
+    /* Locate the slot.  */
+    if (delta < UX_HOST_TIMER_WHEEL_SLOTS)
+        slot =  &wheel -> ux_host_timer_wheel_slots[0][deadline & UX_HOST_TIMER_WHEEL_SLOTS_MASK];
+    else
+        slot =  &wheel -> ux_host_timer_wheel_slots[1][(deadline >> UX_HOST_TIMER_WHEEL_SLOTS_SHIFT) &
+                                                        UX_HOST_TIMER_WHEEL_SLOTS_MASK];
+
+    /* Link the request at slot head.  */
+    transfer_request -> ux_transfer_request_timer_next =  *slot;
+    if (*slot != UX_NULL)
+        (*slot) -> ux_transfer_request_timer_link =  &transfer_request -> ux_transfer_request_timer_next;
+    transfer_request -> ux_transfer_request_timer_link =  slot;
+    *slot =  transfer_request;
+}
+#endif
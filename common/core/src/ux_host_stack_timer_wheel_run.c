@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_run                      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function advances the host timer wheel to current time and     */
+/*    expires the transfer request timeouts reached on the way. Each tick */
+/*    only visits its own first level slot, and the second level slot     */
+/*    reached every first level turn, so the cost does not depend on the  */
+/*    number of armed timeouts.                                           */
+/*                                                                        */
+/*    In standalone mode an expired request is marked and then aborted by */
+/*    _ux_host_stack_transfer_run. Otherwise it is aborted here and its   */
+/*    completion function sees UX_TRANSFER_TIMEOUT.                       */
+/*                                                                        */
+/*    It must be called from thread (or standalone main loop) context.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_insert     Insert in timer wheel         */
+/*    _ux_host_stack_transfer_request_abort Abort transfer request        */
+/*    _ux_utility_time_get                  Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    USBX Components                                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_timer_wheel_run(VOID)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_TIMER_WHEEL     *wheel;
+UX_TRANSFER             *transfer_request;
+UX_TRANSFER             *next;
+ULONG                   time_now;
+ULONG                   tick;
+
+
+    /* Get the wheel.  */
+    wheel =  &_ux_system_host -> ux_system_host_timer_wheel;
+
+    time_now =  _ux_utility_time_get();
+
+    /* Only one runner at a time.  */
+    UX_DISABLE
+    if (wheel -> ux_host_timer_wheel_running)
+    {
+        UX_RESTORE
+        return;
+    }
+    wheel -> ux_host_timer_wheel_running =  UX_TRUE;
+
+    /* Advance tick by tick while timeouts are armed.  */
+    while ((wheel -> ux_host_timer_wheel_armed != 0) &&
+           (wheel -> ux_host_timer_wheel_time != time_now))
+    {
+        tick =  ++ wheel -> ux_host_timer_wheel_time;
+
+        /* On each first level turn, move the second level slot down.  */
+        if ((tick & UX_HOST_TIMER_WHEEL_SLOTS_MASK) == 0)
+        {
+            transfer_request =  wheel -> ux_host_timer_wheel_slots[1][(tick >> UX_HOST_TIMER_WHEEL_SLOTS_SHIFT) &
+                                                                     UX_HOST_TIMER_WHEEL_SLOTS_MASK];
+            wheel -> ux_host_timer_wheel_slots[1][(tick >> UX_HOST_TIMER_WHEEL_SLOTS_SHIFT) &
+                                                  UX_HOST_TIMER_WHEEL_SLOTS_MASK] =  UX_NULL;
+            while (transfer_request != UX_NULL)
+            {
+                next =  transfer_request -> ux_transfer_request_timer_next;
+                _ux_host_stack_timer_wheel_insert(transfer_request);
+                transfer_request =  next;
+            }
+        }
+
+        /* Expire the requests of this tick.  */
+        while (1)
+        {
+            transfer_request =  wheel -> ux_host_timer_wheel_slots[0][tick & UX_HOST_TIMER_WHEEL_SLOTS_MASK];
+            if (transfer_request == UX_NULL)
+                break;
+
+            /* Unlink the request.  */
+            next =  transfer_request -> ux_transfer_request_timer_next;
+            wheel -> ux_host_timer_wheel_slots[0][tick & UX_HOST_TIMER_WHEEL_SLOTS_MASK] =  next;
+            if (next != UX_NULL)
+                next -> ux_transfer_request_timer_link =
+                            &wheel -> ux_host_timer_wheel_slots[0][tick & UX_HOST_TIMER_WHEEL_SLOTS_MASK];
+            transfer_request -> ux_transfer_request_timer_state =  UX_HOST_TIMER_WHEEL_EXPIRED;
+            wheel -> ux_host_timer_wheel_armed --;
+            wheel -> ux_host_timer_wheel_expirations ++;
+
+#if !defined(UX_HOST_STANDALONE)
+
+            /* Abort the request, out of the critical section.  */
+            UX_RESTORE
+            _ux_host_stack_transfer_request_abort(transfer_request);
+            UX_DISABLE
+#endif
+        }
+    }
+
+    /* Release the wheel.  */
+    wheel -> ux_host_timer_wheel_running =  UX_FALSE;
+    UX_RESTORE
+}
+#endif
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_statistics_get           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the host timer wheel counters: the number of  */
+/*    transfer timeouts currently armed and its maximum, the number of    */
+/*    timeouts started, and the number of timeouts expired.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    armed                                 Destination for armed count   */
+/*    armed_max                             Destination for max armed     */
+/*    starts                                Destination for start count   */
+/*    expirations                           Destination for expired count */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_stack_timer_wheel_statistics_get(ULONG *armed, ULONG *armed_max, ULONG *starts, ULONG *expirations)
+{
+#if !defined(UX_HOST_TIMER_WHEEL_ENABLE)
+    UX_PARAMETER_NOT_USED(armed);
+    UX_PARAMETER_NOT_USED(armed_max);
+    UX_PARAMETER_NOT_USED(starts);
+    UX_PARAMETER_NOT_USED(expirations);
+
+    /* Timer wheel is not enabled.  */
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UX_HOST_TIMER_WHEEL     *wheel;
+
+
+    /* Return the counters.  */
+    wheel =  &_ux_system_host -> ux_system_host_timer_wheel;
+    *armed =  wheel -> ux_host_timer_wheel_armed;
+    *armed_max =  wheel -> ux_host_timer_wheel_armed_max;
+    *starts =  wheel -> ux_host_timer_wheel_starts;
+    *expirations =  wheel -> ux_host_timer_wheel_expirations;
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_stack_timer_wheel_statistics_get          PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in host stack timer wheel statistics    */
+/*    get function call.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    armed                                 Destination for armed count   */
+/*    armed_max                             Destination for max armed     */
+/*    starts                                Destination for start count   */
+/*    expirations                           Destination for expired count */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_statistics_get                           */
+/*                                          Get timer wheel statistics    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_stack_timer_wheel_statistics_get(ULONG *armed, ULONG *armed_max, ULONG *starts, ULONG *expirations)
+{
+
+    /* Sanity check.  */
+    if ((armed == UX_NULL) || (armed_max == UX_NULL) ||
+        (starts == UX_NULL) || (expirations == UX_NULL))
+        return(UX_INVALID_PARAMETER);
+
+    /* Invoke timer wheel statistics get function.  */
+    return(_ux_host_stack_timer_wheel_statistics_get(armed, armed_max, starts, expirations));
+}
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_stack_transfer_request                     PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -65,6 +65,8 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    HCD Entry Function                                                  */ 
+/*    _ux_host_stack_transfer_timer_start   Start transfer timer          */
+/*    _ux_host_stack_transfer_timer_stop    Stop transfer timer           */
 /*    _ux_utility_semaphore_put             Put semaphore                 */
 /*    _ux_utility_semaphore_get             Get semaphore                 */
 /*                                                                        */ 
@@ -88,6 +90,10 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added timer wheel support,  */
+/*                                            added transfer segments,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_transfer_request(UX_TRANSFER *transfer_request)
@@ -137,6 +143,14 @@ UINT            status;
     /* Get the device container from the endpoint.  */
     device =  endpoint -> ux_endpoint_device;
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+    /* Transfer segments are only accepted by HCD supporting them.  */
+    if ((transfer_request -> ux_transfer_request_segment_count != 0) &&
+        !(UX_DEVICE_HCD_GET(device) -> ux_hcd_capabilities & UX_HCD_CAPABILITY_TRANSFER_SEGMENTS))
+        return(UX_FUNCTION_NOT_SUPPORTED);
+#endif
+
     /* Ensure we are not preempted by the enum thread while we check the device 
        state and set the transfer status.  */
     UX_DISABLE
@@ -204,9 +218,26 @@ UINT            status;
         }        
     }             
     
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE) && defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+
+    /* A request bound to a completion queue has no thread waiting for it,
+       its timeout is armed in the timer wheel.  */
+    if ((transfer_request -> ux_transfer_request_completion_queue != UX_NULL) &&
+        (transfer_request -> ux_transfer_request_timeout_value != UX_WAIT_FOREVER))
+        _ux_host_stack_transfer_timer_start(transfer_request,
+                                            transfer_request -> ux_transfer_request_timeout_value);
+#endif
+
     /* Send the command to the controller.  */    
     status =  hcd -> ux_hcd_entry_function(hcd, UX_HCD_TRANSFER_REQUEST, transfer_request);
 
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE) && defined(UX_HOST_COMPLETION_QUEUE_ENABLE)
+
+    /* The request is not started.  */
+    if (status != UX_SUCCESS)
+        _ux_host_stack_transfer_timer_stop(transfer_request);
+#endif
+
     /* If this is endpoint 0, we unprotect the endpoint. */
     if ((endpoint -> ux_endpoint_descriptor.bEndpointAddress & (UINT)~UX_ENDPOINT_DIRECTION) == 0)
 
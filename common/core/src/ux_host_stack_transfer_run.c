@@ -44,7 +44,7 @@ static inline void _ux_host_stack_transfer_retire(UX_TRANSFER *transfer);
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_stack_transfer_run                         PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -75,6 +75,8 @@ static inline void _ux_host_stack_transfer_retire(UX_TRANSFER *transfer);
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    HCD Entry Function                                                  */
+/*    _ux_host_stack_transfer_timer_start   Start transfer timer          */
+/*    _ux_host_stack_transfer_timer_stop    Stop transfer timer           */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -86,6 +88,9 @@ static inline void _ux_host_stack_transfer_retire(UX_TRANSFER *transfer);
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  01-31-2022     Chaoqiong Xiao           Initial Version 6.1.10        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added timer wheel support,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_transfer_run(UX_TRANSFER *transfer_request)
@@ -155,6 +160,11 @@ UINT            status;
         transfer_request -> ux_transfer_request_completion_code = UX_TRANSFER_STATUS_PENDING;
         transfer_request -> ux_transfer_request_state = UX_STATE_WAIT;
         transfer_request -> ux_transfer_request_time_start = _ux_utility_time_get();
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+        if (transfer_request -> ux_transfer_request_timeout_value != UX_WAIT_FOREVER)
+            _ux_host_stack_transfer_timer_start(transfer_request,
+                                        transfer_request -> ux_transfer_request_timeout_value);
+#endif
 
         /* Add request to system pending request list. Note request may be kept
            if transfer callback is used.  */
@@ -188,12 +198,21 @@ UINT            status;
         }
 
         /* Timeout check.  */
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+        /* Timeout is expired by the timer wheel.  */
+        if (transfer_request -> ux_transfer_request_timeout_value != UX_WAIT_FOREVER)
+        {
+            if (transfer_request -> ux_transfer_request_timer_state == UX_HOST_TIMER_WHEEL_EXPIRED)
+            {
+#else
         if (transfer_request -> ux_transfer_request_timeout_value != UX_WAIT_FOREVER)
         {
             if (transfer_request -> ux_transfer_request_timeout_value <
                 _ux_utility_time_elapsed(transfer_request -> ux_transfer_request_time_start,
                                          _ux_utility_time_get()))
             {
+#endif
 
                 /* All transfers pending need to abort. There may have been a partial transfer.  */
                 _ux_host_stack_transfer_request_abort(transfer_request);
@@ -283,6 +302,12 @@ UX_TRANSFER         *previous;
         break;
     }
 
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+
+    /* Stop the timeout.  */
+    _ux_host_stack_transfer_timer_stop(transfer);
+#endif
+
     /* Process transfer flags.  */
     flags = transfer -> ux_transfer_request_flags;
     transfer -> ux_transfer_request_flags &=
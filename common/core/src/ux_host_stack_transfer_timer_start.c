@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Host Stack                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_TIMER_WHEEL_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_stack_transfer_timer_start                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function arms the timeout of a transfer request in the host    */
+/*    timer wheel. If the timeout is already armed it is restarted.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*    timeout                               Timeout in ticks              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_timer_wheel_insert     Insert in timer wheel         */
+/*    _ux_host_stack_transfer_timer_stop    Stop transfer timer           */
+/*    _ux_utility_time_get                  Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    USBX Components                                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_stack_transfer_timer_start(UX_TRANSFER *transfer_request, ULONG timeout)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_TIMER_WHEEL     *wheel;
+ULONG                   time_now;
+
+
+    /* Get the wheel.  */
+    wheel =  &_ux_system_host -> ux_system_host_timer_wheel;
+
+    /* Expire on next tick at least.  */
+    if (timeout == 0)
+        timeout =  1;
+
+    time_now =  _ux_utility_time_get();
+
+    UX_DISABLE
+
+    /* Remove the previous timeout.  */
+    if (transfer_request -> ux_transfer_request_timer_state == UX_HOST_TIMER_WHEEL_ARMED)
+        _ux_host_stack_transfer_timer_stop(transfer_request);
+
+    /* The wheel time is not maintained while nothing is armed.  */
+    if (wheel -> ux_host_timer_wheel_armed == 0)
+        wheel -> ux_host_timer_wheel_time =  time_now;
+
+    /* Insert the request.  */
+    transfer_request -> ux_transfer_request_timer_deadline =  time_now + timeout;
+    transfer_request -> ux_transfer_request_timer_state =  UX_HOST_TIMER_WHEEL_ARMED;
+    _ux_host_stack_timer_wheel_insert(transfer_request);
+
+    /* Update statistics.  */
+    wheel -> ux_host_timer_wheel_starts ++;
+    wheel -> ux_host_timer_wheel_armed ++;
+    if (wheel -> ux_host_timer_wheel_armed > wheel -> ux_host_timer_wheel_armed_max)
+        wheel -> ux_host_timer_wheel_armed_max =  wheel -> ux_host_timer_wheel_armed;
+
+    UX_RESTORE
+}
+#endif
@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_stack_uninitialize                         PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -59,6 +59,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _ux_host_stack_descriptor_cache_flush Flush descriptor cache        */
 /*    _ux_utility_memory_free               Free host memory              */
 /*    _ux_utility_thread_delete             Delete host thread            */
 /*    _ux_utility_semaphore_delete          Delete host semaphore         */
@@ -78,6 +79,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            freed descriptor cache,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_stack_uninitialize(VOID)
@@ -115,6 +119,12 @@ UINT  _ux_host_stack_uninitialize(VOID)
     _ux_utility_memory_free(_ux_system_host -> ux_system_host_hnp_polling_thread_stack);
 #endif
 
+#if defined(UX_HOST_DESCRIPTOR_CACHE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+    /* Free descriptor cache.  */
+    _ux_host_stack_descriptor_cache_flush();
+#endif
+
     /* Free HCD array.  */
     _ux_utility_memory_free(_ux_system_host -> ux_system_host_hcd_array);
 
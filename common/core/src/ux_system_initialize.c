@@ -69,7 +69,7 @@ UCHAR _ux_system_container_id_descriptor_structure[] =                      {1,1
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_system_initialize                               PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -115,6 +115,9 @@ UCHAR _ux_system_container_id_descriptor_structure[] =                      {1,1
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added memory free lists,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_system_initialize(VOID *regular_memory_pool_start, ULONG regular_memory_size, 
@@ -199,6 +202,9 @@ UINT                status;
     memory_block =                             _ux_system -> ux_system_regular_memory_pool_start;
     memory_block -> ux_memory_block_size =     _ux_system -> ux_system_regular_memory_pool_size - (ULONG)sizeof(UX_MEMORY_BLOCK);
     memory_block -> ux_memory_block_status =   UX_MEMORY_UNUSED;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+    _ux_utility_memory_free_list_insert(&_ux_system -> ux_system_regular_memory_pool_free_lists, memory_block);
+#endif
 
     /* Check the definition of the cache safe pool. If the application or controller do not require any cache safe memory,
        define the cached safe memory region as the regular memory region.  */
@@ -230,6 +236,9 @@ UINT                status;
         memory_block =                             _ux_system -> ux_system_cache_safe_memory_pool_start;
         memory_block -> ux_memory_block_size =     _ux_system -> ux_system_cache_safe_memory_pool_size - (ULONG)sizeof(UX_MEMORY_BLOCK);
         memory_block -> ux_memory_block_status =   UX_MEMORY_UNUSED;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+        _ux_utility_memory_free_list_insert(&_ux_system -> ux_system_cache_safe_memory_pool_free_lists, memory_block);
+#endif
     }
 
 #ifdef UX_ENABLE_MEMORY_STATISTICS
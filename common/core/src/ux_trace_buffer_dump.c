@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_utility.h"
+
+
+#ifdef UX_ENABLE_TRACE_BUFFER
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_trace_buffer_dump                               PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function copies the events in the trace ring buffers to a      */ 
+/*    binary dump, which is decoded offline. It can be called while       */ 
+/*    events are inserted; entries being written or overwritten during    */ 
+/*    the copy are left out.                                              */ 
+/*                                                                        */ 
+/*    The dump is a 24-byte header followed by one record per event,      */ 
+/*    all fields little endian:                                           */ 
+/*      header: magic "UXTB" (4), version (2), size of information        */ 
+/*              field (1), number of cores (1), entries per core (4),     */ 
+/*              timestamp frequency in Hz (8), number of records (4)      */ 
+/*      record: sequence (4), event ID (4), timestamp (8), core (4),      */ 
+/*              4 information fields                                      */ 
+/*                                                                        */ 
+/*    If the buffer is too small, the records that fit are dumped and     */ 
+/*    UX_MEMORY_INSUFFICIENT is returned.                                 */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    buffer                                Buffer to store dump          */ 
+/*    buffer_length                         Length of buffer              */ 
+/*    actual_length                         Length of dump                */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Completion Status                                                   */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_long_put                  Put 32-bit value              */ 
+/*    _ux_utility_short_put                 Put 16-bit value              */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    Application                                                         */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_trace_buffer_dump(UCHAR *buffer, ULONG buffer_length, ULONG *actual_length)
+{
+
+UX_TRACE_BUFFER         *trace_buffer;
+UX_TRACE_BUFFER_ENTRY   *entry;
+UCHAR                   *record;
+ULONG                   core;
+ULONG                   index;
+ULONG                   claim;
+ULONG                   sequence;
+ULONG                   event_id;
+ULONG64                 timestamp;
+ULONG                   info[4];
+ULONG                   value;
+ULONG                   record_count;
+ULONG                   entry_count;
+UINT                    byte_index;
+UINT                    info_index;
+UINT                    status;
+
+
+    /* Compile option checks.  */
+    UX_ASSERT((UX_TRACE_BUFFER_ENTRIES & (UX_TRACE_BUFFER_ENTRIES - 1)) == 0);
+
+    /* Nothing dumped yet.  */
+    *actual_length =  0;
+
+    /* Check that the header fits.  */
+    if (buffer_length < UX_TRACE_BUFFER_DUMP_HEADER_LENGTH)
+        return(UX_MEMORY_INSUFFICIENT);
+
+    /* Records follow the header.  */
+    record =  buffer + UX_TRACE_BUFFER_DUMP_HEADER_LENGTH;
+    buffer_length -=  UX_TRACE_BUFFER_DUMP_HEADER_LENGTH;
+    record_count =  0;
+    status =  UX_SUCCESS;
+
+    /* Dump the ring buffers, oldest entries first.  */
+    for (core = 0; core < UX_TRACE_BUFFER_CORES && status == UX_SUCCESS; core++)
+    {
+
+        /* Only the last UX_TRACE_BUFFER_ENTRIES claimed entries are still in the buffer.
+           The claim index wraps, so the oldest claim is computed modulo its range. Entries
+           never claimed yet have sequence 0 and are skipped below.  */
+        trace_buffer =  &_ux_trace_buffer[core];
+        index =  UX_TRACE_BUFFER_LOAD_ACQUIRE(&trace_buffer -> ux_trace_buffer_index);
+        claim =  index - UX_TRACE_BUFFER_ENTRIES;
+
+        for (entry_count = 0; entry_count < UX_TRACE_BUFFER_ENTRIES; entry_count++, claim++)
+        {
+
+            /* Check the space left.  */
+            if (buffer_length < UX_TRACE_BUFFER_DUMP_RECORD_LENGTH)
+            {
+                status =  UX_MEMORY_INSUFFICIENT;
+                break;
+            }
+
+            /* Skip entries still being written or already overwritten.  */
+            entry =  &trace_buffer -> ux_trace_buffer_entries[claim & (UX_TRACE_BUFFER_ENTRIES - 1)];
+            sequence =  UX_TRACE_BUFFER_LOAD_ACQUIRE(&entry -> ux_trace_buffer_entry_sequence);
+            if ((sequence == 0) || (sequence != claim + 1))
+                continue;
+
+            /* Copy the entry.  */
+            event_id =  entry -> ux_trace_buffer_entry_event_id;
+            timestamp =  entry -> ux_trace_buffer_entry_timestamp;
+            for (info_index = 0; info_index < 4; info_index++)
+                info[info_index] =  entry -> ux_trace_buffer_entry_info[info_index];
+
+            /* Discard the copy if a writer reused the entry meanwhile.  */
+            UX_TRACE_BUFFER_FENCE_ACQUIRE();
+            if (UX_TRACE_BUFFER_LOAD_ACQUIRE(&entry -> ux_trace_buffer_entry_sequence) != sequence)
+                continue;
+
+            /* Store the record: sequence, event ID, timestamp, core and information fields.  */
+            _ux_utility_long_put(record, sequence);
+            _ux_utility_long_put(record + 4, event_id);
+            for (byte_index = 0; byte_index < 8; byte_index++)
+            {
+                record[8 + byte_index] =  (UCHAR) timestamp;
+                timestamp >>=  8;
+            }
+            _ux_utility_long_put(record + 16, core);
+            record +=  20;
+            for (info_index = 0; info_index < 4; info_index++)
+            {
+                value =  info[info_index];
+                for (byte_index = 0; byte_index < sizeof(ULONG); byte_index++)
+                {
+                    *record++ =  (UCHAR) value;
+                    value >>=  8;
+                }
+            }
+
+            buffer_length -=  UX_TRACE_BUFFER_DUMP_RECORD_LENGTH;
+            record_count++;
+        }
+    }
+
+    /* Store the header.  */
+    _ux_utility_long_put(buffer, UX_TRACE_BUFFER_DUMP_MAGIC);
+    _ux_utility_short_put(buffer + 4, UX_TRACE_BUFFER_DUMP_VERSION);
+    buffer[6] =  (UCHAR) sizeof(ULONG);
+    buffer[7] =  (UCHAR) UX_TRACE_BUFFER_CORES;
+    _ux_utility_long_put(buffer + 8, UX_TRACE_BUFFER_ENTRIES);
+    timestamp =  UX_TRACE_BUFFER_TIMESTAMP_FREQUENCY;
+    for (byte_index = 0; byte_index < 8; byte_index++)
+    {
+        buffer[12 + byte_index] =  (UCHAR) timestamp;
+        timestamp >>=  8;
+    }
+    _ux_utility_long_put(buffer + 20, record_count);
+
+    /* Return the dump length.  */
+    *actual_length =  (ULONG) (record - buffer);
+    return(status);
+}
+#endif
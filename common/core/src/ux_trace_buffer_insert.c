@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_utility.h"
+
+
+#ifdef UX_ENABLE_TRACE_BUFFER
+
+/* Define the trace ring buffers, one per core.  */
+
+UX_TRACE_BUFFER     _ux_trace_buffer[UX_TRACE_BUFFER_CORES];
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_trace_buffer_insert                             PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function inserts a USBX event into the trace ring buffer of the*/ 
+/*    current core. It is lock-free: an entry is claimed by an atomic     */ 
+/*    increment of the buffer index, written, then published by storing   */ 
+/*    its sequence number last. The oldest entries are overwritten when   */ 
+/*    the buffer wraps.                                                   */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    event_id                              Event ID                      */ 
+/*    info_field_1                          First information field       */ 
+/*    info_field_2                          Second information field      */ 
+/*    info_field_3                          Third information field       */ 
+/*    info_field_4                          Fourth information field      */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_trace_buffer_insert(ULONG event_id, ULONG info_field_1, ULONG info_field_2, ULONG info_field_3, ULONG info_field_4)
+{
+
+UX_TRACE_BUFFER         *trace_buffer;
+UX_TRACE_BUFFER_ENTRY   *entry;
+ULONG64                 timestamp;
+ULONG                   claim;
+
+
+    /* Take the timestamp first so that claim order follows time order.  */
+    timestamp =  UX_TRACE_BUFFER_TIMESTAMP_GET();
+
+    /* Claim the next entry of the ring buffer of this core.  */
+    trace_buffer =  &_ux_trace_buffer[UX_TRACE_BUFFER_CORE_GET()];
+    claim =  UX_TRACE_BUFFER_INDEX_CLAIM(&trace_buffer -> ux_trace_buffer_index);
+    entry =  &trace_buffer -> ux_trace_buffer_entries[claim & (UX_TRACE_BUFFER_ENTRIES - 1)];
+
+    /* Invalidate the entry while it is written, readers discard it.  */
+    UX_TRACE_BUFFER_STORE_RELEASE(&entry -> ux_trace_buffer_entry_sequence, 0);
+    UX_TRACE_BUFFER_FENCE_RELEASE();
+
+    /* Store the event.  */
+    entry -> ux_trace_buffer_entry_event_id =  event_id;
+    entry -> ux_trace_buffer_entry_timestamp =  timestamp;
+    entry -> ux_trace_buffer_entry_info[0] =  info_field_1;
+    entry -> ux_trace_buffer_entry_info[1] =  info_field_2;
+    entry -> ux_trace_buffer_entry_info[2] =  info_field_3;
+    entry -> ux_trace_buffer_entry_info[3] =  info_field_4;
+
+    /* Publish the entry with its sequence number.  */
+    UX_TRACE_BUFFER_STORE_RELEASE(&entry -> ux_trace_buffer_entry_sequence, claim + 1);
+}
+#endif
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_allocate                         PORTABLE C      */ 
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,8 @@
 /*                                                                        */ 
 /*    _ux_utility_memory_free_block_best_get Get best fit block of memory */ 
 /*    _ux_utility_memory_set                 Set block of memory          */ 
+/*    _ux_utility_memory_free_list_insert    Link block to free list      */ 
+/*    _ux_utility_memory_free_list_remove    Unlink block from free list  */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -77,6 +79,11 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            internal clean up,          */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added memory free lists,    */
+/*                                            linked next block back to   */
+/*                                            new block after split,      */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  *_ux_utility_memory_allocate(ULONG memory_alignment, ULONG memory_cache_flag,
@@ -91,6 +98,9 @@ ULONG               memory_removed_from_pool;
 ULONG               leftover;
 UCHAR               *memory_buffer;
 ALIGN_TYPE          int_memory_buffer;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+UX_MEMORY_FREE_LISTS *free_lists;
+#endif
 
 
     /* Get the mutex as this is a critical section.  */
@@ -250,6 +260,13 @@ ALIGN_TYPE          int_memory_buffer;
         return(UX_NULL);
     }
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+    /* The block is split and (partially) used, take it out of the free list.  */
+    free_lists =  _ux_utility_memory_free_lists_get(memory_cache_flag);
+    _ux_utility_memory_free_list_remove(free_lists, memory_block);
+#endif
+
     /* Get the memory buffer for this block.  */
     int_memory_buffer = (ALIGN_TYPE) ((UCHAR *) memory_block + sizeof(UX_MEMORY_BLOCK));
 
@@ -263,12 +280,20 @@ ALIGN_TYPE          int_memory_buffer;
         new_memory_block -> ux_memory_block_previous =  memory_block;
         new_memory_block -> ux_memory_block_size =  memory_block -> ux_memory_block_size - memory_size_requested - (ULONG)sizeof(UX_MEMORY_BLOCK);
         new_memory_block -> ux_memory_block_status =  UX_MEMORY_UNUSED;
+        if (new_memory_block -> ux_memory_block_next != UX_NULL)
+            new_memory_block -> ux_memory_block_next -> ux_memory_block_previous =  new_memory_block;
 
         /* Update the current memory block.  */
         memory_block -> ux_memory_block_size =  memory_size_requested;
         memory_block -> ux_memory_block_next =  new_memory_block;
         memory_block -> ux_memory_block_status =  UX_MEMORY_USED | memory_cache_flag;
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+        /* The remaining part is free.  */
+        _ux_utility_memory_free_list_insert(free_lists, new_memory_block);
+#endif
+
         /* Declare how much memory we removed from the pool.  */
         memory_removed_from_pool =  memory_block -> ux_memory_block_size + (ULONG)sizeof(UX_MEMORY_BLOCK);
     }
@@ -288,6 +313,8 @@ ALIGN_TYPE          int_memory_buffer;
         new_memory_block -> ux_memory_block_next =  memory_block -> ux_memory_block_next;
         new_memory_block -> ux_memory_block_size =  memory_block -> ux_memory_block_size;
         new_memory_block -> ux_memory_block_status =  UX_MEMORY_USED | memory_cache_flag;
+        if (new_memory_block -> ux_memory_block_next != UX_NULL)
+            new_memory_block -> ux_memory_block_next -> ux_memory_block_previous =  new_memory_block;
 
         /* Update the current memory block.  */
         int_memory_buffer =  (ALIGN_TYPE) ((UCHAR *) memory_block + sizeof(UX_MEMORY_BLOCK));
@@ -297,6 +324,12 @@ ALIGN_TYPE          int_memory_buffer;
         /* Update the new memory block's size.  */
         new_memory_block -> ux_memory_block_size -=  (memory_block -> ux_memory_block_size + (ULONG)sizeof(UX_MEMORY_BLOCK));
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+        /* The part before the aligned block is still free.  */
+        _ux_utility_memory_free_list_insert(free_lists, memory_block);
+#endif
+
         /* Calculate how much memory is leftover in the new memory block after doing
            the alignment.  */
         leftover =  new_memory_block -> ux_memory_block_size - memory_size_requested;
@@ -311,9 +344,17 @@ ALIGN_TYPE          int_memory_buffer;
             leftover_memory_block -> ux_memory_block_previous =  new_memory_block;
             leftover_memory_block -> ux_memory_block_size =  leftover - (ULONG)sizeof(UX_MEMORY_BLOCK);
             leftover_memory_block -> ux_memory_block_status =  UX_MEMORY_UNUSED;
+            if (leftover_memory_block -> ux_memory_block_next != UX_NULL)
+                leftover_memory_block -> ux_memory_block_next -> ux_memory_block_previous =  leftover_memory_block;
 
             new_memory_block -> ux_memory_block_next =  leftover_memory_block;
             new_memory_block -> ux_memory_block_size -=  leftover;
+
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+            /* The leftover part is free.  */
+            _ux_utility_memory_free_list_insert(free_lists, leftover_memory_block);
+#endif
         }
 
         /* Declare how much memory we removed from the pool.  */
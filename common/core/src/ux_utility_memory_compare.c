@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_compare                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -42,6 +42,11 @@
 /*                                                                        */ 
 /*    This function compares two memory blocks.                           */ 
 /*                                                                        */ 
+/*    If UX_UTILITY_MEMORY_COMPARE is defined by the port, it is used for */ 
+/*    the comparison. Otherwise, if UX_ENABLE_MEMORY_WORD_ACCESS is       */ 
+/*    defined, blocks with the same word alignment are compared word by   */ 
+/*    word.                                                               */ 
+/*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    memory_source                         Pointer to source             */ 
@@ -68,19 +73,67 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added word access and port  */
+/*                                            defined implementation,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_utility_memory_compare(VOID *memory_source, VOID *memory_destination, ULONG length)
 {
+#if defined(UX_UTILITY_MEMORY_COMPARE)
+
+    /* Use the port compare function.  */
+    if (UX_UTILITY_MEMORY_COMPARE(memory_source, memory_destination, length) != 0)
+        return(UX_ERROR);
+    return(UX_SUCCESS);
+#else
 
 UCHAR *   source;
 UCHAR *   destination;
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+ALIGN_TYPE *word_source;
+ALIGN_TYPE *word_destination;
+#endif
 
 
     /* Setup source and destination byte oriented pointers.  */
     source =  (UCHAR *) memory_source;
     destination =  (UCHAR *) memory_destination;
 
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+
+    /* Words are compared if source and destination have the same word alignment.  */
+    if ((length >= sizeof(ALIGN_TYPE) * 2) &&
+        ((((ALIGN_TYPE) source ^ (ALIGN_TYPE) destination) & (sizeof(ALIGN_TYPE) - 1)) == 0))
+    {
+
+        /* Compare leading bytes until word aligned.  */
+        while(((ALIGN_TYPE) source) & (sizeof(ALIGN_TYPE) - 1))
+        {
+            if(*destination++ != *source++)
+                return(UX_ERROR);
+            length --;
+        }
+
+        /* Setup word oriented pointers.  */
+        word_source =  (ALIGN_TYPE *) source;
+        word_destination =  (ALIGN_TYPE *) destination;
+
+        /* Loop to compare words.  */
+        while(length >= sizeof(ALIGN_TYPE))
+        {
+            if(*word_destination++ != *word_source++)
+                return(UX_ERROR);
+            length -= sizeof(ALIGN_TYPE);
+        }
+
+        /* Back to bytes for the trailing bytes.  */
+        source =  (UCHAR *) word_source;
+        destination =  (UCHAR *) word_destination;
+    }
+#endif
+
     /* Loop to compare blocks.  */
     while(length--)
     {
@@ -96,5 +149,5 @@ UCHAR *   destination;
     
     /* Blocks are equal, return success.  */           
     return(UX_SUCCESS); 
+#endif
 }
-
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_copy                             PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -43,6 +43,10 @@
 /*    This function copies a block of memory from a source to a           */ 
 /*    destination.                                                        */ 
 /*                                                                        */ 
+/*    If UX_UTILITY_MEMORY_COPY is defined by the port, it is used for    */ 
+/*    the copy. Otherwise, if UX_ENABLE_MEMORY_WORD_ACCESS is defined,    */ 
+/*    blocks with the same word alignment are copied word by word.        */ 
+/*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    memory_destination                    Pointer to destination        */ 
@@ -68,18 +72,74 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added word access and port  */
+/*                                            defined implementation,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_utility_memory_copy(VOID *memory_destination, VOID *memory_source, ULONG length)
 {
+#if defined(UX_UTILITY_MEMORY_COPY)
+
+    /* Use the port copy function.  */
+    UX_UTILITY_MEMORY_COPY(memory_destination, memory_source, length);
+#else
 
 UCHAR *   source;
 UCHAR *   destination;
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+ALIGN_TYPE *word_source;
+ALIGN_TYPE *word_destination;
+#endif
 
     /* Setup byte oriented source and destination pointers.  */
     source =  (UCHAR *) memory_source;
     destination =  (UCHAR *) memory_destination;
 
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+
+    /* Words are copied if source and destination have the same word alignment.  */
+    if ((length >= sizeof(ALIGN_TYPE) * 2) &&
+        ((((ALIGN_TYPE) source ^ (ALIGN_TYPE) destination) & (sizeof(ALIGN_TYPE) - 1)) == 0))
+    {
+
+        /* Copy leading bytes until word aligned.  */
+        while(((ALIGN_TYPE) source) & (sizeof(ALIGN_TYPE) - 1))
+        {
+            *destination++ =  *source++;
+            length --;
+        }
+
+        /* Setup word oriented pointers.  */
+        word_source =  (ALIGN_TYPE *) source;
+        word_destination =  (ALIGN_TYPE *) destination;
+
+        /* Copy 4 words a time.  */
+        while(length >= sizeof(ALIGN_TYPE) * 4)
+        {
+            word_destination[0] =  word_source[0];
+            word_destination[1] =  word_source[1];
+            word_destination[2] =  word_source[2];
+            word_destination[3] =  word_source[3];
+            word_destination += 4;
+            word_source += 4;
+            length -= sizeof(ALIGN_TYPE) * 4;
+        }
+
+        /* Copy remaining words.  */
+        while(length >= sizeof(ALIGN_TYPE))
+        {
+            *word_destination++ =  *word_source++;
+            length -= sizeof(ALIGN_TYPE);
+        }
+
+        /* Back to bytes for the trailing bytes.  */
+        source =  (UCHAR *) word_source;
+        destination =  (UCHAR *) word_destination;
+    }
+#endif
+
     /* Loop to perform the copy.  */
     while(length--)
     {
@@ -87,8 +147,8 @@ UCHAR *   destination;
         /* Copy one byte.  */
         *destination++ =  *source++;
     }
+#endif
 
     /* Return to caller.  */
     return; 
 }
-
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_free                             PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -42,6 +42,10 @@
 /*                                                                        */ 
 /*    This function frees a previously allocated memory block.            */ 
 /*                                                                        */ 
+/*    If UX_ENABLE_MEMORY_FREE_LISTS is defined, the block is merged with */ 
+/*    its free neighbors (adjacent free blocks never exist, so at most    */ 
+/*    one on each side) and linked to the free list of its size class.   */ 
+/*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    memory                                Pointer to memory block       */ 
@@ -54,6 +58,8 @@
 /*                                                                        */ 
 /*    _ux_utility_mutex_on                  Start system protection       */ 
 /*    _ux_utility_mutex_off                 End system protection         */ 
+/*    _ux_utility_memory_free_list_insert   Link block to free list       */ 
+/*    _ux_utility_memory_free_list_remove   Unlink block from free list   */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -69,6 +75,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added memory free lists,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_utility_memory_free(VOID *memory)
@@ -78,6 +87,9 @@ UX_MEMORY_BLOCK     *memory_block;
 UX_MEMORY_BLOCK     *next_block;
 ULONG               memory_size_returned;
 UCHAR               *memory_address;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+UX_MEMORY_FREE_LISTS *free_lists;
+#endif
 #ifdef UX_ENABLE_MEMORY_POOL_SANITY_CHECK
 UCHAR               *regular_start, *regular_end;
 UCHAR               *cache_safe_start, *cache_safe_end;
@@ -152,6 +164,41 @@ UCHAR               *cache_safe_start, *cache_safe_end;
     }
 #endif
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+    /* Get the free lists of the pool the block belongs to.  */
+    free_lists =  _ux_utility_memory_free_lists_get(memory_block -> ux_memory_block_status & ~UX_MEMORY_USED);
+
+    /* We mark this memory block as being unused.  */
+    memory_block -> ux_memory_block_status =  UX_MEMORY_UNUSED;
+
+    /* Merge with the previous block if it's free.  */
+    next_block =  memory_block -> ux_memory_block_previous;
+    if (next_block != UX_NULL && next_block -> ux_memory_block_status == UX_MEMORY_UNUSED)
+    {
+        _ux_utility_memory_free_list_remove(free_lists, next_block);
+        next_block -> ux_memory_block_next =  memory_block -> ux_memory_block_next;
+        next_block -> ux_memory_block_size +=  memory_block -> ux_memory_block_size + (ULONG)sizeof(UX_MEMORY_BLOCK);
+        if (memory_block -> ux_memory_block_next != UX_NULL)
+            memory_block -> ux_memory_block_next -> ux_memory_block_previous =  next_block;
+        memory_block =  next_block;
+    }
+
+    /* Merge with the next block if it's free.  */
+    next_block =  memory_block -> ux_memory_block_next;
+    if (next_block != UX_NULL && next_block -> ux_memory_block_status == UX_MEMORY_UNUSED)
+    {
+        _ux_utility_memory_free_list_remove(free_lists, next_block);
+        memory_block -> ux_memory_block_next =  next_block -> ux_memory_block_next;
+        memory_block -> ux_memory_block_size +=  next_block -> ux_memory_block_size + (ULONG)sizeof(UX_MEMORY_BLOCK);
+        if (next_block -> ux_memory_block_next != UX_NULL)
+            next_block -> ux_memory_block_next -> ux_memory_block_previous =  memory_block;
+    }
+
+    /* Link the free block to its size class.  */
+    _ux_utility_memory_free_list_insert(free_lists, memory_block);
+#else
+
     /* We mark this memory block as being unused.  */
     memory_block -> ux_memory_block_status =  UX_MEMORY_UNUSED;
     
@@ -195,6 +242,7 @@ UCHAR               *cache_safe_start, *cache_safe_end;
         memory_block -> ux_memory_block_size +=  next_block -> ux_memory_block_size + (ULONG)sizeof(UX_MEMORY_BLOCK);
         next_block =  next_block -> ux_memory_block_next;                       
     }
+#endif
 
     /* Update the memory free in the appropriate pool.  We need to know if this 
        block is in regular memory or cache safe memory.  */
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_free_block_best_get              PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -42,6 +42,11 @@
 /*                                                                        */ 
 /*    This function returns the best free memory block.                   */ 
 /*                                                                        */ 
+/*    If UX_ENABLE_MEMORY_FREE_LISTS is defined, only the free list of    */ 
+/*    the requested size class is searched for the best fit block, if     */ 
+/*    none fits, the first block of the next non-empty larger size class  */ 
+/*    is returned.                                                        */ 
+/*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    memory_cache_flag                     Memory pool source            */ 
@@ -53,7 +58,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */
+/*    _ux_utility_memory_free_list_index_get                              */
+/*                                          Get size class of block       */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -66,6 +72,9 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added memory free lists,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UX_MEMORY_BLOCK  *_ux_utility_memory_free_block_best_get(ULONG memory_cache_flag, 
@@ -74,6 +83,11 @@ UX_MEMORY_BLOCK  *_ux_utility_memory_free_block_best_get(ULONG memory_cache_flag
 
 UX_MEMORY_BLOCK     *memory_block;
 UX_MEMORY_BLOCK     *best_memory_block;
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+UX_MEMORY_FREE_LISTS *free_lists;
+UINT                list_index;
+ULONG               list_map;
+#endif
     
 
     /* Reset the free memory block.  */
@@ -102,6 +116,40 @@ UX_MEMORY_BLOCK     *best_memory_block;
 
     }
 
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+
+    /* Get the free lists of the pool.  */
+    free_lists =  _ux_utility_memory_free_lists_get(memory_cache_flag);
+
+    /* Blocks in the size class of the request may or may not fit, 
+       search the best one in the list.  */
+    list_index =  _ux_utility_memory_free_list_index_get(memory_size_requested);
+    memory_block =  free_lists -> ux_memory_free_lists_head[list_index];
+    while (memory_block != UX_NULL)
+    {
+
+        /* Check if the block fits and it's closer to the memory requested.  */
+        if (memory_block -> ux_memory_block_size > memory_size_requested &&
+            (best_memory_block == UX_NULL ||
+             memory_block -> ux_memory_block_size < best_memory_block -> ux_memory_block_size))
+            best_memory_block =  memory_block;
+
+        /* Next free block of the same size class.  */
+        memory_block =  memory_block -> ux_memory_block_free_next;
+    }
+    if (best_memory_block != UX_NULL)
+        return(best_memory_block);
+
+    /* Any block in larger size classes fits, take the smallest non-empty class.  */
+    list_map =  free_lists -> ux_memory_free_lists_map & ~(((ULONG)2u << list_index) - 1u);
+    if (list_map == 0)
+        return(UX_NULL);
+
+    /* Isolate the lowest bit set to find the class.  */
+    list_index =  _ux_utility_memory_free_list_index_get(list_map & (~list_map + 1u));
+    return(free_lists -> ux_memory_free_lists_head[list_index]);
+#else
+
     /* Loop on all memory blocks from the beginning.  */
     while (memory_block != UX_NULL)
     {
@@ -139,5 +187,6 @@ UX_MEMORY_BLOCK     *best_memory_block;
 
     /* If no free memory block was found, the return value will be NULL.  */
     return(best_memory_block);        
+#endif
 }                                
 
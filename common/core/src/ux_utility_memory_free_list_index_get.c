@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Utility                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+
+
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_free_list_index_get              PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function returns the size class (free list index) of a memory */ 
+/*    block size, which is the position of the most significant bit set  */ 
+/*    in the size, limited to UX_MEMORY_SIZE_CLASSES - 1.                 */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    memory_size                           Size of memory block          */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Index of free list                                                  */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    None                                                                */
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_utility_memory_free_list_index_get(ULONG memory_size)
+{
+
+UINT        list_index;
+
+
+    /* Sizes beyond the last class are all linked to the last list.  */
+    if (memory_size >> (UX_MEMORY_SIZE_CLASSES - 1))
+        return(UX_MEMORY_SIZE_CLASSES - 1);
+
+    /* Binary search for the most significant bit set.  */
+    list_index =  0;
+    if (memory_size & 0xFFFF0000u)
+    {
+        memory_size >>= 16;
+        list_index +=  16;
+    }
+    if (memory_size & 0xFF00u)
+    {
+        memory_size >>= 8;
+        list_index +=  8;
+    }
+    if (memory_size & 0xF0u)
+    {
+        memory_size >>= 4;
+        list_index +=  4;
+    }
+    if (memory_size & 0xCu)
+    {
+        memory_size >>= 2;
+        list_index +=  2;
+    }
+    if (memory_size & 0x2u)
+        list_index +=  1;
+
+    /* Return the size class.  */
+    return(list_index);
+}
+#endif
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Utility                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+
+
+#ifdef UX_ENABLE_MEMORY_FREE_LISTS
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_free_list_remove                 PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function unlinks a free memory block from the free list of its */ 
+/*    size class. The block size must not be modified since the block was */ 
+/*    inserted.                                                           */ 
+/*                                                                        */ 
+/*    Note: the system mutex must be owned by the caller.                 */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    free_lists                            Free lists of the pool        */ 
+/*    memory_block                          Free memory block             */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_free_list_index_get                              */
+/*                                          Get size class of block       */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_utility_memory_free_list_remove(UX_MEMORY_FREE_LISTS *free_lists, UX_MEMORY_BLOCK *memory_block)
+{
+
+UINT                list_index;
+
+
+    /* Unlink from next block.  */
+    if (memory_block -> ux_memory_block_free_next != UX_NULL)
+        memory_block -> ux_memory_block_free_next -> ux_memory_block_free_previous =  memory_block -> ux_memory_block_free_previous;
+
+    /* Unlink from previous block.  */
+    if (memory_block -> ux_memory_block_free_previous != UX_NULL)
+    {
+        memory_block -> ux_memory_block_free_previous -> ux_memory_block_free_next =  memory_block -> ux_memory_block_free_next;
+    }
+    else
+    {
+
+        /* The block is list head, update the head.  */
+        list_index =  _ux_utility_memory_free_list_index_get(memory_block -> ux_memory_block_size);
+        free_lists -> ux_memory_free_lists_head[list_index] =  memory_block -> ux_memory_block_free_next;
+
+        /* Update the map if the list is empty now.  */
+        if (memory_block -> ux_memory_block_free_next == UX_NULL)
+            free_lists -> ux_memory_free_lists_map &=  ~((ULONG)1u << list_index);
+    }
+
+    /* The block is not linked any more.  */
+    memory_block -> ux_memory_block_free_next =  UX_NULL;
+    memory_block -> ux_memory_block_free_previous =  UX_NULL;
+}
+#endif
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_set                              PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -42,6 +42,10 @@
 /*                                                                        */ 
 /*    This function sets a memory block with a specific value.            */ 
 /*                                                                        */ 
+/*    If UX_UTILITY_MEMORY_SET is defined by the port, it is used to set  */ 
+/*    the memory. Otherwise, if UX_ENABLE_MEMORY_WORD_ACCESS is defined,  */ 
+/*    the memory is set word by word.                                     */ 
+/*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    destination                           Destination address           */ 
@@ -67,17 +71,72 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added word access and port  */
+/*                                            defined implementation,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_utility_memory_set(VOID *destination, UCHAR value, ULONG length)
 {
+#if defined(UX_UTILITY_MEMORY_SET)
+
+    /* Use the port set function.  */
+    UX_UTILITY_MEMORY_SET(destination, value, length);
+#else
 
 UCHAR *    work_ptr;
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+ALIGN_TYPE *word_ptr;
+ALIGN_TYPE word_value;
+#endif
 
 
     /* Setup the working pointer */
     work_ptr =  (UCHAR *) destination;
 
+#if defined(UX_ENABLE_MEMORY_WORD_ACCESS)
+
+    /* Words are set if there are enough bytes.  */
+    if (length >= sizeof(ALIGN_TYPE) * 2)
+    {
+
+        /* Set leading bytes until word aligned.  */
+        while(((ALIGN_TYPE) work_ptr) & (sizeof(ALIGN_TYPE) - 1))
+        {
+            *work_ptr++ =  value;
+            length --;
+        }
+
+        /* Build the word value, with the byte value in each byte.  */
+        word_value =  (~((ALIGN_TYPE) 0) / 0xFFu) * value;
+
+        /* Setup the word oriented pointer.  */
+        word_ptr =  (ALIGN_TYPE *) work_ptr;
+
+        /* Set 4 words a time.  */
+        while(length >= sizeof(ALIGN_TYPE) * 4)
+        {
+            word_ptr[0] =  word_value;
+            word_ptr[1] =  word_value;
+            word_ptr[2] =  word_value;
+            word_ptr[3] =  word_value;
+            word_ptr += 4;
+            length -= sizeof(ALIGN_TYPE) * 4;
+        }
+
+        /* Set remaining words.  */
+        while(length >= sizeof(ALIGN_TYPE))
+        {
+            *word_ptr++ =  word_value;
+            length -= sizeof(ALIGN_TYPE);
+        }
+
+        /* Back to bytes for the trailing bytes.  */
+        work_ptr =  (UCHAR *) word_ptr;
+    }
+#endif
+
     /* Loop to set the memory.  */
     while(length--)
     {
@@ -85,8 +144,8 @@ UCHAR *    work_ptr;
         /* Set a byte.  */
         *work_ptr++ =  value;
     }
+#endif
 
     /* Return to caller.  */
     return; 
 }
-
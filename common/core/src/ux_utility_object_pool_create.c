@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Utility                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_utility_object_pool_create                      PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function creates a pool of fixed-size objects. The objects are */ 
+/*    allocated in one block from the specified memory pool, each object  */ 
+/*    is placed to keep the alignment it would have if it's allocated by  */ 
+/*    _ux_utility_memory_allocate with the same alignment.                */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    memory_alignment                      Memory alignment required     */ 
+/*    memory_cache_flag                     Memory pool source            */ 
+/*    object_size                           Size of each object           */ 
+/*    object_count                          Number of objects             */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Pointer to object pool                                              */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_memory_allocate           Allocate memory block         */ 
+/*    _ux_utility_memory_allocate_mulc_safe Allocate memory array         */ 
+/*    _ux_utility_memory_free               Free memory block             */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UX_OBJECT_POOL  *_ux_utility_object_pool_create(ULONG memory_alignment, ULONG memory_cache_flag,
+                                                ULONG object_size, ULONG object_count)
+{
+
+UX_OBJECT_POOL      *pool;
+ULONG               object_alignment;
+ULONG               object_stride;
+UCHAR               *object;
+VOID                **next_link;
+
+
+    /* Sanity check.  */
+    if (object_size == 0 || object_count == 0)
+        return(UX_NULL);
+
+    /* Decide the alignment of each object.  */
+    if (memory_alignment == UX_SAFE_ALIGN)
+    {
+#ifdef UX_ENFORCE_SAFE_ALIGNMENT
+
+        /* Same as memory allocate: align on the size, up to the maximum.  */
+        object_alignment =  UX_ALIGN_MIN + 1;
+        while (object_alignment < object_size && object_alignment < UX_MAX_SCATTER_GATHER_ALIGNMENT)
+            object_alignment <<= 1;
+#else
+        object_alignment =  UX_ALIGN_MIN + 1;
+#endif
+    }
+    else
+    {
+        object_alignment =  (memory_alignment < UX_ALIGN_MIN) ? UX_ALIGN_MIN + 1 : memory_alignment + 1;
+    }
+
+    /* Objects are placed back to back, each one starts on the alignment.
+       A free object must be large enough to keep the free list link.  */
+    object_stride =  (object_size < sizeof(VOID *)) ? sizeof(VOID *) : object_size;
+    object_stride =  (object_stride + object_alignment - 1) & ~(object_alignment - 1);
+    if (object_stride < object_size)
+        return(UX_NULL);
+
+    /* Allocate the pool control structure.  */
+    pool =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_OBJECT_POOL));
+    if (pool == UX_NULL)
+        return(UX_NULL);
+
+    /* Allocate the objects.  */
+    pool -> ux_object_pool_start =  _ux_utility_memory_allocate_mulc_safe(object_alignment - 1,
+                                                memory_cache_flag, object_stride, object_count);
+    if (pool -> ux_object_pool_start == UX_NULL)
+    {
+        _ux_utility_memory_free(pool);
+        return(UX_NULL);
+    }
+
+    /* Save pool settings, they are also used if pool objects are exhausted.  */
+    pool -> ux_object_pool_end =  pool -> ux_object_pool_start + object_stride * object_count;
+    pool -> ux_object_pool_memory_alignment =  memory_alignment;
+    pool -> ux_object_pool_memory_cache_flag =  memory_cache_flag;
+    pool -> ux_object_pool_object_size =  object_size;
+    pool -> ux_object_pool_object_count =  object_count;
+    pool -> ux_object_pool_available =  object_count;
+
+    /* Link all objects to free list, the link is kept at start of each free object.  */
+    next_link =  &pool -> ux_object_pool_free_list;
+    for (object = pool -> ux_object_pool_start; object < pool -> ux_object_pool_end; object += object_stride)
+    {
+        *next_link =  (VOID *)object;
+        next_link =  (VOID **)object;
+    }
+    *next_link =  UX_NULL;
+
+    /* Return pool created.  */
+    return(pool);
+}
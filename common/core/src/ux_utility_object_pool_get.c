@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Utility                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_utility_object_pool_get                         PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function gets a cleared object from a fixed-size object pool.  */ 
+/*    The object is taken from the pool free list in constant time,       */ 
+/*    without the system mutex. If the pool is exhausted, the object is   */ 
+/*    allocated from the memory pool the object pool is created in.       */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    pool                                  Pointer to object pool        */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Pointer to object                                                   */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_interrupt_disable         Disable interrupts            */ 
+/*    _ux_utility_interrupt_restore         Restore interrupts            */ 
+/*    _ux_utility_memory_allocate           Allocate memory block         */ 
+/*    _ux_utility_memory_set                Set memory                    */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  *_ux_utility_object_pool_get(UX_OBJECT_POOL *pool)
+{
+
+UX_INTERRUPT_SAVE_AREA
+VOID                *object;
+
+
+    /* Pop the first free object.  */
+    UX_DISABLE
+    object =  pool -> ux_object_pool_free_list;
+    if (object != UX_NULL)
+    {
+        pool -> ux_object_pool_free_list =  *(VOID **)object;
+        pool -> ux_object_pool_available --;
+    }
+    UX_RESTORE
+
+    /* If the pool is exhausted, fall back to memory allocate (object is cleared there).  */
+    if (object == UX_NULL)
+        return(_ux_utility_memory_allocate(pool -> ux_object_pool_memory_alignment,
+                                           pool -> ux_object_pool_memory_cache_flag,
+                                           pool -> ux_object_pool_object_size));
+
+    /* Clear the object, as memory allocate does.  */
+    _ux_utility_memory_set(object, 0, pool -> ux_object_pool_object_size); /* Use case of memset is verified. */
+
+    /* Return the object.  */
+    return(object);
+}
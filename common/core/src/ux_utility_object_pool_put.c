@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Utility                                                             */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_utility_object_pool_put                         PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function returns an object obtained by                         */ 
+/*    _ux_utility_object_pool_get. Objects of the pool are linked back to */ 
+/*    the pool free list in constant time, objects allocated while the    */ 
+/*    pool was exhausted are freed to the memory pool.                    */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    pool                                  Pointer to object pool        */ 
+/*    object                                Pointer to object             */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_interrupt_disable         Disable interrupts            */ 
+/*    _ux_utility_interrupt_restore         Restore interrupts            */ 
+/*    _ux_utility_memory_free               Free memory block             */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    USBX Components                                                     */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_utility_object_pool_put(UX_OBJECT_POOL *pool, VOID *object)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+
+    /* Object not from the pool, free it.  */
+    if ((UCHAR *)object < pool -> ux_object_pool_start || (UCHAR *)object >= pool -> ux_object_pool_end)
+    {
+        _ux_utility_memory_free(object);
+        return;
+    }
+
+    /* Push the object to the free list.  */
+    UX_DISABLE
+    *(VOID **)object =  pool -> ux_object_pool_free_list;
+    pool -> ux_object_pool_free_list =  object;
+    pool -> ux_object_pool_available ++;
+    UX_RESTORE
+}
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    ux_device_class_audio.h                             PORTABLE C      */
-/*                                                           6.2.1        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -65,6 +65,9 @@
 /*  03-08-2023     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
 /*                                            resulting in version 6.2.1  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added block samples read,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -88,6 +91,9 @@ extern   "C" {
 /* Compile option: if defined, audio interrupt endpoint is supported.  */
 /* #define UX_DEVICE_CLASS_AUDIO_INTERRUPT_SUPPORT  */
 
+/* Compile option: if defined, block samples read supports float format.  */
+/* #define UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT  */
+
 /* Internal option: enable the basic USBX error checking. This define is typically used
    while debugging application.  */
 #if defined(UX_ENABLE_ERROR_CHECKING) && !defined(UX_DEVICE_CLASS_AUDIO_ENABLE_ERROR_CHECKING)
@@ -396,6 +402,13 @@ typedef struct UX_DEVICE_CLASS_AUDIO_PARAMETER_STRUCT
 } UX_DEVICE_CLASS_AUDIO_PARAMETER;
 
 
+/* Define Audio Class block samples read formats.  */
+
+#define UX_DEVICE_CLASS_AUDIO_SAMPLES_COPY                          0
+#define UX_DEVICE_CLASS_AUDIO_SAMPLES_INT32                         1
+#define UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT                         2
+
+
 /* Define Audio Class instance structure.  */
 
 typedef struct UX_DEVICE_CLASS_AUDIO_FRAME_STRUCT
@@ -504,6 +517,8 @@ UINT    _ux_device_class_audio_sample_read8(UX_DEVICE_CLASS_AUDIO_STREAM *audio,
 UINT    _ux_device_class_audio_sample_read16(UX_DEVICE_CLASS_AUDIO_STREAM *audio, USHORT *sample);
 UINT    _ux_device_class_audio_sample_read24(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG *sample);
 UINT    _ux_device_class_audio_sample_read32(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG *sample);
+UINT    _ux_device_class_audio_samples_read(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG subframe_size, ULONG channels,
+                                            ULONG format, VOID **buffers, ULONG count, ULONG *actual_count);
 
 UINT    _ux_device_class_audio_read_frame_get(UX_DEVICE_CLASS_AUDIO_STREAM *audio, UCHAR **frame_data, ULONG *frame_length);
 UINT    _ux_device_class_audio_read_frame_free(UX_DEVICE_CLASS_AUDIO_STREAM *audio);
@@ -543,6 +558,8 @@ UINT    _uxe_device_class_audio_sample_read8(UX_DEVICE_CLASS_AUDIO_STREAM *audio
 UINT    _uxe_device_class_audio_sample_read16(UX_DEVICE_CLASS_AUDIO_STREAM *audio, USHORT *sample);
 UINT    _uxe_device_class_audio_sample_read24(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG *sample);
 UINT    _uxe_device_class_audio_sample_read32(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG *sample);
+UINT    _uxe_device_class_audio_samples_read(UX_DEVICE_CLASS_AUDIO_STREAM *audio, ULONG subframe_size, ULONG channels,
+                                             ULONG format, VOID **buffers, ULONG count, ULONG *actual_count);
 
 UINT    _uxe_device_class_audio_read_frame_get(UX_DEVICE_CLASS_AUDIO_STREAM *audio, UCHAR **frame_data, ULONG *frame_length);
 UINT    _uxe_device_class_audio_read_frame_free(UX_DEVICE_CLASS_AUDIO_STREAM *audio);
@@ -581,6 +598,7 @@ UINT    _uxe_device_class_audio_interrupt_send(UX_DEVICE_CLASS_AUDIO *audio, UCH
 #define ux_device_class_audio_sample_read16           _uxe_device_class_audio_sample_read16
 #define ux_device_class_audio_sample_read24           _uxe_device_class_audio_sample_read24
 #define ux_device_class_audio_sample_read32           _uxe_device_class_audio_sample_read32
+#define ux_device_class_audio_samples_read            _uxe_device_class_audio_samples_read
 
 #define ux_device_class_audio_read_frame_get          _uxe_device_class_audio_read_frame_get
 #define ux_device_class_audio_read_frame_free         _uxe_device_class_audio_read_frame_free
@@ -618,6 +636,7 @@ UINT    _uxe_device_class_audio_interrupt_send(UX_DEVICE_CLASS_AUDIO *audio, UCH
 #define ux_device_class_audio_sample_read16           _ux_device_class_audio_sample_read16
 #define ux_device_class_audio_sample_read24           _ux_device_class_audio_sample_read24
 #define ux_device_class_audio_sample_read32           _ux_device_class_audio_sample_read32
+#define ux_device_class_audio_samples_read            _ux_device_class_audio_samples_read
 
 #define ux_device_class_audio_read_frame_get          _ux_device_class_audio_read_frame_get
 #define ux_device_class_audio_read_frame_free         _ux_device_class_audio_read_frame_free
@@ -60,6 +60,9 @@
 /*                                            resulting in version 6.1.12 */
 /*  xx-xx-xxxx     Yajun xia                Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added queued bulk in        */
+/*                                            transfers,                  */
+/*                                            added scatter list write,   */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -87,6 +90,12 @@ extern   "C" {
 
 /* #define UX_DEVICE_CLASS_CDC_ACM_WRITE_AUTO_ZLP  */
 
+/* Define the alignment mask a buffer of _write_list must meet to be sent directly, without copy.  */
+
+#ifndef UX_DEVICE_CLASS_CDC_ACM_WRITE_LIST_ALIGN
+#define UX_DEVICE_CLASS_CDC_ACM_WRITE_LIST_ALIGN                        UX_ALIGN_MIN
+#endif
+
 /* Define CDC Class USB Class constants.  */
 #define UX_SLAVE_CLASS_CDC_ACM_CLASS                                    10
 
@@ -161,6 +170,7 @@ extern   "C" {
 
 /* Define event group flag.  */
 #define UX_DEVICE_CLASS_CDC_ACM_WRITE_EVENT                             1
+#define UX_DEVICE_CLASS_CDC_ACM_TRANSFER_EVENT                          2
 
 
 /* CDC ACM read state machine states.  */
@@ -182,6 +192,14 @@ typedef struct UX_SLAVE_CLASS_CDC_ACM_PARAMETER_STRUCT
 
 } UX_SLAVE_CLASS_CDC_ACM_PARAMETER;
 
+/* Define CDC ACM write list segment, see _ux_device_class_cdc_acm_write_list.  */
+
+typedef struct UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT_STRUCT
+{
+    UCHAR                               *ux_device_class_cdc_acm_write_segment_buffer;
+    ULONG                               ux_device_class_cdc_acm_write_segment_length;
+} UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT;
+
 /* Define CDC Class structure.  */
 
 typedef struct UX_SLAVE_CLASS_CDC_ACM_STRUCT
@@ -224,6 +242,10 @@ typedef struct UX_SLAVE_CLASS_CDC_ACM_STRUCT
     UX_EVENT_FLAGS_GROUP                ux_slave_class_cdc_acm_event_flags_group;
     UCHAR                               *ux_slave_class_cdc_acm_bulkin_thread_stack;
     UCHAR                               *ux_slave_class_cdc_acm_bulkout_thread_stack;
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+    UX_SLAVE_TRANSFER                   ux_slave_class_cdc_acm_bulkin_transfer_request;
+    UCHAR                               *ux_slave_class_cdc_acm_bulkin_buffer;
+#endif
 #endif
     UINT                                (*ux_device_class_cdc_acm_write_callback)(struct UX_SLAVE_CLASS_CDC_ACM_STRUCT *cdc_acm, UINT status, ULONG length);
     UINT                                (*ux_device_class_cdc_acm_read_callback)(struct UX_SLAVE_CLASS_CDC_ACM_STRUCT *cdc_acm, UINT status, UCHAR *data_pointer, ULONG length);
@@ -321,8 +343,12 @@ UINT  _ux_device_class_cdc_acm_ioctl(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, ULONG ioct
                                     VOID *parameter);
 VOID  _ux_device_class_cdc_acm_bulkin_thread(ULONG class_pointer);
 VOID  _ux_device_class_cdc_acm_bulkout_thread(ULONG class_pointer);
+UINT  _ux_device_class_cdc_acm_bulkin_queue(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_SLAVE_ENDPOINT *endpoint, ULONG *sent_length);
+VOID  _ux_device_class_cdc_acm_bulkin_transfer_complete(UX_SLAVE_TRANSFER *transfer_request);
 UINT  _ux_device_class_cdc_acm_write_with_callback(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR *buffer, 
                                 ULONG requested_length);
+UINT  _ux_device_class_cdc_acm_write_list(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT *segments,
+                                ULONG segment_count, ULONG *actual_length);
 
 UINT  _ux_device_class_cdc_acm_write_run(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR *buffer, 
                                 ULONG requested_length, ULONG *actual_length);
@@ -339,6 +365,8 @@ UINT  _uxe_device_class_cdc_acm_ioctl(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, ULONG ioc
                                     VOID *parameter);
 UINT  _uxe_device_class_cdc_acm_write_with_callback(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR *buffer,
                                     ULONG requested_length);
+UINT  _uxe_device_class_cdc_acm_write_list(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT *segments,
+                                    ULONG segment_count, ULONG *actual_length);
 UINT  _uxe_device_class_cdc_acm_write_run(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR *buffer,
                                 ULONG requested_length, ULONG *actual_length);
 UINT  _uxe_device_class_cdc_acm_read_run(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR *buffer,
@@ -353,6 +381,7 @@ UINT  _uxe_device_class_cdc_acm_read_run(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR
 #define ux_device_class_cdc_acm_write               _uxe_device_class_cdc_acm_write
 #define ux_device_class_cdc_acm_ioctl               _uxe_device_class_cdc_acm_ioctl
 #define ux_device_class_cdc_acm_write_with_callback _uxe_device_class_cdc_acm_write_with_callback
+#define ux_device_class_cdc_acm_write_list          _uxe_device_class_cdc_acm_write_list
 
 #define ux_device_class_cdc_acm_read_run            _uxe_device_class_cdc_acm_read_run
 #define ux_device_class_cdc_acm_write_run           _uxe_device_class_cdc_acm_write_run
@@ -363,6 +392,7 @@ UINT  _uxe_device_class_cdc_acm_read_run(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UCHAR
 #define ux_device_class_cdc_acm_write               _ux_device_class_cdc_acm_write
 #define ux_device_class_cdc_acm_ioctl               _ux_device_class_cdc_acm_ioctl
 #define ux_device_class_cdc_acm_write_with_callback _ux_device_class_cdc_acm_write_with_callback
+#define ux_device_class_cdc_acm_write_list          _ux_device_class_cdc_acm_write_list
 
 #define ux_device_class_cdc_acm_read_run            _ux_device_class_cdc_acm_read_run
 #define ux_device_class_cdc_acm_write_run           _ux_device_class_cdc_acm_write_run
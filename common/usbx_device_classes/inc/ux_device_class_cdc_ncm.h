@@ -0,0 +1,304 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   CDC_NCM Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  COMPONENT DEFINITION                                   RELEASE        */ 
+/*                                                                        */ 
+/*    ux_device_class_cdc_ncm.h                           PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This file defines the equivalences for the USBX Device Class        */ 
+/*    CDC_NCM component.                                                  */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef UX_DEVICE_CLASS_CDC_NCM_H
+#define UX_DEVICE_CLASS_CDC_NCM_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard 
+   C is used to process the API information.  */ 
+
+#ifdef   __cplusplus 
+
+/* Yes, C++ compiler is present.  Use standard C.  */ 
+extern   "C" { 
+
+#endif  
+
+#if !defined(UX_DEVICE_STANDALONE)
+#include "nx_api.h"
+#include "ux_network_driver.h"
+#else
+
+/* Assume NX definitions for compiling.  */
+#define NX_PACKET                                               VOID*
+/*
+UINT  _ux_network_driver_deactivate(VOID *ux_instance, VOID *ux_network_handle);
+VOID  _ux_network_driver_link_up(VOID *ux_network_handle);
+VOID  _ux_network_driver_link_down(VOID *ux_network_handle);
+*/
+#ifndef _ux_network_driver_deactivate
+#define _ux_network_driver_deactivate(a,b)                      do {} while(0)
+#endif
+#ifndef _ux_network_driver_link_up
+#define _ux_network_driver_link_up(a)                           do {} while(0)
+#endif
+#ifndef _ux_network_driver_link_down
+#define _ux_network_driver_link_down(a)                         do {} while(0)
+#endif
+#endif
+
+/* Define generic CDC_NCM equivalences.  */
+#define UX_DEVICE_CLASS_CDC_NCM_CLASS_COMMUNICATION_CONTROL                 0x02
+#define UX_DEVICE_CLASS_CDC_NCM_SUBCLASS_COMMUNICATION_CONTROL              0x0D
+#define UX_DEVICE_CLASS_CDC_NCM_CLASS_COMMUNICATION_DATA                    0x0A
+#define UX_DEVICE_CLASS_CDC_NCM_PROTOCOL_NTB                                0x01
+#define UX_DEVICE_CLASS_CDC_NCM_NEW_INTERRUPT_EVENT                         0x01
+#define UX_DEVICE_CLASS_CDC_NCM_NEW_BULKOUT_EVENT                           0x02
+#define UX_DEVICE_CLASS_CDC_NCM_NEW_BULKIN_EVENT                            0x04
+#define UX_DEVICE_CLASS_CDC_NCM_NEW_DEVICE_STATE_CHANGE_EVENT               0x08
+#define UX_DEVICE_CLASS_CDC_NCM_NETWORK_NOTIFICATION_EVENT                  0x10
+#define UX_DEVICE_CLASS_CDC_NCM_INTERRUPT_RESPONSE_LENGTH                   8
+#define UX_DEVICE_CLASS_CDC_NCM_MAX_CONTROL_RESPONSE_LENGTH                 256
+#define UX_DEVICE_CLASS_CDC_NCM_INTERRUPT_RESPONSE_AVAILABLE_FLAG           1
+#define UX_DEVICE_CLASS_CDC_NCM_MAX_MTU                                     1518
+#define UX_DEVICE_CLASS_CDC_NCM_ETHERNET_PACKET_SIZE                        1536
+#define UX_DEVICE_CLASS_CDC_NCM_ETHERNET_SIZE                               14
+#define UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH                              6
+#define UX_DEVICE_CLASS_CDC_NCM_VENDOR_DESCRIPTION_MAX_LENGTH               64
+#define UX_DEVICE_CLASS_CDC_NCM_MAX_FRAME_SIZE                              0x000005DC
+#define UX_DEVICE_CLASS_CDC_NCM_MAX_PACKET_LENGTH                           0x000005EA
+
+/* Device CDC_NCM Requests (ECM subset and NCM specific).  */
+#define UX_DEVICE_CLASS_CDC_NCM_SEND_ENCAPSULATED_COMMAND                   0x00
+#define UX_DEVICE_CLASS_CDC_NCM_GET_ENCAPSULATED_RESPONSE                   0x01
+#define UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_MULTICAST_FILTER               0x40
+#define UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_POWER_MANAGEMENT_FILTER        0x41
+#define UX_DEVICE_CLASS_CDC_NCM_GET_ETHERNET_POWER_MANAGEMENT_FILTER        0x42
+#define UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_PACKET_FILTER                  0x43
+#define UX_DEVICE_CLASS_CDC_NCM_GET_NTB_PARAMETERS                          0x80
+#define UX_DEVICE_CLASS_CDC_NCM_GET_NET_ADDRESS                             0x81
+#define UX_DEVICE_CLASS_CDC_NCM_SET_NET_ADDRESS                             0x82
+#define UX_DEVICE_CLASS_CDC_NCM_GET_NTB_FORMAT                              0x83
+#define UX_DEVICE_CLASS_CDC_NCM_SET_NTB_FORMAT                              0x84
+#define UX_DEVICE_CLASS_CDC_NCM_GET_NTB_INPUT_SIZE                          0x85
+#define UX_DEVICE_CLASS_CDC_NCM_SET_NTB_INPUT_SIZE                          0x86
+#define UX_DEVICE_CLASS_CDC_NCM_GET_MAX_DATAGRAM_SIZE                       0x87
+#define UX_DEVICE_CLASS_CDC_NCM_SET_MAX_DATAGRAM_SIZE                       0x88
+#define UX_DEVICE_CLASS_CDC_NCM_GET_CRC_MODE                                0x89
+#define UX_DEVICE_CLASS_CDC_NCM_SET_CRC_MODE                                0x8A
+
+/* Define NTB formats (wValue of SET_NTB_FORMAT, bmNtbFormatsSupported bits).  */
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_16                               0x0000
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_32                               0x0001
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_FORMATS_SUPPORTED                       0x0003
+
+/* Define NTB sizes. The NTBs are built in/parsed from the endpoint transfer
+   buffers, so the sizes can not exceed UX_SLAVE_REQUEST_DATA_MAX_LENGTH.
+   Note the NCM specification requires dwNtbInMaxSize of at least 2048.  */
+#ifndef UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE                             UX_SLAVE_REQUEST_DATA_MAX_LENGTH
+#endif
+#ifndef UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE                            UX_SLAVE_REQUEST_DATA_MAX_LENGTH
+#endif
+
+/* Define max number of datagrams packed in an IN NTB.  */
+#ifndef UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_DATAGRAMS
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_DATAGRAMS                        16
+#endif
+
+/* Define time (in ms) an IN NTB that is not full waits for more packets
+   before it is sent, 0 to send as soon as the transmit queue is empty.  */
+#ifndef UX_DEVICE_CLASS_CDC_NCM_NTB_FLUSH_TIMEOUT
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_FLUSH_TIMEOUT                           0
+#endif
+
+/* Define datagram alignment in NTBs (divisor, remainder and NDP alignment).  */
+#define UX_DEVICE_CLASS_CDC_NCM_NDP_DIVISOR                                 4
+#define UX_DEVICE_CLASS_CDC_NCM_NDP_PAYLOAD_REMAINDER                       0
+#define UX_DEVICE_CLASS_CDC_NCM_NDP_ALIGNMENT                               4
+#define UX_DEVICE_CLASS_CDC_NCM_ALIGN(offset)                               (((offset) + 3u) & ~3u)
+
+/* Define NTB parameter structure (GET_NTB_PARAMETERS response).  */
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_LENGTH                       28
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_LENGTH                     0
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_BM_NTB_FORMATS_SUPPORTED     2
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_DW_NTB_IN_MAX_SIZE           4
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_DIVISOR             8
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_PAYLOAD_REMAINDER   10
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_ALIGNMENT           12
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_DW_NTB_OUT_MAX_SIZE          16
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_DIVISOR            20
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_PAYLOAD_REMAINDER  22
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_ALIGNMENT          24
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NTB_OUT_MAX_DATAGRAMS      26
+
+/* Define NTB Header (NTH16/NTH32) layout.  */
+#define UX_DEVICE_CLASS_CDC_NCM_NTH16_SIGNATURE                             0x484D434E
+#define UX_DEVICE_CLASS_CDC_NCM_NTH32_SIGNATURE                             0x686D636E
+#define UX_DEVICE_CLASS_CDC_NCM_NTH16_LENGTH                                12
+#define UX_DEVICE_CLASS_CDC_NCM_NTH32_LENGTH                                16
+#define UX_DEVICE_CLASS_CDC_NCM_NTH_DW_SIGNATURE                            0
+#define UX_DEVICE_CLASS_CDC_NCM_NTH_W_HEADER_LENGTH                         4
+#define UX_DEVICE_CLASS_CDC_NCM_NTH_W_SEQUENCE                              6
+#define UX_DEVICE_CLASS_CDC_NCM_NTH_BLOCK_LENGTH                            8
+#define UX_DEVICE_CLASS_CDC_NCM_NTH16_W_NDP_INDEX                           10
+#define UX_DEVICE_CLASS_CDC_NCM_NTH32_DW_NDP_INDEX                          12
+
+/* Define NTB Datagram Pointer table (NDP16/NDP32) layout.  */
+#define UX_DEVICE_CLASS_CDC_NCM_NDP16_SIGNATURE                             0x304D434E
+#define UX_DEVICE_CLASS_CDC_NCM_NDP16_CRC_SIGNATURE                         0x314D434E
+#define UX_DEVICE_CLASS_CDC_NCM_NDP32_SIGNATURE                             0x306D636E
+#define UX_DEVICE_CLASS_CDC_NCM_NDP32_CRC_SIGNATURE                         0x316D636E
+#define UX_DEVICE_CLASS_CDC_NCM_NDP16_HEADER_LENGTH                         8
+#define UX_DEVICE_CLASS_CDC_NCM_NDP32_HEADER_LENGTH                         16
+#define UX_DEVICE_CLASS_CDC_NCM_NDP16_ENTRY_LENGTH                          4
+#define UX_DEVICE_CLASS_CDC_NCM_NDP32_ENTRY_LENGTH                          8
+#define UX_DEVICE_CLASS_CDC_NCM_NDP_DW_SIGNATURE                            0
+#define UX_DEVICE_CLASS_CDC_NCM_NDP_W_LENGTH                                4
+#define UX_DEVICE_CLASS_CDC_NCM_NDP16_W_NEXT_NDP_INDEX                      6
+#define UX_DEVICE_CLASS_CDC_NCM_NDP32_DW_NEXT_NDP_INDEX                     8
+
+/* Define max number of NDPs parsed in an OUT NTB.  */
+#define UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_NDPS                            8
+
+/* Define LINK statess.  */
+#define UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_DOWN                             0
+#define UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_UP                               1
+#define UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_PENDING_UP                       2
+#define UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_PENDING_DOWN                     3
+
+/* Define timeout packet allocation value.  */
+#ifndef UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_WAIT
+#define UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_WAIT                            1000
+#endif
+
+#ifndef UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_INST_WAIT
+#define UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_INST_WAIT                       1000
+#endif
+
+#define UX_DEVICE_CLASS_CDC_NCM_LINK_CHECK_WAIT                             10
+
+/* Define Slave CDC_NCM Class Calling Parameter structure */
+
+typedef struct UX_SLAVE_CLASS_CDC_NCM_PARAMETER_STRUCT
+{
+    VOID                    (*ux_slave_class_cdc_ncm_instance_activate)(VOID *);
+    VOID                    (*ux_slave_class_cdc_ncm_instance_deactivate)(VOID *);
+    ULONG                   ux_slave_class_cdc_ncm_parameter_media;
+    ULONG                   ux_slave_class_cdc_ncm_parameter_vendor_id;
+    ULONG                   ux_slave_class_cdc_ncm_parameter_driver_version;
+    UCHAR                   ux_slave_class_cdc_ncm_parameter_vendor_description[UX_DEVICE_CLASS_CDC_NCM_VENDOR_DESCRIPTION_MAX_LENGTH];
+    UCHAR                   ux_slave_class_cdc_ncm_parameter_local_node_id[UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH];
+    UCHAR                   ux_slave_class_cdc_ncm_parameter_remote_node_id[UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH];
+} UX_SLAVE_CLASS_CDC_NCM_PARAMETER;
+
+/* Define CDC_NCM Class structure.  */
+
+typedef struct UX_SLAVE_CLASS_CDC_NCM_STRUCT
+{
+    UX_SLAVE_INTERFACE                      *ux_slave_class_cdc_ncm_interface;
+    UX_SLAVE_CLASS_CDC_NCM_PARAMETER        ux_slave_class_cdc_ncm_parameter;
+    UX_SLAVE_ENDPOINT                       *ux_slave_class_cdc_ncm_bulkin_endpoint;
+    UX_SLAVE_ENDPOINT                       *ux_slave_class_cdc_ncm_bulkout_endpoint;
+    UX_SLAVE_ENDPOINT                       *ux_slave_class_cdc_ncm_interrupt_endpoint;
+    ULONG                                   ux_slave_class_cdc_ncm_state;
+    ULONG                                   ux_slave_class_cdc_ncm_current_alternate_setting;
+    ULONG                                   ux_slave_class_cdc_ncm_ntb_format;
+    ULONG                                   ux_slave_class_cdc_ncm_ntb_in_size;
+    ULONG                                   ux_slave_class_cdc_ncm_ntb_in_sequence;
+    ULONG                                   ux_slave_class_cdc_ncm_statistics_xmit_ok;
+    ULONG                                   ux_slave_class_cdc_ncm_statistics_rcv_ok;
+    ULONG                                   ux_slave_class_cdc_ncm_statistics_xmit_error;
+    ULONG                                   ux_slave_class_cdc_ncm_statistics_rcv_error;
+    ULONG                                   ux_slave_class_cdc_ncm_statistics_rcv_no_buffer;
+    ULONG                                   ux_slave_class_cdc_ncm_ethernet_multicast_filter;
+    ULONG                                   ux_slave_class_cdc_ncm_ethernet_power_management_filter;
+    ULONG                                   ux_slave_class_cdc_ncm_ethernet_packet_filter;
+    UCHAR                                   ux_slave_class_cdc_ncm_local_node_id[UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH];
+    UCHAR                                   ux_slave_class_cdc_ncm_remote_node_id[UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH];
+
+#if !defined(UX_DEVICE_STANDALONE)
+    NX_IP                                   *ux_slave_class_cdc_ncm_nx_ip;
+    NX_INTERFACE                            *ux_slave_class_cdc_ncm_nx_interface;
+    NX_PACKET                               *ux_slave_class_cdc_ncm_xmit_queue;
+    NX_PACKET                               *ux_slave_class_cdc_ncm_xmit_queue_tail;
+    NX_PACKET_POOL                          *ux_slave_class_cdc_ncm_packet_pool;
+#endif
+
+#if !defined(UX_DEVICE_STANDALONE)
+    UX_EVENT_FLAGS_GROUP                    ux_slave_class_cdc_ncm_event_flags_group;
+    UX_THREAD                               ux_slave_class_cdc_ncm_bulkin_thread;
+    UX_THREAD                               ux_slave_class_cdc_ncm_bulkout_thread;
+    UX_THREAD                               ux_slave_class_cdc_ncm_interrupt_thread;
+    UX_MUTEX                                ux_slave_class_cdc_ncm_mutex;
+    UCHAR                                   *ux_slave_class_cdc_ncm_bulkin_thread_stack;
+    UCHAR                                   *ux_slave_class_cdc_ncm_bulkout_thread_stack;
+    UCHAR                                   *ux_slave_class_cdc_ncm_interrupt_thread_stack;
+#endif
+
+    ULONG                                   ux_slave_class_cdc_ncm_link_state;
+    VOID                                    *ux_slave_class_cdc_ncm_network_handle;
+
+} UX_SLAVE_CLASS_CDC_NCM;
+
+
+/* Define Device CDC_NCM Class prototypes.  */
+
+UINT  _ux_device_class_cdc_ncm_activate(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_control_request(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_deactivate(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_change(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_entry(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_initialize(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_uninitialize(UX_SLAVE_CLASS_COMMAND *command);
+UINT  _ux_device_class_cdc_ncm_write(VOID *cdc_ncm_class, NX_PACKET *packet);
+UINT  _ux_device_class_cdc_ncm_ntb_receive(UX_SLAVE_CLASS_CDC_NCM *cdc_ncm, UCHAR *ntb, ULONG ntb_length);
+VOID  _ux_device_class_cdc_ncm_bulkin_thread(ULONG cdc_ncm_class);
+VOID  _ux_device_class_cdc_ncm_bulkout_thread(ULONG cdc_ncm_class);
+VOID  _ux_device_class_cdc_ncm_interrupt_thread(ULONG cdc_ncm_class);
+
+
+/* Define Device CDC Class API prototypes.  */
+
+#define ux_device_class_cdc_ncm_entry    _ux_device_class_cdc_ncm_entry
+#define ux_device_class_cdc_ncm_write    _ux_device_class_cdc_ncm_write
+
+/* Determine if a C++ compiler is being used.  If so, complete the standard 
+   C conditional started above.  */   
+#ifdef __cplusplus
+} 
+#endif 
+
+#endif /* UX_DEVICE_CLASS_CDC_NCM_H */
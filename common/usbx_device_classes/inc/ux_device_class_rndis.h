@@ -57,6 +57,7 @@
 /*                                            resulting in version 6.2.0  */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            improved error checking,    */
+/*                                            added packets aggregation,  */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -166,9 +167,19 @@ VOID  _ux_network_driver_link_down(VOID *ux_network_handle);
 /* Define RNDIS Medium supported by the device. */
 #define UX_DEVICE_CLASS_RNDIS_MEDIUM_SUPPORTED                                  0x00000000
 
-/* Define RNDIS Packet size and types supported.  */
+/* Define RNDIS Packet size and types supported.
+   With more than one packet per transfer, several REMOTE_NDIS_PACKET_MSG are concatenated
+   in one bulk transfer (up to the MaxTransferSize negotiated), in both directions.  */
+#ifndef UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER
 #define UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER                           0x00000001
+#endif
+#ifndef UX_DEVICE_CLASS_RNDIS_MAX_PACKET_TRANSFER_SIZE
+#if UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER > 1
+#define UX_DEVICE_CLASS_RNDIS_MAX_PACKET_TRANSFER_SIZE                          UX_SLAVE_REQUEST_DATA_MAX_LENGTH
+#else
 #define UX_DEVICE_CLASS_RNDIS_MAX_PACKET_TRANSFER_SIZE                          0x00000640
+#endif
+#endif
 #define UX_DEVICE_CLASS_RNDIS_PACKET_ALIGNEMENT_FACTOR                          0x00000003
 #define UX_DEVICE_CLASS_RNDIS_MAX_FRAME_SIZE                                    0x000005DC
 #define UX_DEVICE_CLASS_RNDIS_MAX_PACKET_LENGTH                                 0x000005EA
@@ -424,6 +435,9 @@ VOID  _ux_network_driver_link_down(VOID *ux_network_handle);
 #define UX_DEVICE_CLASS_RNDIS_PACKET_BUFFER                                     0x0000002C
 #define UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH                              0x0000002C
 
+/* Define RNDIS concatenated messages alignment (4 bytes).  */
+#define UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_ALIGN(len)                         (((len) + 3u) & ~3u)
+
 /* Define NetX errors inside the RNDIS class.  */
 #define UX_DEVICE_CLASS_RNDIS_NX_SUCCESS                                        0x00
 #define UX_DEVICE_CLASS_RNDIS_NX_NO_PACKET                                      0x01
@@ -494,6 +508,16 @@ VOID  _ux_network_driver_link_down(VOID *ux_network_handle);
 /* Checked in _initialize().  */
 #endif
 
+/* Calculate bulk OUT transfer length, it may contain several messages.  */
+#if UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER > 1
+#define UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH                                UX_DEVICE_CLASS_RNDIS_MAX_PACKET_TRANSFER_SIZE
+#if UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH > UX_SLAVE_REQUEST_DATA_MAX_LENGTH
+/* Checked in _initialize().  */
+#endif
+#else
+#define UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH                                UX_DEVICE_CLASS_RNDIS_MAX_MSG_LENGTH
+#endif
+
 /* Calculate response buffer length.  */
 #define UX_DEVICE_CLASS_RNDIS_OID_SUPPORTED_RESPONSE_LENGTH             (UX_DEVICE_CLASS_RNDIS_CMPLT_QUERY_INFO_BUFFER + UX_DEVICE_CLASS_RNDIS_OID_SUPPORTED_LIST_LENGTH * 4)
 #define UX_DEVICE_CLASS_RNDIS_VENDOR_DESCRIPTION_MAX_RESPONSE_LENGTH    (UX_DEVICE_CLASS_RNDIS_CMPLT_QUERY_INFO_BUFFER + UX_DEVICE_CLASS_RNDIS_VENDOR_DESCRIPTION_MAX_LENGTH)
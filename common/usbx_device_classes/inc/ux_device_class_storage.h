@@ -59,6 +59,7 @@
 /*                                            resulting in version 6.1.10 */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added error checks support, */
+/*                                            added RTOS double buffer,   */
 /*                                            resulting in version 6.1.10 */
 /*                                                                        */
 /**************************************************************************/
@@ -454,6 +455,20 @@ extern   "C" {
 #define UX_SLAVE_CLASS_STORAGE_PAGE_CODE_IEC                            0x1C
 #define UX_SLAVE_CLASS_STORAGE_PAGE_CODE_ALL                            0x3F
 
+/* Define Device Storage Class double buffer support, used in RTOS mode only
+   (standalone mode always overlaps media and USB accesses).  */
+#if defined(UX_DEVICE_STANDALONE) && defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+#undef UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE
+#endif
+
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+/* Define Device Storage Class media operations handled by the media thread.  */
+
+#define UX_DEVICE_CLASS_STORAGE_MEDIA_READ              1
+#define UX_DEVICE_CLASS_STORAGE_MEDIA_WRITE             2
+#endif
+
 #if defined(UX_DEVICE_STANDALONE)
 
 /* Define Device Storage Class states.  */
@@ -566,6 +581,21 @@ typedef struct UX_SLAVE_CLASS_STORAGE_STRUCT
     ULONG                       ux_device_class_storage_media_status;
 #endif
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+    UX_THREAD                   ux_device_class_storage_media_thread;
+    UCHAR                       *ux_device_class_storage_media_thread_stack;
+    UX_SEMAPHORE                ux_device_class_storage_media_request_semaphore;
+    UX_SEMAPHORE                ux_device_class_storage_media_done_semaphore;
+
+    ULONG                       ux_device_class_storage_media_op;
+    ULONG                       ux_device_class_storage_media_op_lun;
+    UCHAR                       *ux_device_class_storage_media_op_buffer;
+    ULONG                       ux_device_class_storage_media_op_n_lb;
+    ULONG                       ux_device_class_storage_media_op_lba;
+    UINT                        ux_device_class_storage_media_op_status;
+    ULONG                       ux_device_class_storage_media_op_media_status;
+#endif
+
 } UX_SLAVE_CLASS_STORAGE;
 
 #define UX_DEVICE_CLASS_STORAGE_CSW_STATUS(p)               (((UCHAR*)(p))[0])
@@ -620,6 +650,10 @@ UINT    _ux_device_class_storage_start_stop(UX_SLAVE_CLASS_STORAGE *storage, ULO
 UINT    _ux_device_class_storage_test_ready(UX_SLAVE_CLASS_STORAGE *storage, ULONG lun, UX_SLAVE_ENDPOINT *endpoint_in,
                     UX_SLAVE_ENDPOINT *endpoint_out, UCHAR *cbwcb);
 VOID    _ux_device_class_storage_thread(ULONG storage_instance);
+VOID    _ux_device_class_storage_media_thread(ULONG storage_instance);
+VOID    _ux_device_class_storage_media_request(UX_SLAVE_CLASS_STORAGE *storage, ULONG op, ULONG lun,
+                    UCHAR *buffer, ULONG number_blocks, ULONG lba);
+UINT    _ux_device_class_storage_media_wait(UX_SLAVE_CLASS_STORAGE *storage, ULONG *media_status);
 UINT    _ux_device_class_storage_verify(UX_SLAVE_CLASS_STORAGE *storage, ULONG lun, UX_SLAVE_ENDPOINT *endpoint_in,
                     UX_SLAVE_ENDPOINT *endpoint_out, UCHAR *cbwcb);
 UINT    _ux_device_class_storage_write(UX_SLAVE_CLASS_STORAGE *storage, ULONG lun, UX_SLAVE_ENDPOINT *endpoint_in,
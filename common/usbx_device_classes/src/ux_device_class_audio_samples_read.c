@@ -0,0 +1,373 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device Audio Class                                                  */
+/**                                                                       */
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_audio.h"
+#include "ux_device_stack.h"
+
+
+/* Get a little-endian sample of 1 to 4 bytes, left-justified in 32 bits.
+   The size is a constant in each use so the unused terms fold away.  */
+#define UX_DEVICE_CLASS_AUDIO_SAMPLE_LEFT_JUSTIFY(p, size)                      \
+    ((LONG)(signed char)(p)[(size) - 1] * 0x1000000 + (LONG)                    \
+        ((((size) > 1) ? ((ULONG)(p)[(size) - 2] << 16) : 0) |                  \
+         (((size) > 2) ? ((ULONG)(p)[(size) - 3] << 8) : 0) |                   \
+         (((size) > 3) ? ((ULONG)(p)[0]) : 0)))
+
+/* Save a run of samples of the given size, one channel at a time.  */
+#if defined(UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT)
+#define UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(size)                                \
+    if (format == UX_DEVICE_CLASS_AUDIO_SAMPLES_COPY)                           \
+    {                                                                           \
+        for (i = 0; i < frame_count; i ++)                                      \
+            for (j = 0; j < (size); j ++)                                       \
+                copy_buffer[i * (size) + j] = sample_ptr[i * stride + j];       \
+    }                                                                           \
+    else if (format == UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT)                     \
+    {                                                                           \
+        for (i = 0; i < frame_count; i ++)                                      \
+            float_buffer[i] = (float)UX_DEVICE_CLASS_AUDIO_SAMPLE_LEFT_JUSTIFY( \
+                                sample_ptr + i * stride, (size)) *              \
+                                (1.0f / 2147483648.0f);                         \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        for (i = 0; i < frame_count; i ++)                                      \
+            int32_buffer[i] = UX_DEVICE_CLASS_AUDIO_SAMPLE_LEFT_JUSTIFY(        \
+                                sample_ptr + i * stride, (size));               \
+    }
+#else
+#define UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(size)                                \
+    if (format == UX_DEVICE_CLASS_AUDIO_SAMPLES_COPY)                           \
+    {                                                                           \
+        for (i = 0; i < frame_count; i ++)                                      \
+            for (j = 0; j < (size); j ++)                                       \
+                copy_buffer[i * (size) + j] = sample_ptr[i * stride + j];       \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        for (i = 0; i < frame_count; i ++)                                      \
+            int32_buffer[i] = UX_DEVICE_CLASS_AUDIO_SAMPLE_LEFT_JUSTIFY(        \
+                                sample_ptr + i * stride, (size));               \
+    }
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_audio_samples_read                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reads a block of samples from the Audio class. It     */
+/*    gives the same data as calling _ux_device_class_audio_sample_read8  */
+/*    to 32 once per sample, but checks the stream once and copies whole  */
+/*    runs of samples out of each received frame.                         */
+/*                                                                        */
+/*    The stream carries channels interleaved samples per audio frame,    */
+/*    each subframe_size bytes (1 to 4). Samples of each channel are      */
+/*    saved to buffers[channel], so the audio frames are deinterleaved.   */
+/*    Use channels 1 to read all samples in stream order to buffers[0].   */
+/*                                                                        */
+/*    The samples are saved in one of the following formats:              */
+/*      UX_DEVICE_CLASS_AUDIO_SAMPLES_COPY   subframe_size bytes each, as */
+/*                                           received                     */
+/*      UX_DEVICE_CLASS_AUDIO_SAMPLES_INT32  signed LONG each, sample is  */
+/*                                           left-justified in 32 bits    */
+/*      UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT  float each, in [-1.0, 1.0)   */
+/*    The float format is available if                                   */
+/*    UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT is defined.             */
+/*                                                                        */
+/*    Reading stops when count audio frames are read or when no more data */
+/*    is received. Bytes left in a received frame that do not make a      */
+/*    whole audio frame are dropped.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    stream                                Address of audio stream       */
+/*                                            instance                    */
+/*    subframe_size                         Bytes per sample in stream    */
+/*    channels                              Number of channels            */
+/*    format                                Format of saved samples       */
+/*    buffers                               Array of channels buffers to  */
+/*                                            save sample data            */
+/*    count                                 Number of audio frames to     */
+/*                                            read                        */
+/*    actual_count                          Number of audio frames read   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_copy               Copy memory                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT _ux_device_class_audio_samples_read(UX_DEVICE_CLASS_AUDIO_STREAM *stream,
+                                         ULONG subframe_size, ULONG channels,
+                                         ULONG format, VOID **buffers,
+                                         ULONG count, ULONG *actual_count)
+{
+
+UX_SLAVE_ENDPOINT           *endpoint;
+UX_SLAVE_DEVICE             *device;
+UX_DEVICE_CLASS_AUDIO_FRAME *frame;
+UCHAR                       *sample_ptr;
+UCHAR                       *copy_buffer;
+LONG                        *int32_buffer;
+#if defined(UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT)
+float                       *float_buffer;
+#endif
+UCHAR                       *next_frame_buffer;
+ULONG                       next_frame_sample;
+ULONG                       stride;
+ULONG                       frame_count;
+ULONG                       done;
+ULONG                       channel;
+ULONG                       i;
+ULONG                       j;
+
+
+    /* Nothing read yet.  */
+    if (actual_count)
+        *actual_count = 0;
+
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+
+    /* As long as the device is in the CONFIGURED state.  */
+    if (device -> ux_slave_device_state != UX_DEVICE_CONFIGURED)
+    {
+
+        /* Cannot proceed with command, the interface is down.  */
+        return(UX_CONFIGURATION_HANDLE_UNKNOWN);
+    }
+
+    /* Check if endpoint is available.  */
+    endpoint = stream -> ux_device_class_audio_stream_endpoint;
+    if (endpoint == UX_NULL)
+        return(UX_ERROR);
+
+    /* Check if endpoint direction is OK.  */
+    if ((endpoint -> ux_slave_endpoint_descriptor.bEndpointAddress & UX_ENDPOINT_DIRECTION) != UX_ENDPOINT_OUT)
+        return(UX_ERROR);
+
+    /* Bytes of an audio frame in stream.  */
+    stride = subframe_size * channels;
+
+    /* Read frame by frame.  */
+    done = 0;
+    while (done < count)
+    {
+
+        /* Underflow!!  */
+        frame = stream -> ux_device_class_audio_stream_access_pos;
+        if (frame -> ux_device_class_audio_frame_length == 0)
+            break;
+
+        /* Audio frames available in this frame buffer.  */
+        frame_count = (frame -> ux_device_class_audio_frame_length -
+                       frame -> ux_device_class_audio_frame_pos) / stride;
+        if (frame_count > count - done)
+            frame_count = count - done;
+
+        /* Save samples, channel by channel.  */
+        for (channel = 0; channel < channels; channel ++)
+        {
+            sample_ptr = frame -> ux_device_class_audio_frame_data +
+                            frame -> ux_device_class_audio_frame_pos +
+                            channel * subframe_size;
+
+            /* Same layout, copy the run at once.  */
+            if ((format == UX_DEVICE_CLASS_AUDIO_SAMPLES_COPY) && (channels == 1))
+            {
+                _ux_utility_memory_copy((UCHAR *)buffers[0] + done * subframe_size,
+                                        sample_ptr, frame_count * subframe_size); /* Use case of memcpy is verified. */
+                continue;
+            }
+
+            copy_buffer = (UCHAR *)buffers[channel] + done * subframe_size;
+            int32_buffer = (LONG *)buffers[channel] + done;
+#if defined(UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT)
+            float_buffer = (float *)buffers[channel] + done;
+#endif
+
+            /* Save with the size fixed, so the loops can be vectorized.  */
+            switch(subframe_size)
+            {
+            case 1:
+                UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(1)
+                break;
+
+            case 2:
+                UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(2)
+                break;
+
+            case 3:
+                UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(3)
+                break;
+
+            default:
+                UX_DEVICE_CLASS_AUDIO_SAMPLES_SAVE(4)
+                break;
+            }
+        }
+        done += frame_count;
+
+        /* Update sample read state, as _ux_device_class_audio_sample_read16.  */
+        next_frame_sample = frame -> ux_device_class_audio_frame_pos + frame_count * stride;
+        if (next_frame_sample + stride > frame -> ux_device_class_audio_frame_length)
+        {
+
+            /* Set frame length to 0 to indicate no data.  */
+            frame -> ux_device_class_audio_frame_length = 0;
+
+            /* Move to next frame buffer.  */
+            next_frame_sample = 0;
+
+            /* Move frame if it's not the last one.  */
+            if (frame != stream -> ux_device_class_audio_stream_transfer_pos)
+            {
+                next_frame_buffer = (UCHAR *)frame;
+                next_frame_buffer += stream -> ux_device_class_audio_stream_frame_buffer_size;
+                if (next_frame_buffer >= stream -> ux_device_class_audio_stream_buffer + stream -> ux_device_class_audio_stream_buffer_size)
+                    next_frame_buffer = stream -> ux_device_class_audio_stream_buffer;
+                stream -> ux_device_class_audio_stream_access_pos = (UX_DEVICE_CLASS_AUDIO_FRAME *)next_frame_buffer;
+            }
+        }
+
+        /* Update next sample position.  */
+        stream -> ux_device_class_audio_stream_access_pos -> ux_device_class_audio_frame_pos = next_frame_sample;
+    }
+
+    /* Return number of audio frames read.  */
+    if (actual_count)
+        *actual_count = done;
+
+    /* Underflow before anything is read.  */
+    if (done == 0 && count != 0)
+        return(UX_BUFFER_OVERFLOW);
+
+    return(UX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_device_class_audio_samples_read                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in reading block of samples function    */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    stream                                Address of audio stream       */
+/*                                            instance                    */
+/*    subframe_size                         Bytes per sample in stream    */
+/*    channels                              Number of channels            */
+/*    format                                Format of saved samples       */
+/*    buffers                               Array of channels buffers to  */
+/*                                            save sample data            */
+/*    count                                 Number of audio frames to     */
+/*                                            read                        */
+/*    actual_count                          Number of audio frames read   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_device_class_audio_samples_read   Read block of samples         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT _uxe_device_class_audio_samples_read(UX_DEVICE_CLASS_AUDIO_STREAM *stream,
+                                          ULONG subframe_size, ULONG channels,
+                                          ULONG format, VOID **buffers,
+                                          ULONG count, ULONG *actual_count)
+{
+
+ULONG       channel;
+
+
+    /* Sanity check.  */
+    if ((stream == UX_NULL) || (buffers == UX_NULL) ||
+        (subframe_size == 0) || (subframe_size > 4) || (channels == 0))
+        return(UX_INVALID_PARAMETER);
+
+    /* Check format.  */
+#if defined(UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT_SUPPORT)
+    if (format > UX_DEVICE_CLASS_AUDIO_SAMPLES_FLOAT)
+#else
+    if (format > UX_DEVICE_CLASS_AUDIO_SAMPLES_INT32)
+#endif
+        return(UX_INVALID_PARAMETER);
+
+    /* Check buffers.  */
+    for (channel = 0; channel < channels; channel ++)
+    {
+        if (buffers[channel] == UX_NULL)
+            return(UX_INVALID_PARAMETER);
+    }
+
+    /* Read block of samples.  */
+    return(_ux_device_class_audio_samples_read(stream, subframe_size, channels,
+                                               format, buffers, count, actual_count));
+}
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device CDC_ACM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_acm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_CLASS_CDC_ACM_TRANSMISSION_DISABLE) && !defined(UX_DEVICE_STANDALONE) && defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_cdc_acm_bulkin_queue               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the buffer of a transmission started by         */
+/*    _ux_device_class_cdc_acm_write_with_callback with two queued        */
+/*    transfer requests, so that the next slice is copied while the       */
+/*    previous one is sent and the pipe does not go idle between slices.  */
+/*                                                                        */
+/*    If the DCD does not support transfer queues UX_FUNCTION_NOT_SUPPORTED*/
+/*    is returned before anything is sent.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_acm                               Address of cdc_acm class      */
+/*                                            instance                    */
+/*    endpoint                              Bulk in endpoint              */
+/*    sent_length                           Destination of sent length    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_device_stack_transfer_queue       Queue transfer                */
+/*    _ux_utility_event_flags_get           Get event flags               */
+/*    _ux_utility_memory_copy               Copy memory                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Device CDC-ACM Class                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_class_cdc_acm_bulkin_queue(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_SLAVE_ENDPOINT *endpoint, ULONG *sent_length)
+{
+
+UX_SLAVE_TRANSFER       *transfer_requests[2];
+UX_SLAVE_TRANSFER       *transfer_request;
+UINT                    status;
+ULONG                   actual_flags;
+ULONG                   total_length;
+ULONG                   transfer_length;
+ULONG                   host_length;
+ULONG                   next_index;
+ULONG                   queued;
+
+
+    /* Prepare the two transfer requests: the endpoint one and the class one.  */
+    transfer_requests[0] =  &endpoint -> ux_slave_endpoint_transfer_request;
+    transfer_requests[1] =  &cdc_acm -> ux_slave_class_cdc_acm_bulkin_transfer_request;
+    transfer_requests[1] -> ux_slave_transfer_request_endpoint =  endpoint;
+    transfer_requests[1] -> ux_slave_transfer_request_data_pointer =  cdc_acm -> ux_slave_class_cdc_acm_bulkin_buffer;
+    transfer_requests[0] -> ux_slave_transfer_request_completion_function =  _ux_device_class_cdc_acm_bulkin_transfer_complete;
+    transfer_requests[1] -> ux_slave_transfer_request_completion_function =  _ux_device_class_cdc_acm_bulkin_transfer_complete;
+
+    /* Clear completion events left from previous transmission.  */
+    _ux_utility_event_flags_get(&cdc_acm -> ux_slave_class_cdc_acm_event_flags_group, UX_DEVICE_CLASS_CDC_ACM_TRANSFER_EVENT,
+                                UX_OR_CLEAR, &actual_flags, UX_NO_WAIT);
+
+    /* Get the length of the entire buffer to send.  */
+    total_length =  cdc_acm -> ux_slave_class_cdc_acm_callback_total_length;
+    host_length =  UX_SLAVE_REQUEST_DATA_MAX_LENGTH;
+    *sent_length =  0;
+    next_index =  0;
+    queued =  0;
+    status =  UX_SUCCESS;
+
+    while (1)
+    {
+
+        /* Copy and queue the next slice while a request is free.  */
+        if ((total_length != 0) && (status == UX_SUCCESS) && (queued < 2))
+        {
+
+            /* Check the length remaining to send, the last slice may need a ZLP.  */
+            if (total_length > UX_SLAVE_REQUEST_DATA_MAX_LENGTH)
+                transfer_length =  UX_SLAVE_REQUEST_DATA_MAX_LENGTH;
+            else
+            {
+                transfer_length =  total_length;
+#if !defined(UX_DEVICE_CLASS_CDC_ACM_WRITE_AUTO_ZLP)
+                host_length =  total_length;
+#else
+                host_length =  UX_SLAVE_REQUEST_DATA_MAX_LENGTH + 1;
+#endif
+            }
+
+            /* Copy the payload locally.  */
+            transfer_request =  transfer_requests[next_index];
+            _ux_utility_memory_copy(transfer_request -> ux_slave_transfer_request_data_pointer,
+                                    cdc_acm -> ux_slave_class_cdc_acm_callback_current_data_pointer,
+                                    transfer_length); /* Use case of memcpy is verified. */
+
+            /* Queue the slice.  */
+            status =  _ux_device_stack_transfer_queue(transfer_request, transfer_length, host_length);
+            if (status == UX_SUCCESS)
+            {
+                queued++;
+                next_index ^=  1;
+                total_length -=  transfer_length;
+                cdc_acm -> ux_slave_class_cdc_acm_callback_current_data_pointer +=  transfer_length;
+            }
+            continue;
+        }
+
+        /* Done when nothing is in flight.  */
+        if (queued == 0)
+            break;
+
+        /* Wait for the oldest request.  */
+        transfer_request =  transfer_requests[(queued == 2) ? next_index : next_index ^ 1];
+        while (transfer_request -> ux_slave_transfer_request_status == UX_TRANSFER_STATUS_PENDING)
+            _ux_utility_event_flags_get(&cdc_acm -> ux_slave_class_cdc_acm_event_flags_group, UX_DEVICE_CLASS_CDC_ACM_TRANSFER_EVENT,
+                                        UX_OR_CLEAR, &actual_flags, UX_WAIT_FOREVER);
+        queued--;
+
+        /* Check the completion code, stop queueing on error.  */
+        if (transfer_request -> ux_slave_transfer_request_completion_code != UX_SUCCESS)
+        {
+            if (status == UX_SUCCESS)
+                status =  transfer_request -> ux_slave_transfer_request_completion_code;
+        }
+        else
+            *sent_length +=  transfer_request -> ux_slave_transfer_request_requested_length;
+    }
+
+    /* The endpoint request is used without completion function by other paths.  */
+    transfer_requests[0] -> ux_slave_transfer_request_completion_function =  UX_NULL;
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
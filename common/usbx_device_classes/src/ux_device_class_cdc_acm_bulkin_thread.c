@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_device_class_cdc_acm_bulkin_thread              PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,6 +60,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _ux_device_stack_transfer_request     Request transfer              */
+/*    _ux_device_class_cdc_acm_bulkin_queue Send with queued transfers    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -92,6 +93,10 @@
 /*                                            names conflict C++ keyword, */
 /*                                            added auto ZLP support,     */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used queued transfers when  */
+/*                                            supported,                  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_device_class_cdc_acm_bulkin_thread(ULONG cdc_acm_class)
@@ -167,6 +172,14 @@ ULONG                           sent_length;
                 else
                 {
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+
+                    /* Keep the pipe busy with queued transfers, if supported by the DCD.  */
+                    status =  _ux_device_class_cdc_acm_bulkin_queue(cdc_acm, endpoint, &sent_length);
+                    if (status != UX_FUNCTION_NOT_SUPPORTED)
+                        total_length =  0;
+#endif
+
                     /* We should send the total length.  But we may have a case of ZLP. */
                     host_length = UX_SLAVE_REQUEST_DATA_MAX_LENGTH;
                     while (total_length)
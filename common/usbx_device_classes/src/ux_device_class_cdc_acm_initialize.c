@@ -37,7 +37,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_cdc_acm_initialize                 PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -87,6 +87,10 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            allocated second bulk in    */
+/*                                            buffer for queued transfers,*/
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_class_cdc_acm_initialize(UX_SLAVE_CLASS_COMMAND *command)
@@ -200,6 +204,21 @@ UINT                                    status;
         }
     }
 
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+
+    /* If success, go on to allocate the second bulk in buffer, so that a slice is
+       copied while the previous one is sent.  */
+    if (status == UX_SUCCESS)
+    {
+        cdc_acm -> ux_slave_class_cdc_acm_bulkin_buffer =
+            _ux_utility_memory_allocate(UX_NO_ALIGN, UX_CACHE_SAFE_MEMORY, UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
+
+        /* Check for successful allocation.  */
+        if (cdc_acm -> ux_slave_class_cdc_acm_bulkin_buffer == UX_NULL)
+            status = (UX_MEMORY_INSUFFICIENT);
+    }
+#endif
+
     /* If success, go on to create bulkin thread.  */
     if (status == UX_SUCCESS)
     {
@@ -267,6 +286,10 @@ UINT                                    status;
             _ux_utility_event_flags_delete(&cdc_acm -> ux_slave_class_cdc_acm_event_flags_group);
         if (cdc_acm -> ux_slave_class_cdc_acm_bulkout_thread_stack)
             _ux_utility_memory_free(cdc_acm -> ux_slave_class_cdc_acm_bulkout_thread_stack);
+#if defined(UX_DEVICE_ENDPOINT_TRANSFER_QUEUE_SUPPORT)
+        if (cdc_acm -> ux_slave_class_cdc_acm_bulkin_buffer)
+            _ux_utility_memory_free(cdc_acm -> ux_slave_class_cdc_acm_bulkin_buffer);
+#endif
         _ux_device_mutex_delete(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_in_mutex);
         _ux_device_mutex_delete(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_out_mutex);
         _ux_utility_memory_free(cdc_acm);
@@ -0,0 +1,343 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device CDC Class                                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_acm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_cdc_acm_write_list                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function writes a list of buffers to the CDC class, e.g. a     */
+/*    header followed by a payload, as one stream of data.                */
+/*                                                                        */
+/*    A buffer aligned on UX_DEVICE_CLASS_CDC_ACM_WRITE_LIST_ALIGN is     */
+/*    sent directly by the controller, in one transfer and without copy.  */
+/*    Such buffer must be in cache safe memory, as buffers allocated      */
+/*    with UX_CACHE_SAFE_MEMORY. Other buffers are copied through the     */
+/*    endpoint buffer, as in _ux_device_class_cdc_acm_write.              */
+/*                                                                        */
+/*    The end of a buffer whose length is not a multiple of the endpoint  */
+/*    max packet size ends the transfer on the host side, so for best     */
+/*    throughput only the last buffer should have a short length.         */
+/*                                                                        */
+/*    It's for RTOS mode.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_acm                               Address of cdc_acm class      */
+/*                                                instance                */
+/*    segments                              Pointer to buffers to write   */
+/*    segment_count                         Number of buffers, if total   */
+/*                                                length is 0 a ZLP is    */
+/*                                                issued                  */
+/*    actual_length                         Pointer to save number of     */
+/*                                                bytes written           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*   _ux_utility_memory_copy                Copy memory                   */
+/*   _ux_device_stack_transfer_request      Transfer request              */
+/*   _ux_device_mutex_on                    Take Mutex                    */
+/*   _ux_device_mutex_off                   Release Mutex                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT _ux_device_class_cdc_acm_write_list(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT *segments,
+                                ULONG segment_count, ULONG *actual_length)
+{
+
+UX_SLAVE_ENDPOINT           *endpoint;
+UX_SLAVE_DEVICE             *device;
+UX_SLAVE_INTERFACE          *interface_ptr;
+UX_SLAVE_TRANSFER           *transfer_request;
+UCHAR                       *request_buffer;
+UCHAR                       *buffer;
+ULONG                       length;
+ULONG                       local_requested_length;
+ULONG                       local_host_length;
+ULONG                       segment_index;
+ULONG                       last_index;
+UINT                        status = 0;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_CDC_ACM_WRITE, cdc_acm, segments, segment_count, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+#ifndef UX_DEVICE_CLASS_CDC_ACM_TRANSMISSION_DISABLE
+
+    /* Check if current cdc-acm is using callback or not. We cannot use direct writes with callback on.  */
+    if (cdc_acm -> ux_slave_class_cdc_acm_transmission_status == UX_TRUE)
+
+        /* Not allowed. */
+        return(UX_ERROR);
+#endif
+
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+
+    /* As long as the device is in the CONFIGURED state.  */
+    if (device -> ux_slave_device_state != UX_DEVICE_CONFIGURED)
+    {
+
+        /* Error trap. */
+        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CONFIGURATION_HANDLE_UNKNOWN);
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        UX_TRACE_IN_LINE_INSERT(UX_TRACE_ERROR, UX_CONFIGURATION_HANDLE_UNKNOWN, device, 0, 0, UX_TRACE_ERRORS, 0, 0)
+
+        /* Cannot proceed with command, the interface is down.  */
+        return(UX_CONFIGURATION_HANDLE_UNKNOWN);
+    }
+
+    /* We need the interface to the class.  */
+    interface_ptr =  cdc_acm -> ux_slave_class_cdc_acm_interface;
+
+    /* Locate the endpoints.  */
+    endpoint =  interface_ptr -> ux_slave_interface_first_endpoint;
+
+    /* Check the endpoint direction, if IN we have the correct endpoint.  */
+    if ((endpoint -> ux_slave_endpoint_descriptor.bEndpointAddress & UX_ENDPOINT_DIRECTION) != UX_ENDPOINT_IN)
+    {
+
+        /* So the next endpoint has to be the IN endpoint.  */
+        endpoint =  endpoint -> ux_slave_endpoint_next_endpoint;
+    }
+
+    /* Protect this thread.  */
+    _ux_device_mutex_on(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_in_mutex);
+
+    /* We are writing to the IN endpoint.  */
+    transfer_request =  &endpoint -> ux_slave_endpoint_transfer_request;
+
+    /* Keep the endpoint buffer, the request points to caller buffers while they are sent.  */
+    request_buffer =  transfer_request -> ux_slave_transfer_request_data_pointer;
+
+    /* Reset the actual length.  */
+    *actual_length =  0;
+
+    /* Find the last buffer with data, it ends the transfer.  */
+    last_index =  segment_count;
+    for (segment_index = 0; segment_index < segment_count; segment_index ++)
+    {
+        if (segments[segment_index].ux_device_class_cdc_acm_write_segment_length != 0)
+            last_index =  segment_index;
+    }
+
+    /* Check if there is nothing to send, the application forces a 0 length packet.  */
+    if (last_index == segment_count)
+    {
+
+        /* Send the request for 0 byte packet to the device controller.  */
+        status =  _ux_device_stack_transfer_request(transfer_request, 0, 0);
+
+        /* Free Mutex resource.  */
+        _ux_device_mutex_off(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_in_mutex);
+
+        /* Return the status.  */
+        return(status);
+    }
+
+    /* Send the buffers in order.  */
+    for (segment_index = 0; segment_index <= last_index; segment_index ++)
+    {
+
+        /* Get the buffer to send.  */
+        buffer =  segments[segment_index].ux_device_class_cdc_acm_write_segment_buffer;
+        length =  segments[segment_index].ux_device_class_cdc_acm_write_segment_length;
+
+        while (device -> ux_slave_device_state == UX_DEVICE_CONFIGURED && length != 0)
+        {
+
+            /* Check if the buffer can be sent in place.  */
+            if (((ALIGN_TYPE)buffer & UX_DEVICE_CLASS_CDC_ACM_WRITE_LIST_ALIGN) == 0)
+            {
+
+                /* Send the whole buffer in one transfer.  */
+                local_requested_length =  length;
+                transfer_request -> ux_slave_transfer_request_data_pointer =  buffer;
+            }
+            else
+            {
+
+                /* Check if we have enough in the local buffer.  */
+                if (length > UX_SLAVE_REQUEST_DATA_MAX_LENGTH)
+                    local_requested_length =  UX_SLAVE_REQUEST_DATA_MAX_LENGTH;
+                else
+                    local_requested_length =  length;
+
+                /* Copy the slice to the endpoint buffer.  */
+                _ux_utility_memory_copy(request_buffer, buffer, local_requested_length); /* Use case of memcpy is verified. */
+            }
+
+            /* The last slice of the last buffer may need a ZLP.  */
+#if defined(UX_DEVICE_CLASS_CDC_ACM_WRITE_AUTO_ZLP)
+            if ((segment_index == last_index) && (local_requested_length == length))
+
+                /* Assume expecting more, so ZLP is appended in stack.  */
+                local_host_length =  local_requested_length + 1;
+            else
+#endif
+
+                /* Assume the length match expectation.  */
+                local_host_length =  local_requested_length;
+
+            /* Send the request to the device controller.  */
+            status =  _ux_device_stack_transfer_request(transfer_request, local_requested_length, local_host_length);
+
+            /* Restore the endpoint buffer.  */
+            transfer_request -> ux_slave_transfer_request_data_pointer =  request_buffer;
+
+            /* Check the status */
+            if (status != UX_SUCCESS)
+            {
+
+                /* Free Mutex resource.  */
+                _ux_device_mutex_off(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_in_mutex);
+
+                /* We had an error, abort.  */
+                return(status);
+            }
+
+            /* Next buffer address.  */
+            buffer += transfer_request -> ux_slave_transfer_request_actual_length;
+
+            /* Set the length actually sent. */
+            *actual_length += transfer_request -> ux_slave_transfer_request_actual_length;
+
+            /* Decrement what left has to be done.  */
+            length -= transfer_request -> ux_slave_transfer_request_actual_length;
+        }
+    }
+
+    /* Free Mutex resource.  */
+    _ux_device_mutex_off(&cdc_acm -> ux_slave_class_cdc_acm_endpoint_in_mutex);
+
+    /* Check why we got here, either completion or device was extracted.  */
+    if (device -> ux_slave_device_state != UX_DEVICE_CONFIGURED)
+    {
+
+        /* Error trap. */
+        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_TRANSFER_NO_ANSWER);
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        UX_TRACE_IN_LINE_INSERT(UX_TRACE_ERROR, UX_TRANSFER_NO_ANSWER, transfer_request, 0, 0, UX_TRACE_ERRORS, 0, 0)
+
+        /* Device must have been extracted.  */
+        return (UX_TRANSFER_NO_ANSWER);
+    }
+
+    /* Simply return the last transaction result.  */
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_device_class_cdc_acm_write_list                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in CDC ACM class write list function.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_acm                               Address of cdc_acm class      */
+/*                                                instance                */
+/*    segments                              Pointer to buffers to write   */
+/*    segment_count                         Number of buffers             */
+/*    actual_length                         Pointer to save number of     */
+/*                                                bytes written           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_device_class_cdc_acm_write_list   CDC ACM class write list      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT _uxe_device_class_cdc_acm_write_list(UX_SLAVE_CLASS_CDC_ACM *cdc_acm, UX_DEVICE_CLASS_CDC_ACM_WRITE_SEGMENT *segments,
+                                    ULONG segment_count, ULONG *actual_length)
+{
+
+ULONG                       segment_index;
+
+    /* Sanity checks.  */
+    if ((cdc_acm == UX_NULL) || ((segments == UX_NULL) && (segment_count > 0)) || (actual_length == UX_NULL))
+    {
+        return (UX_INVALID_PARAMETER);
+    }
+    for (segment_index = 0; segment_index < segment_count; segment_index ++)
+    {
+        if ((segments[segment_index].ux_device_class_cdc_acm_write_segment_buffer == UX_NULL) &&
+            (segments[segment_index].ux_device_class_cdc_acm_write_segment_length > 0))
+            return (UX_INVALID_PARAMETER);
+    }
+
+    return (_ux_device_class_cdc_acm_write_list(cdc_acm, segments, segment_count, actual_length));
+}
+
+#endif
@@ -0,0 +1,368 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_device_class_cdc_ncm_bulkin_thread              PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function is the thread of the cdc_ncm bulkin endpoint. The bulk*/ 
+/*    IN endpoint is used when the device wants to write data to be sent  */ 
+/*    to the host.                                                        */ 
+/*                                                                        */ 
+/*    Queued packets are packed into NTB16 or NTB32 (as selected by host) */ 
+/*    transfer blocks. The NTB is sent when it's full, or when the xmit   */ 
+/*    queue is empty and no more packet is queued before flush timeout.   */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    cdc_ncm_class                             Address of cdc_ncm class  */ 
+/*                                                container               */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_device_stack_transfer_request     Request transfer              */ 
+/*    _ux_utility_event_flags_get           Get event flags               */
+/*    _ux_device_mutex_on                   Take mutex                    */
+/*    _ux_device_mutex_off                  Free mutex                    */
+/*    _ux_utility_long_put                  Put 32-bit value              */
+/*    _ux_utility_short_put                 Put 16-bit value              */
+/*    _ux_utility_memory_set                Set memory                    */
+/*    nx_packet_data_extract_offset         Extract data from NX packet   */
+/*    nx_packet_transmit_release            Release NetX packet           */
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    ThreadX                                                             */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_class_cdc_ncm_bulkin_thread(ULONG cdc_ncm_class)
+{
+
+UX_SLAVE_CLASS                  *class_ptr;
+UX_SLAVE_CLASS_CDC_NCM          *cdc_ncm;
+UX_SLAVE_DEVICE                 *device;
+UX_SLAVE_TRANSFER               *transfer_request;
+UINT                            status;
+ULONG                           actual_flags;
+NX_PACKET                       *current_packet;
+UCHAR                           *ntb;
+UCHAR                           *ndp;
+ULONG                           ntb_size;
+ULONG                           ntb_length;
+ULONG                           nth_length;
+ULONG                           ndp_length;
+ULONG                           entry_length;
+ULONG                           datagram_offset;
+ULONG                           datagram_count;
+ULONG                           copied;
+
+    /* Cast properly the cdc_ncm instance.  */
+    UX_THREAD_EXTENSION_PTR_GET(class_ptr, UX_SLAVE_CLASS, cdc_ncm_class)
+    
+    /* Get the cdc_ncm instance from this class container.  */
+    cdc_ncm =  (UX_SLAVE_CLASS_CDC_NCM *) class_ptr -> ux_slave_class_instance;
+    
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+    
+    /* This thread runs forever but can be suspended or resumed.  */
+    while (1)
+    {
+
+        /* For as long we are configured.  */
+        while (1)
+        {
+            
+            /* Wait until either a new packet has been added to the xmit queue,
+               or until there has been a change in the device state (i.e. disconnection).  */
+            _ux_utility_event_flags_get(&cdc_ncm -> ux_slave_class_cdc_ncm_event_flags_group, (UX_DEVICE_CLASS_CDC_NCM_NEW_BULKIN_EVENT |
+                                                                                               UX_DEVICE_CLASS_CDC_NCM_NEW_DEVICE_STATE_CHANGE_EVENT), 
+                                                                                              UX_OR_CLEAR, &actual_flags, UX_WAIT_FOREVER);
+
+            /* Check the completion code and the actual flags returned.  */
+            if ((actual_flags & UX_DEVICE_CLASS_CDC_NCM_NEW_DEVICE_STATE_CHANGE_EVENT) == 0)
+            {
+
+                /* Get the transfer request for the bulk IN pipe.  */
+                transfer_request =  &cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_endpoint -> ux_slave_endpoint_transfer_request;
+
+                /* The NTB is built in the transfer request buffer.  */
+                ntb =  transfer_request -> ux_slave_transfer_request_data_pointer;
+
+                /* Build NTBs until all packets are sent.  */
+                while (cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue != UX_NULL)
+                {
+
+                    /* Get header sizes for current NTB format.  */
+                    ntb_size =  cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_size;
+                    if (cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format == UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_32)
+                    {
+                        nth_length =    UX_DEVICE_CLASS_CDC_NCM_NTH32_LENGTH;
+                        ndp_length =    UX_DEVICE_CLASS_CDC_NCM_NDP32_HEADER_LENGTH;
+                        entry_length =  UX_DEVICE_CLASS_CDC_NCM_NDP32_ENTRY_LENGTH;
+                    }
+                    else
+                    {
+                        nth_length =    UX_DEVICE_CLASS_CDC_NCM_NTH16_LENGTH;
+                        ndp_length =    UX_DEVICE_CLASS_CDC_NCM_NDP16_HEADER_LENGTH;
+                        entry_length =  UX_DEVICE_CLASS_CDC_NCM_NDP16_ENTRY_LENGTH;
+
+                        /* NTB16 can not exceed 64K.  */
+                        if (ntb_size > 0xFFFF)
+                            ntb_size =  0xFFFF;
+                    }
+
+                    /* The NDP follows the NTH, with room for max datagram pointers and the
+                       terminating null entry. Datagrams follow the NDP.  */
+                    ndp =  ntb + nth_length;
+                    ntb_length =  nth_length + ndp_length + entry_length * (UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_DATAGRAMS + 1);
+                    datagram_count =  0;
+
+                    /* Pack as many packets as possible in the NTB.  */
+                    while (datagram_count < UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_DATAGRAMS)
+                    {
+
+                        /* Check if there is packet pending.  */
+                        if (cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue == UX_NULL)
+                        {
+#if UX_DEVICE_CLASS_CDC_NCM_NTB_FLUSH_TIMEOUT > 0
+
+                            /* Wait a while for more packets before sending a non-full NTB.  */
+                            if (datagram_count > 0 &&
+                                cdc_ncm -> ux_slave_class_cdc_ncm_link_state == UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_UP)
+                            {
+                                status =  _ux_utility_event_flags_get(&cdc_ncm -> ux_slave_class_cdc_ncm_event_flags_group,
+                                                                      UX_DEVICE_CLASS_CDC_NCM_NEW_BULKIN_EVENT, UX_OR_CLEAR, &actual_flags,
+                                                                      UX_MS_TO_TICK(UX_DEVICE_CLASS_CDC_NCM_NTB_FLUSH_TIMEOUT));
+                                if (status == UX_SUCCESS)
+                                    continue;
+                            }
+#endif
+
+                            /* Send what we have.  */
+                            break;
+                        }
+
+                        /* Ensure no other threads are modifying the xmit queue.  */
+                        _ux_device_mutex_on(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+
+                        /* Get the current packet in the list.  */
+                        current_packet =  cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue;
+
+                        /* Get aligned datagram offset.  */
+                        datagram_offset =  UX_DEVICE_CLASS_CDC_NCM_ALIGN(ntb_length);
+
+                        /* If the packet does not fit, leave it in queue for next NTB.  */
+                        if (datagram_count > 0 && datagram_offset + current_packet -> nx_packet_length > ntb_size)
+                        {
+
+                            /* Free Mutex resource.  */
+                            _ux_device_mutex_off(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+                            break;
+                        }
+
+                        /* Set the next packet (or a NULL value) as the head of the xmit queue. */
+                        cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue =  current_packet -> nx_packet_queue_next;
+                
+                        /* Free Mutex resource.  */
+                        _ux_device_mutex_off(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+                    
+                        /* If the link is down no need to pack the packet. */
+                        if (cdc_ncm -> ux_slave_class_cdc_ncm_link_state == UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_UP)
+                        {
+                
+                            /* Can the packet fit in the NTB?  */
+                            if (datagram_offset + current_packet -> nx_packet_length <= ntb_size)
+                            {
+
+                                /* Copy the packet in the NTB.  */
+                                status = nx_packet_data_extract_offset(current_packet, 0, ntb + datagram_offset,
+                                                                       current_packet -> nx_packet_length, &copied);
+                                if (status == UX_SUCCESS)
+                                {
+
+                                    /* Add the datagram pointer entry.  */
+                                    if (cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format == UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_32)
+                                    {
+                                        _ux_utility_long_put(ndp + ndp_length + datagram_count * entry_length, datagram_offset);
+                                        _ux_utility_long_put(ndp + ndp_length + datagram_count * entry_length + 4, current_packet -> nx_packet_length);
+                                    }
+                                    else
+                                    {
+                                        _ux_utility_short_put(ndp + ndp_length + datagram_count * entry_length, (USHORT)datagram_offset);
+                                        _ux_utility_short_put(ndp + ndp_length + datagram_count * entry_length + 2, (USHORT)current_packet -> nx_packet_length);
+                                    }
+
+                                    /* One more datagram in NTB.  */
+                                    datagram_count ++;
+                                    ntb_length =  datagram_offset + current_packet -> nx_packet_length;
+                                }
+                            }
+                            else
+                            {
+
+                                /* Packet is too large.  */
+                                cdc_ncm -> ux_slave_class_cdc_ncm_statistics_xmit_error ++;
+
+                                /* Report error to application.  */
+                                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_TRANSFER_BUFFER_OVERFLOW);
+                            }
+                        }
+
+                        /* Free the packet that was just packed.  First do some housekeeping.  */
+                        current_packet -> nx_packet_prepend_ptr =  current_packet -> nx_packet_prepend_ptr + UX_DEVICE_CLASS_CDC_NCM_ETHERNET_SIZE; 
+                        current_packet -> nx_packet_length =  current_packet -> nx_packet_length - UX_DEVICE_CLASS_CDC_NCM_ETHERNET_SIZE;
+                
+                        /* And ask Netx to release it.  */
+                        nx_packet_transmit_release(current_packet); 
+                    }
+
+                    /* Check if there is anything to send.  */
+                    if (datagram_count == 0 ||
+                        cdc_ncm -> ux_slave_class_cdc_ncm_link_state != UX_DEVICE_CLASS_CDC_NCM_LINK_STATE_UP)
+                        continue;
+
+                    /* Terminate the datagram pointers with a null entry.  */
+                    _ux_utility_memory_set(ndp + ndp_length + datagram_count * entry_length, 0, entry_length); /* Use case of memset is verified. */
+                    ndp_length +=  (datagram_count + 1) * entry_length;
+
+                    /* Fill the NTH and NDP headers, reserved fields are zero.  */
+                    _ux_utility_memory_set(ntb, 0, nth_length); /* Use case of memset is verified. */
+                    _ux_utility_short_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_W_HEADER_LENGTH, (USHORT)nth_length);
+                    _ux_utility_short_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_W_SEQUENCE, (USHORT)cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_sequence);
+                    _ux_utility_short_put(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_W_LENGTH, (USHORT)ndp_length);
+                    if (cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format == UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_32)
+                    {
+                        _ux_utility_long_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_DW_SIGNATURE, UX_DEVICE_CLASS_CDC_NCM_NTH32_SIGNATURE);
+                        _ux_utility_long_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_BLOCK_LENGTH, ntb_length);
+                        _ux_utility_long_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH32_DW_NDP_INDEX, nth_length);
+                        _ux_utility_long_put(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_DW_SIGNATURE, UX_DEVICE_CLASS_CDC_NCM_NDP32_SIGNATURE);
+                        _ux_utility_memory_set(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_W_LENGTH + 2, 0, 10); /* Use case of memset is verified. */
+                    }
+                    else
+                    {
+                        _ux_utility_long_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_DW_SIGNATURE, UX_DEVICE_CLASS_CDC_NCM_NTH16_SIGNATURE);
+                        _ux_utility_short_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_BLOCK_LENGTH, (USHORT)ntb_length);
+                        _ux_utility_short_put(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH16_W_NDP_INDEX, (USHORT)nth_length);
+                        _ux_utility_long_put(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_DW_SIGNATURE, UX_DEVICE_CLASS_CDC_NCM_NDP16_SIGNATURE);
+                        _ux_utility_short_put(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP16_W_NEXT_NDP_INDEX, 0);
+                    }
+                    cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_sequence ++;
+
+                    /* If trace is enabled, insert this event into the trace buffer.  */
+                    UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_CDC_NCM_PACKET_TRANSMIT, cdc_ncm, ntb, ntb_length, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+                    /* Send the NTB to the device controller. A short packet ends
+                       the NTB if it's shorter than the NTB size.  */
+                    status =  _ux_device_stack_transfer_request(transfer_request, ntb_length, ntb_size);
+
+                    /* Check error code. */
+                    if (status == UX_SUCCESS)
+                        cdc_ncm -> ux_slave_class_cdc_ncm_statistics_xmit_ok +=  datagram_count;
+                    else
+                    {
+
+                        /* Datagrams are lost.  */
+                        cdc_ncm -> ux_slave_class_cdc_ncm_statistics_xmit_error +=  datagram_count;
+
+                        /* Is this not a transfer abort? (this is expected to happen)  */
+                        if (status != UX_TRANSFER_BUS_RESET)
+                        {
+
+                            /* Error trap. */
+                            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, status);
+                        }
+                    }
+                }
+            }
+            else
+            {
+
+                /* We need to ensure nobody is adding to the queue, so get the mutex protection. */
+                _ux_device_mutex_on(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+
+                /* Since we got the mutex, we know no one is trying to modify the queue; we also know
+                   no one can start modifying the queue since the link state is down, so we can just 
+                   release the mutex.  */
+                _ux_device_mutex_off(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+
+                /* We get here when the link is down. All packets pending must be freed.  */
+                while (cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue != UX_NULL)
+                {
+
+                    /* Get the current packet in the list.  */
+                    current_packet =  cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue;
+                    
+                    /* Set the next packet (or a NULL value) as the head of the xmit queue. */
+                    cdc_ncm -> ux_slave_class_cdc_ncm_xmit_queue =  current_packet -> nx_packet_queue_next;
+
+                    /* Free the packet.  */
+                    current_packet -> nx_packet_prepend_ptr =  current_packet -> nx_packet_prepend_ptr + UX_DEVICE_CLASS_CDC_NCM_ETHERNET_SIZE; 
+                    current_packet -> nx_packet_length =  current_packet -> nx_packet_length - UX_DEVICE_CLASS_CDC_NCM_ETHERNET_SIZE;
+
+                    /* And ask Netx to release it.  */
+                    nx_packet_transmit_release(current_packet); 
+                }
+
+                /* Was the change in the device state caused by a disconnection?  */
+                if (device -> ux_slave_device_state != UX_DEVICE_CONFIGURED)
+                {
+
+                    /* Yes. Break out of the loop and suspend ourselves, waiting for the next configuration.  */
+                    break;
+                }
+            }
+        }
+
+        /* We need to suspend ourselves. We will be resumed by the device enumeration module or when a change of alternate setting happens.  */
+        _ux_device_thread_suspend(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread);
+    }
+}
+#endif
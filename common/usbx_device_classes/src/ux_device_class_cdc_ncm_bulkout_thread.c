@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_device_class_cdc_ncm_bulkout_thread             PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function is the thread of the cdc_ncm bulk out endpoint. It    */ 
+/*    is waiting for the host to send data on the bulk out endpoint to    */ 
+/*    the device. Each NTB received is passed to                          */ 
+/*    _ux_device_class_cdc_ncm_ntb_receive to extract the datagrams.      */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    cdc_ncm_class                             Address of cdc_ncm class  */ 
+/*                                                container               */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_device_stack_transfer_request     Request transfer              */ 
+/*    _ux_device_class_cdc_ncm_ntb_receive  Receive datagrams in NTB      */
+/*    _ux_device_thread_suspend             Suspend thread                */
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    ThreadX                                                             */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_class_cdc_ncm_bulkout_thread(ULONG cdc_ncm_class)
+{
+
+UX_SLAVE_CLASS                  *class_ptr;
+UX_SLAVE_CLASS_CDC_NCM          *cdc_ncm;
+UX_SLAVE_DEVICE                 *device;
+UX_SLAVE_TRANSFER               *transfer_request;
+UINT                            status;
+USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
+
+    /* Cast properly the cdc_ncm instance.  */
+    UX_THREAD_EXTENSION_PTR_GET(class_ptr, UX_SLAVE_CLASS, cdc_ncm_class)
+    
+    /* Get the cdc_ncm instance from this class container.  */
+    cdc_ncm =  (UX_SLAVE_CLASS_CDC_NCM *) class_ptr -> ux_slave_class_instance;
+    
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+    
+    /* This thread runs forever but can be suspended or resumed.  */
+    while (1)
+    {
+
+        /* As long as the device is in the CONFIGURED state.  */
+        while (device -> ux_slave_device_state == UX_DEVICE_CONFIGURED)
+        { 
+
+            /* Check if packet pool is ready.  */
+            if (cdc_ncm -> ux_slave_class_cdc_ncm_packet_pool == UX_NULL)
+            {
+
+                /* Get the network device handle.  */
+                ux_nx_device = (USB_NETWORK_DEVICE_TYPE *)(cdc_ncm -> ux_slave_class_cdc_ncm_network_handle);
+
+                /* Get packet pool from IP instance (if available).  */
+                if (ux_nx_device -> ux_network_device_ip_instance != UX_NULL)
+                {
+                    cdc_ncm -> ux_slave_class_cdc_ncm_packet_pool = ux_nx_device -> ux_network_device_ip_instance -> nx_ip_default_packet_pool;
+                }
+                else
+                {
+
+                    /* Error trap.  */
+                    _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_ETH_PACKET_POOL_ERROR);
+
+                    _ux_utility_delay_ms(UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_INST_WAIT);
+                    continue;
+                }
+            }
+
+            /* Check if Bulk OUT endpoint is ready.  */
+            if (cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_endpoint == UX_NULL)
+            {
+                _ux_utility_delay_ms(UX_DEVICE_CLASS_CDC_NCM_LINK_CHECK_WAIT);
+                continue;
+            }
+
+            /* Select the transfer request associated with BULK OUT endpoint.   */
+            transfer_request =  &cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_endpoint -> ux_slave_endpoint_transfer_request;
+
+            /* Receive a whole NTB.  */
+            status =  _ux_device_stack_transfer_request(transfer_request, UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE,
+                                                                UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE);
+
+            /* Check the completion code. */
+            if (status == UX_SUCCESS)
+            {
+
+                /* We only proceed with NTBs that are received OK, if error, ignore the NTB. */
+                /* If trace is enabled, insert this event into the trace buffer.  */
+                UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_CDC_NCM_PACKET_RECEIVE, cdc_ncm, transfer_request -> ux_slave_transfer_request_data_pointer,
+                                        transfer_request -> ux_slave_transfer_request_actual_length, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+                /* Extract datagrams and send them to the NetX USB broker.  */
+                _ux_device_class_cdc_ncm_ntb_receive(cdc_ncm, transfer_request -> ux_slave_transfer_request_data_pointer,
+                                                     transfer_request -> ux_slave_transfer_request_actual_length);
+            }
+        }
+             
+        /* We need to suspend ourselves. We will be resumed by the device enumeration module.  */
+        _ux_device_thread_suspend(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread);
+    }
+}
+#endif
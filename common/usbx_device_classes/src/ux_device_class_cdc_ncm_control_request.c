@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_device_class_cdc_ncm_control_request            PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function manages the based sent by the host on the control     */ 
+/*    endpoints with a CLASS or VENDOR SPECIFIC type.                     */ 
+/*                                                                        */ 
+/*    NTB parameters, format and input size requests of NCM are handled   */ 
+/*    in addition to the ECM subset requests.                             */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    cdc_ncm                           Pointer to cdc_ncm class          */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_utility_short_get                 Get 16-bit value              */ 
+/*    _ux_utility_short_put                 Put 16-bit value              */
+/*    _ux_utility_long_get                  Get 32-bit value              */
+/*    _ux_utility_long_put                  Put 32-bit value              */
+/*    _ux_device_stack_transfer_request     Transfer request              */
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    CDC_NCM Class                                                       */
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_class_cdc_ncm_control_request(UX_SLAVE_CLASS_COMMAND *command)
+{
+
+UX_SLAVE_TRANSFER       *transfer_request;
+UX_SLAVE_DEVICE         *device;
+ULONG                   request;
+ULONG                   request_value;
+ULONG                   request_length;
+ULONG                   transmit_length;
+ULONG                   ntb_in_size;
+UX_SLAVE_CLASS          *class_ptr;
+UX_SLAVE_CLASS_CDC_NCM  *cdc_ncm;
+
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+
+    /* Get the pointer to the transfer request associated with the control endpoint.  */
+    transfer_request =  &device -> ux_slave_device_control_endpoint.ux_slave_endpoint_transfer_request;
+
+    /* Extract all necessary fields of the request.  */
+    request =  *(transfer_request -> ux_slave_transfer_request_setup + UX_SETUP_REQUEST);
+    request_value  =   _ux_utility_short_get(transfer_request -> ux_slave_transfer_request_setup + UX_SETUP_VALUE);
+    request_length =   _ux_utility_short_get(transfer_request -> ux_slave_transfer_request_setup + UX_SETUP_LENGTH);
+
+    /* Get the class container.  */
+    class_ptr =  command -> ux_slave_class_command_class_ptr;
+    
+    /* Get the cdc_ncm instance from this class container.  */
+    cdc_ncm =  (UX_SLAVE_CLASS_CDC_NCM *) class_ptr -> ux_slave_class_instance;
+    
+    /* Here we proceed only the standard request we know of at the device level.  */
+    switch (request)
+    {
+
+        case UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_MULTICAST_FILTER                :
+
+            /* Save the multicast filter.  */                
+            cdc_ncm -> ux_slave_class_cdc_ncm_ethernet_multicast_filter =  request_value;
+            break ;
+
+        case UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_POWER_MANAGEMENT_FILTER        :
+
+            /* Save the power management filter.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_ethernet_power_management_filter =  request_value;
+            break ;
+
+        case UX_DEVICE_CLASS_CDC_NCM_SET_ETHERNET_PACKET_FILTER                    :
+
+            /* Save the packet filter.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_ethernet_packet_filter =  request_value;
+            break ;
+            
+        case UX_DEVICE_CLASS_CDC_NCM_GET_NTB_PARAMETERS                          :
+
+            /* Fill the NTB parameters structure.  */
+            _ux_utility_memory_set(transfer_request -> ux_slave_transfer_request_data_pointer, 0, UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_LENGTH); /* Use case of memset is verified. */
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_LENGTH,
+                                  UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_LENGTH);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_BM_NTB_FORMATS_SUPPORTED,
+                                  UX_DEVICE_CLASS_CDC_NCM_NTB_FORMATS_SUPPORTED);
+            _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_DW_NTB_IN_MAX_SIZE,
+                                 UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_DIVISOR,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_DIVISOR);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_PAYLOAD_REMAINDER,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_PAYLOAD_REMAINDER);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_IN_ALIGNMENT,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_ALIGNMENT);
+            _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_DW_NTB_OUT_MAX_SIZE,
+                                 UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_DIVISOR,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_DIVISOR);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_PAYLOAD_REMAINDER,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_PAYLOAD_REMAINDER);
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_W_NDP_OUT_ALIGNMENT,
+                                  UX_DEVICE_CLASS_CDC_NCM_NDP_ALIGNMENT);
+
+            /* Setup the length appropriately.  */
+            transmit_length = UX_MIN(request_length, UX_DEVICE_CLASS_CDC_NCM_NTB_PARAMETERS_LENGTH);
+
+            /* Set the phase of the transfer to data out.  */
+            transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_OUT;
+
+            /* Perform the data transfer.  */
+            _ux_device_stack_transfer_request(transfer_request, transmit_length, request_length);
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_GET_NTB_FORMAT                              :
+
+            /* Return current NTB format.  */
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer, (USHORT)cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format);
+            transmit_length = UX_MIN(request_length, 2);
+            transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_OUT;
+            _ux_device_stack_transfer_request(transfer_request, transmit_length, request_length);
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_SET_NTB_FORMAT                              :
+
+            /* Format can only be changed while data interface is in alternate setting 0.  */
+            if (cdc_ncm -> ux_slave_class_cdc_ncm_current_alternate_setting != 0 ||
+                request_value > UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_32)
+                return(UX_ERROR);
+
+            /* Save the NTB format.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format =  request_value;
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_GET_NTB_INPUT_SIZE                          :
+
+            /* Return current NTB input size.  */
+            _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer, cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_size);
+            transmit_length = UX_MIN(request_length, 4);
+            transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_OUT;
+            _ux_device_stack_transfer_request(transfer_request, transmit_length, request_length);
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_SET_NTB_INPUT_SIZE                          :
+
+            /* Get NTB input size from host, it must be in valid range.  */
+            if (request_length < 4)
+                return(UX_ERROR);
+            ntb_in_size =  _ux_utility_long_get(transfer_request -> ux_slave_transfer_request_data_pointer);
+            if (ntb_in_size < UX_DEVICE_CLASS_CDC_NCM_NTH16_LENGTH + UX_DEVICE_CLASS_CDC_NCM_NDP16_HEADER_LENGTH +
+                              UX_DEVICE_CLASS_CDC_NCM_NDP16_ENTRY_LENGTH * 2 + UX_DEVICE_CLASS_CDC_NCM_MAX_MTU ||
+                ntb_in_size > UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE)
+                return(UX_ERROR);
+
+            /* Save the NTB input size.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_size =  ntb_in_size;
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_GET_MAX_DATAGRAM_SIZE                       :
+
+            /* Return max datagram size.  */
+            _ux_utility_short_put(transfer_request -> ux_slave_transfer_request_data_pointer, UX_DEVICE_CLASS_CDC_NCM_MAX_PACKET_LENGTH);
+            transmit_length = UX_MIN(request_length, 2);
+            transfer_request -> ux_slave_transfer_request_phase =  UX_TRANSFER_PHASE_DATA_OUT;
+            _ux_device_stack_transfer_request(transfer_request, transmit_length, request_length);
+            break;
+
+        case UX_DEVICE_CLASS_CDC_NCM_GET_ETHERNET_POWER_MANAGEMENT_FILTER        :
+        default:
+
+            /* Unknown function. It's not handled.  */
+            return(UX_ERROR);
+    }
+
+    /* It's handled.  */
+    return(UX_SUCCESS);
+}
+
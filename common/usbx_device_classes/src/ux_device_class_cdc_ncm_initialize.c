@@ -0,0 +1,249 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_cdc_ncm_initialize                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the USB CDC_NCM device.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    command                               Pointer to cdc_ncm command    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_allocate           Allocate memory               */
+/*    _ux_utility_memory_free               Free memory                   */
+/*    _ux_utility_mutex_create              Create Mutex                  */
+/*    _ux_device_mutex_delete               Delete Mutex                  */
+/*    _ux_utility_event_flags_create        Create Flag group             */
+/*    _ux_utility_event_flags_delete        Delete Flag group             */
+/*    _ux_device_thread_create              Create Thread                 */
+/*    _ux_device_thread_delete              Delete Thread                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    USBX Source Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_class_cdc_ncm_initialize(UX_SLAVE_CLASS_COMMAND *command)
+{
+#if defined(UX_DEVICE_STANDALONE)
+    UX_PARAMETER_NOT_USED(command);
+    return(UX_FUNCTION_NOT_SUPPORTED);
+#else
+
+UX_SLAVE_CLASS_CDC_NCM                          *cdc_ncm;
+UX_SLAVE_CLASS_CDC_NCM_PARAMETER                *cdc_ncm_parameter;
+UX_SLAVE_CLASS                                  *class_ptr;
+UINT                                            status;
+
+
+    /* Compile option checks.  */
+    UX_ASSERT(UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
+    UX_ASSERT(UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_SIZE <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
+
+    /* Get the class container.  */
+    class_ptr =  command -> ux_slave_class_command_class_ptr;
+
+    /* Create an instance of the device cdc_ncm class.  */
+    cdc_ncm =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_SLAVE_CLASS_CDC_NCM));
+
+    /* Check for successful allocation.  */
+    if (cdc_ncm == UX_NULL)
+        return(UX_MEMORY_INSUFFICIENT);
+
+    /* Create a mutex to protect the CDC_NCM thread and the application messing up the transmit queue.  */
+    status =  _ux_utility_mutex_create(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex, "ux_slave_class_cdc_ncm_mutex");
+    if (status != UX_SUCCESS)
+    {
+        _ux_utility_memory_free(cdc_ncm);
+        return(UX_MUTEX_ERROR);
+    }
+
+    /* Assume good result.  */
+    status = UX_SUCCESS;
+
+    /* Allocate some memory for the bulk out thread stack. */
+    cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack =
+            _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, UX_THREAD_STACK_SIZE);
+    if (cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack == UX_NULL)
+        status = (UX_MEMORY_INSUFFICIENT);
+
+    /* Allocate some memory for the interrupt thread stack. */
+    if (status == UX_SUCCESS)
+    {
+        cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack =
+                _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, UX_THREAD_STACK_SIZE);
+
+        /* Check for successful allocation.  */
+        if (cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack  == UX_NULL)
+            status = (UX_MEMORY_INSUFFICIENT);
+    }
+
+    /* Allocate some memory for the bulk in thread stack. */
+    if (status == UX_SUCCESS)
+    {
+        cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack =
+                _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, UX_THREAD_STACK_SIZE);
+
+        /* Check for successful allocation.  */
+        if (cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack == UX_NULL)
+            status = (UX_MEMORY_INSUFFICIENT);
+    }
+
+    /* Interrupt endpoint treatment needs to be running in a different thread. So start
+       a new thread. We pass a pointer to the cdc_ncm instance to the new thread.  This thread
+       does not start until we have a instance of the class. */
+    if (status == UX_SUCCESS)
+    {
+        status =  _ux_device_thread_create(&cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread , "ux_slave_class_cdc_ncm_interrupt_thread",
+                    _ux_device_class_cdc_ncm_interrupt_thread,
+                    (ULONG) (ALIGN_TYPE) class_ptr, (VOID *) cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack ,
+                    UX_THREAD_STACK_SIZE, UX_THREAD_PRIORITY_CLASS,
+                    UX_THREAD_PRIORITY_CLASS, UX_NO_TIME_SLICE, UX_DONT_START);
+        if (status != UX_SUCCESS)
+            status = (UX_THREAD_ERROR);
+    }
+
+    UX_THREAD_EXTENSION_PTR_SET(&(cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread), class_ptr)
+
+    /* Check the creation of this thread.  */
+    if (status == UX_SUCCESS)
+    {
+
+        /* Bulk endpoint treatment needs to be running in a different thread. So start
+        a new thread. We pass a pointer to the cdc_ncm instance to the new thread.  This thread
+        does not start until we have a instance of the class. */
+        status =  _ux_device_thread_create(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread , "ux_slave_class_cdc_ncm_bulkout_thread",
+                    _ux_device_class_cdc_ncm_bulkout_thread,
+                    (ULONG) (ALIGN_TYPE) class_ptr, (VOID *) cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack ,
+                    UX_THREAD_STACK_SIZE, UX_THREAD_PRIORITY_CLASS,
+                    UX_THREAD_PRIORITY_CLASS, UX_NO_TIME_SLICE, UX_DONT_START);
+        if (status != UX_SUCCESS)
+            status = (UX_THREAD_ERROR);
+        else
+        {
+
+            UX_THREAD_EXTENSION_PTR_SET(&(cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread), class_ptr)
+
+            /* Bulk endpoint treatment needs to be running in a different thread. So start
+            a new thread. We pass a pointer to the cdc_ncm instance to the new thread.  This thread
+            does not start until we have a instance of the class. */
+            status =  _ux_device_thread_create(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread , "ux_slave_class_cdc_ncm_bulkin_thread",
+                        _ux_device_class_cdc_ncm_bulkin_thread,
+                        (ULONG) (ALIGN_TYPE) class_ptr, (VOID *) cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack ,
+                        UX_THREAD_STACK_SIZE, UX_THREAD_PRIORITY_CLASS,
+                        UX_THREAD_PRIORITY_CLASS, UX_NO_TIME_SLICE, UX_DONT_START);
+            if (status != UX_SUCCESS)
+                status = (UX_THREAD_ERROR);
+            else
+            {
+
+                UX_THREAD_EXTENSION_PTR_SET(&(cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread), class_ptr)
+
+                /* Create a event flag group for the cdc_ncm class to synchronize with the event interrupt thread.  */
+                status =  _ux_utility_event_flags_create(&cdc_ncm -> ux_slave_class_cdc_ncm_event_flags_group, "ux_device_class_cdc_ncm_event_flag");
+                if (status != UX_SUCCESS)
+                    status = (UX_EVENT_ERROR);
+                else
+                {
+
+                    /* Save the address of the CDC_NCM instance inside the CDC_NCM container.  */
+                    class_ptr -> ux_slave_class_instance = (VOID *) cdc_ncm;
+
+                    /* Get the pointer to the application parameters for the cdc_ncm class.  */
+                    cdc_ncm_parameter =  command -> ux_slave_class_command_parameter;
+
+                    /* Store the start and stop signals if needed by the application.  */
+                    cdc_ncm -> ux_slave_class_cdc_ncm_parameter.ux_slave_class_cdc_ncm_instance_activate = cdc_ncm_parameter -> ux_slave_class_cdc_ncm_instance_activate;
+                    cdc_ncm -> ux_slave_class_cdc_ncm_parameter.ux_slave_class_cdc_ncm_instance_deactivate = cdc_ncm_parameter -> ux_slave_class_cdc_ncm_instance_deactivate;
+
+                    /* Copy the local node ID.  */
+                    _ux_utility_memory_copy(cdc_ncm -> ux_slave_class_cdc_ncm_local_node_id, cdc_ncm_parameter -> ux_slave_class_cdc_ncm_parameter_local_node_id,
+                                            UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH); /* Use case of memcpy is verified. */
+
+                    /* Copy the remote node ID.  */
+                    _ux_utility_memory_copy(cdc_ncm -> ux_slave_class_cdc_ncm_remote_node_id, cdc_ncm_parameter -> ux_slave_class_cdc_ncm_parameter_remote_node_id,
+                                            UX_DEVICE_CLASS_CDC_NCM_NODE_ID_LENGTH); /* Use case of memcpy is verified. */
+
+                    /* Store the rest of the parameters as they are in the local instance.  */
+                    _ux_utility_memory_copy(&cdc_ncm -> ux_slave_class_cdc_ncm_parameter, cdc_ncm_parameter, sizeof (UX_SLAVE_CLASS_CDC_NCM_PARAMETER)); /* Use case of memcpy is verified. */
+
+                    /* Default NTB format and input size.  */
+                    cdc_ncm -> ux_slave_class_cdc_ncm_ntb_format =  UX_DEVICE_CLASS_CDC_NCM_NTB_FORMAT_16;
+                    cdc_ncm -> ux_slave_class_cdc_ncm_ntb_in_size =  UX_DEVICE_CLASS_CDC_NCM_NTB_IN_MAX_SIZE;
+
+                    return(UX_SUCCESS);
+                }
+
+                _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread);
+            }
+
+            _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread);
+        }
+
+        _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread);
+    }
+
+    /* Free allocated resources.  */
+
+    if (cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack)
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack);
+    if (cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack)
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack);
+    if (cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack)
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack);
+    _ux_device_mutex_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+    _ux_utility_memory_free(cdc_ncm);
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_device_class_cdc_ncm_interrupt_thread           PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function is the thread of the cdc_ncm interrupt endpoint       */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    cdc_ncm_class                         Address of cdc_ncm class      */ 
+/*                                          container                     */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_device_stack_transfer_request     Request transfer              */ 
+/*    _ux_utility_event_flags_get           Get event flags               */
+/*    _ux_utility_short_put                 Put 16-bit value to buffer    */
+/*    _ux_device_thread_suspend             Suspend thread                */
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    ThreadX                                                             */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_class_cdc_ncm_interrupt_thread(ULONG cdc_ncm_class)
+{
+
+UX_SLAVE_CLASS                  *class_ptr;
+UX_SLAVE_CLASS_CDC_NCM          *cdc_ncm;
+UX_SLAVE_DEVICE                 *device;
+UX_SLAVE_TRANSFER               *transfer_request;
+UINT                            status;
+ULONG                           actual_flags;
+UCHAR                           *notification_buffer;
+
+    /* Cast properly the cdc_ncm instance.  */
+    UX_THREAD_EXTENSION_PTR_GET(class_ptr, UX_SLAVE_CLASS, cdc_ncm_class)
+    
+    /* Get the cdc_ncm instance from this class container.  */
+    cdc_ncm =  (UX_SLAVE_CLASS_CDC_NCM *) class_ptr -> ux_slave_class_instance;
+    
+    /* Get the pointer to the device.  */
+    device =  &_ux_system_slave -> ux_system_slave_device;
+    
+    /* This thread runs forever but can be suspended or resumed.  */
+    while(1)
+    {
+
+        /* All CDC_NCM events are on the interrupt endpoint IN, from the host.  */
+        transfer_request =  &cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_endpoint -> ux_slave_endpoint_transfer_request;
+
+        /* As long as the device is in the CONFIGURED state.  */
+        while (device -> ux_slave_device_state == UX_DEVICE_CONFIGURED)
+        { 
+
+
+            /* Wait until we have a event sent by the application. We do not treat yet the case where a timeout based
+               on the interrupt pipe frequency or a change in the idle state forces us to send an empty report.  */
+            _ux_utility_event_flags_get(&cdc_ncm -> ux_slave_class_cdc_ncm_event_flags_group, 
+                                        UX_DEVICE_CLASS_CDC_NCM_NETWORK_NOTIFICATION_EVENT, 
+                                        UX_OR_CLEAR, &actual_flags, UX_WAIT_FOREVER);
+
+            /* Build the Network Notification response.  */
+            notification_buffer = transfer_request -> ux_slave_transfer_request_data_pointer;
+
+            /* Set the request type.  */
+            *(notification_buffer + UX_SETUP_REQUEST_TYPE) = UX_REQUEST_IN | UX_REQUEST_TYPE_CLASS | UX_REQUEST_TARGET_INTERFACE;
+
+            /* Set the request itself.  */
+            *(notification_buffer + UX_SETUP_REQUEST) = 0;
+            
+            /* Set the value. It is the network link.  */
+            _ux_utility_short_put(notification_buffer + UX_SETUP_VALUE, (USHORT)(cdc_ncm -> ux_slave_class_cdc_ncm_link_state));
+
+            /* Set the Index. It is interface.  The interface used is the DATA interface. Here we simply take the interface number of the CONTROL and add 1 to it
+                as it is assumed the classes are contiguous in number. */
+            _ux_utility_short_put(notification_buffer + UX_SETUP_INDEX, (USHORT)(cdc_ncm -> ux_slave_class_cdc_ncm_interface -> ux_slave_interface_descriptor.bInterfaceNumber + 1));
+
+            /* And the length is zero.  */
+            *(notification_buffer + UX_SETUP_LENGTH) = 0;
+
+            /* Send the request to the device controller.  */
+            status =  _ux_device_stack_transfer_request(transfer_request, UX_DEVICE_CLASS_CDC_NCM_INTERRUPT_RESPONSE_LENGTH,
+                                                                UX_DEVICE_CLASS_CDC_NCM_INTERRUPT_RESPONSE_LENGTH);
+
+            /* Check error code.  */
+            if (status != UX_SUCCESS)
+            {
+
+                /* Since bus resets are expected, we do not treat it as an error.  */
+                if (status != UX_TRANSFER_BUS_RESET)
+                {
+
+                    /* Error trap. */
+                    _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, status);
+                }
+            }
+        }
+
+        /* We need to suspend ourselves. We will be resumed by the device enumeration module.  */
+        _ux_device_thread_suspend(&cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread);
+    }
+}
+#endif
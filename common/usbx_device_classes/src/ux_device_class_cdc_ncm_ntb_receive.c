@@ -0,0 +1,251 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC_NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+#if !defined(UX_DEVICE_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_cdc_ncm_ntb_receive                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function parses a NTB (NTB16 or NTB32) received from the host, */
+/*    copies each datagram referenced by its NDPs into a NetX packet and  */
+/*    passes the packet to the network driver.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_ncm                               Address of cdc_ncm class      */
+/*                                            instance                    */
+/*    ntb                                   Pointer to NTB buffer         */
+/*    ntb_length                            Received NTB length           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_network_driver_packet_received    Process received packet       */
+/*    _ux_utility_long_get                  Get 32-bit value              */
+/*    _ux_utility_short_get                 Get 16-bit value              */
+/*    nx_packet_allocate                    Allocate NetX packet          */
+/*    nx_packet_data_append                 Copy data to NetX packet      */
+/*    nx_packet_release                     Free NetX packet              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Device CDC_NCM Class                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_class_cdc_ncm_ntb_receive(UX_SLAVE_CLASS_CDC_NCM *cdc_ncm, UCHAR *ntb, ULONG ntb_length)
+{
+
+UINT                        status;
+UINT                        ntb32;
+ULONG                       signature;
+ULONG                       block_length;
+ULONG                       ndp_index;
+ULONG                       ndp_length;
+ULONG                       ndp_header_length;
+ULONG                       ndp_count;
+ULONG                       entry_length;
+ULONG                       entry_offset;
+ULONG                       datagram_index;
+ULONG                       datagram_length;
+UCHAR                       *ndp;
+NX_PACKET                   *packet;
+
+    /* Check the NTH signature and length.  */
+    signature =  (ntb_length >= UX_DEVICE_CLASS_CDC_NCM_NTH16_LENGTH) ? _ux_utility_long_get(ntb) : 0;
+    if (signature == UX_DEVICE_CLASS_CDC_NCM_NTH16_SIGNATURE &&
+        _ux_utility_short_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_W_HEADER_LENGTH) == UX_DEVICE_CLASS_CDC_NCM_NTH16_LENGTH)
+    {
+        ntb32 =  UX_FALSE;
+        block_length =  _ux_utility_short_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_BLOCK_LENGTH);
+        ndp_index =  _ux_utility_short_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH16_W_NDP_INDEX);
+        ndp_header_length =  UX_DEVICE_CLASS_CDC_NCM_NDP16_HEADER_LENGTH;
+        entry_length =  UX_DEVICE_CLASS_CDC_NCM_NDP16_ENTRY_LENGTH;
+    }
+    else if (signature == UX_DEVICE_CLASS_CDC_NCM_NTH32_SIGNATURE &&
+             ntb_length >= UX_DEVICE_CLASS_CDC_NCM_NTH32_LENGTH &&
+             _ux_utility_short_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_W_HEADER_LENGTH) == UX_DEVICE_CLASS_CDC_NCM_NTH32_LENGTH)
+    {
+        ntb32 =  UX_TRUE;
+        block_length =  _ux_utility_long_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH_BLOCK_LENGTH);
+        ndp_index =  _ux_utility_long_get(ntb + UX_DEVICE_CLASS_CDC_NCM_NTH32_DW_NDP_INDEX);
+        ndp_header_length =  UX_DEVICE_CLASS_CDC_NCM_NDP32_HEADER_LENGTH;
+        entry_length =  UX_DEVICE_CLASS_CDC_NCM_NDP32_ENTRY_LENGTH;
+    }
+    else
+    {
+
+        /* We received a malformed NTB. Report to application.  */
+        cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+        return(UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+    }
+
+    /* A zero block length means the NTB is terminated by a short packet.  */
+    if (block_length == 0)
+        block_length =  ntb_length;
+
+    /* The block must be inside what has been received.  */
+    if (block_length > ntb_length || block_length < ndp_header_length)
+    {
+
+        /* We received a malformed NTB. Report to application.  */
+        cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+        return(UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+    }
+
+    /* Parse the chain of NDPs.  */
+    for (ndp_count = 0; ndp_index != 0 && ndp_count < UX_DEVICE_CLASS_CDC_NCM_NTB_OUT_MAX_NDPS; ndp_count ++)
+    {
+
+        /* Check the NDP is aligned and inside the block.  */
+        if ((ndp_index & 3) || ndp_index > block_length - ndp_header_length)
+        {
+
+            /* We received a malformed NTB. Report to application.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+            return(UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+        }
+
+        /* Get the NDP header.  */
+        ndp =  ntb + ndp_index;
+        signature =  _ux_utility_long_get(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_DW_SIGNATURE);
+        ndp_length =  _ux_utility_short_get(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP_W_LENGTH);
+        if (ntb32)
+            ndp_index =  _ux_utility_long_get(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP32_DW_NEXT_NDP_INDEX);
+        else
+            ndp_index =  _ux_utility_short_get(ndp + UX_DEVICE_CLASS_CDC_NCM_NDP16_W_NEXT_NDP_INDEX);
+
+        /* Check the NDP signature (CRC mode is not supported) and length.  */
+        if (signature != (ntb32 ? UX_DEVICE_CLASS_CDC_NCM_NDP32_SIGNATURE : UX_DEVICE_CLASS_CDC_NCM_NDP16_SIGNATURE) ||
+            ndp_length < ndp_header_length + entry_length * 2 ||
+            ndp_length > block_length - (ULONG)(ndp - ntb))
+        {
+
+            /* We received a malformed NTB. Report to application.  */
+            cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+            return(UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+        }
+
+        /* Parse datagram pointers until the null entry.  */
+        for (entry_offset = ndp_header_length; entry_offset + entry_length <= ndp_length; entry_offset += entry_length)
+        {
+
+            /* Get datagram index and length.  */
+            if (ntb32)
+            {
+                datagram_index =  _ux_utility_long_get(ndp + entry_offset);
+                datagram_length =  _ux_utility_long_get(ndp + entry_offset + 4);
+            }
+            else
+            {
+                datagram_index =  _ux_utility_short_get(ndp + entry_offset);
+                datagram_length =  _ux_utility_short_get(ndp + entry_offset + 2);
+            }
+
+            /* Null entry terminates the table.  */
+            if (datagram_index == 0 || datagram_length == 0)
+                break;
+
+            /* Check the datagram is inside the block and is not too large.  */
+            if (datagram_index > block_length || datagram_length > block_length - datagram_index ||
+                datagram_length > UX_DEVICE_CLASS_CDC_NCM_MAX_MTU)
+            {
+
+                /* We received a malformed datagram. Report to application.  */
+                cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+                continue;
+            }
+
+            /* Get a NX Packet.  */
+            status =  nx_packet_allocate(cdc_ncm -> ux_slave_class_cdc_ncm_packet_pool, &packet,
+                                         NX_RECEIVE_PACKET, UX_MS_TO_TICK(UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_WAIT));
+            if (status != NX_SUCCESS)
+            {
+
+                /* Packet allocation timed out, the rest of the NTB is dropped.  */
+                cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_no_buffer ++;
+
+                /* Error trap. No need for trace, since NetX does it.  */
+                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+                return(UX_MEMORY_INSUFFICIENT);
+            }
+
+            /* Adjust the prepend pointer to take into account the non 3 bit alignment of the ethernet header.  */
+            packet -> nx_packet_prepend_ptr += sizeof(USHORT);
+            packet -> nx_packet_append_ptr += sizeof(USHORT);
+
+            /* Copy the datagram in the IP packet data area.  */
+            status = nx_packet_data_append(packet, ntb + datagram_index, datagram_length,
+                                           cdc_ncm -> ux_slave_class_cdc_ncm_packet_pool,
+                                           UX_MS_TO_TICK(UX_DEVICE_CLASS_CDC_NCM_PACKET_POOL_WAIT));
+            if (status == NX_SUCCESS)
+            {
+
+                /* Send that packet to the NetX USB broker.  */
+                cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_ok ++;
+                _ux_network_driver_packet_received(cdc_ncm -> ux_slave_class_cdc_ncm_network_handle, packet);
+            }
+            else
+            {
+
+                /* We received a malformed packet. Report to application.  */
+                cdc_ncm -> ux_slave_class_cdc_ncm_statistics_rcv_error ++;
+                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
+                nx_packet_release(packet);
+            }
+        }
+    }
+
+    /* NTB processed.  */
+    return(UX_SUCCESS);
+}
+#endif
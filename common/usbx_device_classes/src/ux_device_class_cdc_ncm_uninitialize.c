@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   Device CDC-NCM Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_cdc_ncm.h"
+#include "ux_device_stack.h"
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    _ux_device_class_cdc_ncm_uninitialize               PORTABLE C      */ 
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */ 
+/*    This function deinitializes the resources for the specified CDC-NCM */ 
+/*    instance.                                                           */ 
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    command                               Pointer to storage command    */ 
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    Completion Status                                                   */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    _ux_device_mutex_delete               Delete mutex                  */ 
+/*    _ux_device_thread_delete              Delete thread                 */ 
+/*    _ux_utility_memory_free               Free memory                   */ 
+/*    _ux_utility_event_flags_delete        Delete event flags            */ 
+/*    _ux_device_semaphore_delete           Delete semaphore              */ 
+/*                                                                        */ 
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    Device CDC-NCM Class                                                */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */ 
+/*                                                                        */ 
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_device_class_cdc_ncm_uninitialize(UX_SLAVE_CLASS_COMMAND *command)
+{
+                                          
+UX_SLAVE_CLASS_CDC_NCM                  *cdc_ncm;
+UX_SLAVE_CLASS                          *class_ptr;
+
+
+    /* Get the class container.  */
+    class_ptr =  command -> ux_slave_class_command_class_ptr;
+
+    /* Get the class instance in the container.  */
+    cdc_ncm = (UX_SLAVE_CLASS_CDC_NCM *) class_ptr -> ux_slave_class_instance;
+    
+    /* Sanity check.  */
+    if (cdc_ncm != UX_NULL)
+    {
+
+        /* Deinitialize resources. We do not check if they have been allocated
+           because if they weren't, the class register (called by the application)
+           would have failed.  */
+
+#if !defined(UX_DEVICE_STANDALONE)
+
+        /* Delete the xmit queue mutex.  */
+        _ux_device_mutex_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_mutex);
+
+        /* Delete bulk out thread .  */
+        _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread);
+
+        /* Free bulk out thread stack.  */
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_bulkout_thread_stack);
+
+        /* Delete interrupt thread.  */
+        _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread);
+
+        /* Free interrupt thread stack.  */
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_interrupt_thread_stack);
+
+        /* Delete bulk in thread.  */
+        _ux_device_thread_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread);
+
+        /* Free bulk in thread stack.  */
+        _ux_utility_memory_free(cdc_ncm -> ux_slave_class_cdc_ncm_bulkin_thread_stack);
+
+        /* Delete the interrupt thread sync event flags group.  */
+        _ux_device_event_flags_delete(&cdc_ncm -> ux_slave_class_cdc_ncm_event_flags_group);
+
+#endif
+
+        /* Free the resources.  */
+        _ux_utility_memory_free(cdc_ncm);
+    }
+    
+    /* Return completion status.  */
+    return(UX_SUCCESS);
+}
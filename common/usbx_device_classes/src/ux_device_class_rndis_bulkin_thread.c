@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_rndis_bulkin_thread                PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -88,6 +88,9 @@
 /*  10-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            used NX API to copy data,   */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added packets aggregation,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_device_class_rndis_bulkin_thread(ULONG rndis_class)
@@ -102,6 +105,12 @@ ULONG                           actual_flags;
 NX_PACKET                       *current_packet;
 ULONG                           transfer_length;
 ULONG                           copied;
+ULONG                           transfer_limit;
+ULONG                           message_length;
+ULONG                           message_offset;
+ULONG                           previous_offset = 0;
+ULONG                           packet_count;
+UCHAR                           *message;
 
     /* Cast properly the rndis instance.  */
     UX_THREAD_EXTENSION_PTR_GET(class_ptr, UX_SLAVE_CLASS, rndis_class)
@@ -137,73 +146,122 @@ ULONG                           copied;
                 while(rndis -> ux_slave_class_rndis_xmit_queue != UX_NULL)
                 {
 
-                    /* Protect this thread.  */
-                    _ux_device_mutex_on(&rndis -> ux_slave_class_rndis_mutex);
-                
-                    /* Get the current packet in the list.  */
-                    current_packet =  rndis -> ux_slave_class_rndis_xmit_queue;
-                    
-                    /* Set the next packet (or a NULL value) as the head of the xmit queue. */
-                    rndis -> ux_slave_class_rndis_xmit_queue =  current_packet -> nx_packet_queue_next;
-                    
-                    /* Free Mutex resource.  */
-                    _ux_device_mutex_off(&rndis -> ux_slave_class_rndis_mutex);
-                        
-                    /* If the link is down no need to rearm a packet. */
-                    if (rndis -> ux_slave_class_rndis_link_state == UX_DEVICE_CLASS_RNDIS_LINK_STATE_UP)
+                    /* Packets after the first one are concatenated in the transfer as long as
+                       they fit in both the buffer and the host MaxTransferSize.  */
+                    transfer_limit =  UX_MIN(rndis -> ux_slave_class_rndis_max_transfer_size, UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
+                    transfer_length =  0;
+                    message_offset =  0;
+                    packet_count =  0;
+
+                    /* Build messages in the transfer buffer.  */
+                    while (packet_count < UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER)
                     {
-                
-                        /* Calculate the transfer length.  */
-                        transfer_length =  current_packet -> nx_packet_length + UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH;
 
-                        /* Is there enough space for this packet in the transfer buffer?  */
-                        if (transfer_length <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH)
+                        /* Protect this thread.  */
+                        _ux_device_mutex_on(&rndis -> ux_slave_class_rndis_mutex);
+
+                        /* Get the current packet in the list.  */
+                        current_packet =  rndis -> ux_slave_class_rndis_xmit_queue;
+
+                        /* Stop if there is no more packet, or the packet can not be appended.  */
+                        if ((current_packet == UX_NULL) ||
+                            ((packet_count > 0) &&
+                             (UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_ALIGN(transfer_length) + UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH +
+                              current_packet -> nx_packet_length > transfer_limit)))
+                        {
+
+                            /* Free Mutex resource.  */
+                            _ux_device_mutex_off(&rndis -> ux_slave_class_rndis_mutex);
+                            break;
+                        }
+
+                        /* Set the next packet (or a NULL value) as the head of the xmit queue. */
+                        rndis -> ux_slave_class_rndis_xmit_queue =  current_packet -> nx_packet_queue_next;
+
+                        /* Free Mutex resource.  */
+                        _ux_device_mutex_off(&rndis -> ux_slave_class_rndis_mutex);
+
+                        /* If the link is down no need to rearm a packet. */
+                        if (rndis -> ux_slave_class_rndis_link_state == UX_DEVICE_CLASS_RNDIS_LINK_STATE_UP)
                         {
 
-                            /* Copy the packet in the transfer descriptor buffer.  */
-                            status = nx_packet_data_extract_offset(current_packet, 0,
-                                    transfer_request -> ux_slave_transfer_request_data_pointer +
-                                                    UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH,
-                                    current_packet -> nx_packet_length, &copied);
-                            if (status == NX_SUCCESS)
+                            /* Calculate the message length.  */
+                            message_length =  current_packet -> nx_packet_length + UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH;
+
+                            /* Is there enough space for this packet in the transfer buffer?  */
+                            if (message_length <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH)
                             {
 
-                                /* Add the RNDIS header to this packet.  */
-                                _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_TYPE, UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_MSG);
-                                _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_LENGTH, transfer_length);
-                                _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_OFFSET, 
-                                                        UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH - UX_DEVICE_CLASS_RNDIS_PACKET_DATA_OFFSET);
-                                _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_LENGTH, current_packet -> nx_packet_length);
-                                                        
-                                /* If trace is enabled, insert this event into the trace buffer.  */
-                                UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_RNDIS_PACKET_TRANSMIT, rndis, 0, 0, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
-
-                                /* Send the request to the device controller.  */
-                                status =  _ux_device_stack_transfer_request(transfer_request, transfer_length, UX_DEVICE_CLASS_RNDIS_ETHERNET_PACKET_SIZE + 1);
+                                /* Concatenated message starts aligned.  */
+                                if (packet_count > 0)
+                                    message_offset =  UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_ALIGN(transfer_length);
+                                message =  transfer_request -> ux_slave_transfer_request_data_pointer + message_offset;
+
+                                /* Copy the packet in the transfer descriptor buffer.  */
+                                status = nx_packet_data_extract_offset(current_packet, 0,
+                                                    message + UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH,
+                                                    current_packet -> nx_packet_length, &copied);
+                                if (status == NX_SUCCESS)
+                                {
+
+                                    /* The previous message is padded up to this one.  */
+                                    if (packet_count > 0)
+                                        _ux_utility_long_put(transfer_request -> ux_slave_transfer_request_data_pointer + previous_offset + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_LENGTH,
+                                                                message_offset - previous_offset);
+
+                                    /* Add the RNDIS header to this packet.  */
+                                    _ux_utility_long_put(message + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_TYPE, UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_MSG);
+                                    _ux_utility_long_put(message + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_LENGTH, message_length);
+                                    _ux_utility_long_put(message + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_OFFSET, 
+                                                            UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH - UX_DEVICE_CLASS_RNDIS_PACKET_DATA_OFFSET);
+                                    _ux_utility_long_put(message + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_LENGTH, current_packet -> nx_packet_length);
+
+                                    /* One more message in the transfer.  */
+                                    previous_offset =  message_offset;
+                                    transfer_length =  message_offset + message_length;
+                                    packet_count ++;
+                                }
+                                else
+
+                                    /* Error trap. */
+                                    _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, status);
                             }
+                            else
+                            {
 
-                            /* Check for error. */
-                            if (status != UX_SUCCESS)
-                            
-                                /* Error trap. */
-                                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, status);
+                                /* No, there is not enough space.  */
+
+                                /* Report error to application. */
+                                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+                            }
                         }
-                        else
-                        {
 
-                            /* No, there is not enough space.  */
+                        /* Free the packet that was just copied.  First do some housekeeping.  */
+                        current_packet -> nx_packet_prepend_ptr =  current_packet -> nx_packet_prepend_ptr + UX_DEVICE_CLASS_RNDIS_ETHERNET_SIZE; 
+                        current_packet -> nx_packet_length =  current_packet -> nx_packet_length - UX_DEVICE_CLASS_RNDIS_ETHERNET_SIZE;
 
-                            /* Report error to application. */
-                            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
-                        }
-                    }        
-               
-                    /* Free the packet that was just sent.  First do some housekeeping.  */
-                    current_packet -> nx_packet_prepend_ptr =  current_packet -> nx_packet_prepend_ptr + UX_DEVICE_CLASS_RNDIS_ETHERNET_SIZE; 
-                    current_packet -> nx_packet_length =  current_packet -> nx_packet_length - UX_DEVICE_CLASS_RNDIS_ETHERNET_SIZE;
-                
-                    /* And ask Netx to release it.  */
-                    nx_packet_transmit_release(current_packet); 
+                        /* And ask Netx to release it.  */
+                        nx_packet_transmit_release(current_packet); 
+                    }
+
+                    /* Send the messages if any.  */
+                    if (packet_count > 0)
+                    {
+
+                        /* If trace is enabled, insert this event into the trace buffer.  */
+                        UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_RNDIS_PACKET_TRANSMIT, rndis, 0, 0, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+                        /* Send the request to the device controller. Concatenated messages end
+                           with the host buffer (no ZLP) or a short packet.  */
+                        status =  _ux_device_stack_transfer_request(transfer_request, transfer_length,
+                                            (packet_count > 1) ? transfer_limit : UX_DEVICE_CLASS_RNDIS_ETHERNET_PACKET_SIZE + 1);
+
+                        /* Check for error. */
+                        if (status != UX_SUCCESS)
+
+                            /* Error trap. */
+                            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, status);
+                    }
                 }
             }
             else
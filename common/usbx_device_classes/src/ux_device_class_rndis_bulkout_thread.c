@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_rndis_bulkout_thread               PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -88,6 +88,9 @@
 /*                                            used NX API to copy data,   */
 /*                                            used linked NX IP pool,     */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added packets aggregation,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_device_class_rndis_bulkout_thread(ULONG rndis_class)
@@ -101,6 +104,10 @@ UINT                            status;
 NX_PACKET                       *packet;
 ULONG                           packet_payload;
 USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
+UCHAR                           *message;
+ULONG                           message_length;
+ULONG                           message_count;
+ULONG                           remaining_length;
 
     /* Cast properly the rndis instance.  */
     UX_THREAD_EXTENSION_PTR_GET(class_ptr, UX_SLAVE_CLASS, rndis_class)
@@ -153,7 +160,7 @@ USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
             {
 
                 /* And length.  */
-                transfer_request -> ux_slave_transfer_request_requested_length =  UX_DEVICE_CLASS_RNDIS_MAX_MSG_LENGTH;
+                transfer_request -> ux_slave_transfer_request_requested_length =  UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH;
                 transfer_request -> ux_slave_transfer_request_actual_length =     0;
             
                 /* Memorize this packet at the beginning of the queue.  */
@@ -163,8 +170,8 @@ USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
                 packet -> nx_packet_queue_next = UX_NULL;
                         
                 /* Send the request to the device controller.  */
-                status =  _ux_device_stack_transfer_request(transfer_request, UX_DEVICE_CLASS_RNDIS_MAX_MSG_LENGTH,
-                                                                UX_DEVICE_CLASS_RNDIS_MAX_MSG_LENGTH);
+                status =  _ux_device_stack_transfer_request(transfer_request, UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH,
+                                                                UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH);
 
                 /* Check the completion code. */
                 if (status == UX_SUCCESS)
@@ -174,46 +181,61 @@ USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
                     /* If trace is enabled, insert this event into the trace buffer.  */
                     UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_RNDIS_PACKET_RECEIVE, rndis, 0, 0, 0, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
 
-                    /* Check the state of the transfer.  If there is an error, we do not proceed with this report.
-                       Ensure this packet is at least larger than the header.
-                       Also ensure the header has a valid ID of 1.  */
-                    if (transfer_request -> ux_slave_transfer_request_actual_length > UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH &&
-                        _ux_utility_long_get(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_TYPE) == UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_MSG)
+                    /* The transfer may contain several messages (aggregation), parse them all.  */
+                    message =  transfer_request -> ux_slave_transfer_request_data_pointer;
+                    remaining_length =  transfer_request -> ux_slave_transfer_request_actual_length;
+                    message_count =  0;
+                    while(1)
                     {
 
-                        /* Get the size of the payload.  */
-                        packet_payload =  _ux_utility_long_get(transfer_request -> ux_slave_transfer_request_data_pointer + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_LENGTH);
-
-                        /* Ensure the length reported in the RNDIS header is not larger than it actually is.
-                            The reason we can't check to see if the length reported in the header and the
-                            actual length are exactly equal is because there might other data after the payload 
-                            (padding, or even a message). */
-                        if (packet_payload <= transfer_request -> ux_slave_transfer_request_actual_length - UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH)
+                        /* Check the state of the transfer.  If there is an error, we do not proceed with this report.
+                           Ensure this packet is at least larger than the header.
+                           Also ensure the header has a valid ID of 1.  */
+                        if (remaining_length > UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH &&
+                            _ux_utility_long_get(message + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_TYPE) == UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_MSG)
                         {
 
-                            /* Adjust the prepend pointer to take into account the non 3 bit alignment of the ethernet header.  */
-                            packet -> nx_packet_prepend_ptr += sizeof(USHORT);
-                            packet -> nx_packet_append_ptr += sizeof(USHORT);
-
-                            /* Copy the received packet in the IP packet data area.  */
-                            status = nx_packet_data_append(packet,
-                                    transfer_request -> ux_slave_transfer_request_data_pointer +
-                                                            UX_DEVICE_CLASS_RNDIS_PACKET_BUFFER,
-                                    packet_payload,
-                                    rndis -> ux_slave_class_rndis_packet_pool,
-                                    UX_MS_TO_TICK(UX_DEVICE_CLASS_RNDIS_PACKET_POOL_WAIT));
-                            if (status == UX_SUCCESS)
+                            /* Get the size of the payload.  */
+                            packet_payload =  _ux_utility_long_get(message + UX_DEVICE_CLASS_RNDIS_PACKET_DATA_LENGTH);
+
+                            /* Ensure the length reported in the RNDIS header is not larger than it actually is.
+                                The reason we can't check to see if the length reported in the header and the
+                                actual length are exactly equal is because there might other data after the payload 
+                                (padding, or even a message). */
+                            if (packet_payload <= remaining_length - UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH)
                             {
 
-                                /* Send that packet to the NetX USB broker.  */
-                                _ux_network_driver_packet_received(rndis -> ux_slave_class_rndis_network_handle, packet);
+                                /* Adjust the prepend pointer to take into account the non 3 bit alignment of the ethernet header.  */
+                                packet -> nx_packet_prepend_ptr += sizeof(USHORT);
+                                packet -> nx_packet_append_ptr += sizeof(USHORT);
+
+                                /* Copy the received packet in the IP packet data area.  */
+                                status = nx_packet_data_append(packet,
+                                        message + UX_DEVICE_CLASS_RNDIS_PACKET_BUFFER,
+                                        packet_payload,
+                                        rndis -> ux_slave_class_rndis_packet_pool,
+                                        UX_MS_TO_TICK(UX_DEVICE_CLASS_RNDIS_PACKET_POOL_WAIT));
+                                if (status == UX_SUCCESS)
+                                {
+
+                                    /* Send that packet to the NetX USB broker.  */
+                                    _ux_network_driver_packet_received(rndis -> ux_slave_class_rndis_network_handle, packet);
+                                }
+                                else
+                                {
+
+                                    /* Error.  */
+                                    _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_ETH_PACKET_ERROR);
+                                    nx_packet_release(packet);
+                                }
                             }
                             else
                             {
 
-                                /* Error.  */
-                                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_ETH_PACKET_ERROR);
+                                /* We received a malformed packet. Report to application.  */
+                                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
                                 nx_packet_release(packet);
+                                break;
                             }
                         }
                         else
@@ -222,14 +244,34 @@ USB_NETWORK_DEVICE_TYPE         *ux_nx_device;
                             /* We received a malformed packet. Report to application.  */
                             _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
                             nx_packet_release(packet);
+                            break;
                         }
-                    }
-                    else
-                    {
 
-                        /* We received a malformed packet. Report to application.  */
-                        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_MALFORMED_PACKET_RECEIVED_ERROR);
-                        nx_packet_release(packet);
+                        /* Check if another message follows this one.  */
+                        message_length =  _ux_utility_long_get(message + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_LENGTH);
+                        message_count ++;
+                        if ((message_count >= UX_DEVICE_CLASS_RNDIS_MAX_PACKET_PER_TRANSFER) ||
+                            (message_length < UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH) ||
+                            (message_length >= remaining_length) ||
+                            (remaining_length - message_length <= UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_LENGTH))
+                            break;
+
+                        /* Move to next message, padding is ignored.  */
+                        message +=  message_length;
+                        remaining_length -=  message_length;
+                        if (_ux_utility_long_get(message + UX_DEVICE_CLASS_RNDIS_PACKET_MESSAGE_TYPE) != UX_DEVICE_CLASS_RNDIS_PACKET_HEADER_MSG)
+                            break;
+
+                        /* Get a NX Packet for the next message.  */
+                        status =  nx_packet_allocate(rndis -> ux_slave_class_rndis_packet_pool, &packet,
+                                                     NX_RECEIVE_PACKET, UX_MS_TO_TICK(UX_DEVICE_CLASS_RNDIS_PACKET_POOL_WAIT));
+                        if (status != NX_SUCCESS)
+                        {
+
+                            /* Error trap. No need for trace, since NetX does it.  */
+                            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+                            break;
+                        }
                     }
                 }
                 else
@@ -141,6 +141,7 @@ ULONG ux_device_class_rndis_oid_supported_list[UX_DEVICE_CLASS_RNDIS_OID_SUPPORT
 /*                                            resulting in version 6.2.0  */
 /*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            checked compile options,    */
+/*                                            added packets aggregation,  */
 /*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
@@ -159,6 +160,7 @@ UINT                                        status;
 
     /* Compile option checks.  */
     UX_ASSERT(UX_DEVICE_CLASS_RNDIS_MAX_MSG_LENGTH <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
+    UX_ASSERT(UX_DEVICE_CLASS_RNDIS_MAX_RECEIVE_LENGTH <= UX_SLAVE_REQUEST_DATA_MAX_LENGTH);
     UX_ASSERT(UX_DEVICE_CLASS_RNDIS_MAX_CONTROL_RESPONSE_LENGTH <= UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH);
 
     /* Get the class container.  */
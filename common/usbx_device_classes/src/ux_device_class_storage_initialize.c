@@ -41,7 +41,7 @@ UCHAR _ux_system_slave_class_storage_product_serial[] =                     "123
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_device_class_storage_initialize                 PORTABLE C      */
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -64,6 +64,9 @@ UCHAR _ux_system_slave_class_storage_product_serial[] =                     "123
 /*    _ux_utility_memory_free               Free memory                   */
 /*    _ux_device_thread_create              Create thread                 */
 /*    _ux_device_thread_delete              Delete thread                 */
+/*    _ux_device_thread_resume              Resume thread                 */
+/*    _ux_device_semaphore_create           Create semaphore              */
+/*    _ux_device_semaphore_delete           Delete semaphore              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -82,6 +85,9 @@ UCHAR _ux_system_slave_class_storage_product_serial[] =                     "123
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added RTOS double buffer,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_class_storage_initialize(UX_SLAVE_CLASS_COMMAND *command)
@@ -172,6 +178,42 @@ ULONG                                   lun_index;
             storage -> ux_slave_class_storage_lun[lun_index].ux_slave_class_storage_media_notification   = storage_parameter -> ux_slave_class_storage_parameter_lun[lun_index].ux_slave_class_storage_media_notification;
         }
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+        /* Create the media thread resources, the media thread reads/writes
+           one buffer while the other one is transferred on USB.  */
+        if (status == UX_SUCCESS)
+            status =  _ux_device_semaphore_create(&storage -> ux_device_class_storage_media_request_semaphore,
+                                                  "ux_device_class_storage_media_request_semaphore", 0);
+        if (status == UX_SUCCESS)
+            status =  _ux_device_semaphore_create(&storage -> ux_device_class_storage_media_done_semaphore,
+                                                  "ux_device_class_storage_media_done_semaphore", 0);
+        if (status == UX_SUCCESS)
+        {
+
+            /* Allocate some memory for the media thread stack. */
+            storage -> ux_device_class_storage_media_thread_stack =
+                    _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, UX_THREAD_STACK_SIZE);
+            if (storage -> ux_device_class_storage_media_thread_stack == UX_NULL)
+                status =  UX_MEMORY_INSUFFICIENT;
+        }
+        if (status == UX_SUCCESS)
+        {
+
+            /* Create the media thread, it waits for media requests.  */
+            status =  _ux_device_thread_create(&storage -> ux_device_class_storage_media_thread, "ux_device_class_storage_media_thread",
+                        _ux_device_class_storage_media_thread,
+                        (ULONG) (ALIGN_TYPE) storage, (VOID *) storage -> ux_device_class_storage_media_thread_stack,
+                        UX_THREAD_STACK_SIZE, UX_THREAD_PRIORITY_CLASS,
+                        UX_THREAD_PRIORITY_CLASS, UX_NO_TIME_SLICE, UX_DONT_START);
+            if (status == UX_SUCCESS)
+            {
+                UX_THREAD_EXTENSION_PTR_SET(&(storage -> ux_device_class_storage_media_thread), storage)
+                _ux_device_thread_resume(&storage -> ux_device_class_storage_media_thread);
+            }
+        }
+#endif
+
         /* If it's OK, complete it.  */
         if (status == UX_SUCCESS)
         {
@@ -211,6 +253,17 @@ ULONG                                   lun_index;
         _ux_device_thread_delete(&class_inst -> ux_slave_class_thread);
     }
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+    /* Free media thread resources.  */
+    if (_ux_device_semaphore_created(&storage -> ux_device_class_storage_media_request_semaphore))
+        _ux_device_semaphore_delete(&storage -> ux_device_class_storage_media_request_semaphore);
+    if (_ux_device_semaphore_created(&storage -> ux_device_class_storage_media_done_semaphore))
+        _ux_device_semaphore_delete(&storage -> ux_device_class_storage_media_done_semaphore);
+    if (storage -> ux_device_class_storage_media_thread_stack != UX_NULL)
+        _ux_utility_memory_free(storage -> ux_device_class_storage_media_thread_stack);
+#endif
+
 #if !defined(UX_DEVICE_STANDALONE)
     if (class_inst -> ux_slave_class_thread_stack != UX_NULL)
         _ux_utility_memory_free(&class_inst -> ux_slave_class_thread_stack);
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device Storage Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_storage.h"
+#include "ux_device_stack.h"
+
+
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_storage_media_request              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts a media read or write in the storage media     */
+/*    thread. The result is obtained by                                   */
+/*    _ux_device_class_storage_media_wait.                                */
+/*                                                                        */
+/*    It's for RTOS mode.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    storage                               Pointer to storage class      */
+/*    op                                    Media operation (read/write)  */
+/*    lun                                   Logical unit number           */
+/*    buffer                                Data buffer                   */
+/*    number_blocks                         Number of blocks              */
+/*    lba                                   Logical block address         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_device_semaphore_put              Put semaphore                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Device Storage Class                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_class_storage_media_request(UX_SLAVE_CLASS_STORAGE *storage, ULONG op, ULONG lun,
+                                             UCHAR *buffer, ULONG number_blocks, ULONG lba)
+{
+
+    /* Save the request parameters.  */
+    storage -> ux_device_class_storage_media_op =  op;
+    storage -> ux_device_class_storage_media_op_lun =  lun;
+    storage -> ux_device_class_storage_media_op_buffer =  buffer;
+    storage -> ux_device_class_storage_media_op_n_lb =  number_blocks;
+    storage -> ux_device_class_storage_media_op_lba =  lba;
+
+    /* Wake up the media thread.  */
+    _ux_device_semaphore_put(&storage -> ux_device_class_storage_media_request_semaphore);
+}
+#endif
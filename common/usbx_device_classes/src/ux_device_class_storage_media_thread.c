@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Device Storage Class                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define UX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "ux_api.h"
+#include "ux_device_class_storage.h"
+#include "ux_device_stack.h"
+
+
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_device_class_storage_media_thread               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the media thread of the storage class. It runs     */
+/*    the media read/write requested by the storage class thread, so the  */
+/*    media access of one buffer overlaps the USB transfer of the other.  */
+/*                                                                        */
+/*    It's for RTOS mode.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    storage_instance                      Address of storage instance   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (ux_slave_class_storage_media_status) Get media status              */
+/*    (ux_slave_class_storage_media_read)   Read from media               */
+/*    (ux_slave_class_storage_media_write)  Write to media                */
+/*    _ux_device_semaphore_get              Get semaphore                 */
+/*    _ux_device_semaphore_put              Put semaphore                 */
+/*    _ux_system_error_handler              System error trap             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX                                                             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_device_class_storage_media_thread(ULONG storage_instance)
+{
+
+UX_SLAVE_CLASS_STORAGE      *storage;
+UX_SLAVE_CLASS_STORAGE_LUN  *storage_lun;
+UINT                        status;
+ULONG                       media_status;
+ULONG                       read_status;
+
+
+    /* Get storage class instance.  */
+    UX_THREAD_EXTENSION_PTR_GET(storage, UX_SLAVE_CLASS_STORAGE, storage_instance)
+
+    /* This thread runs forever, waiting for media requests.  */
+    while(1)
+    {
+
+        /* Wait for a request from the storage class thread.  */
+        status =  _ux_device_semaphore_get(&storage -> ux_device_class_storage_media_request_semaphore, UX_WAIT_FOREVER);
+        if (status != UX_SUCCESS)
+        {
+
+            /* Error notification!  */
+            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_SEMAPHORE_ERROR);
+            continue;
+        }
+
+        /* Get the LUN to access.  */
+        storage_lun =  &storage -> ux_slave_class_storage_lun[storage -> ux_device_class_storage_media_op_lun];
+
+        if (storage -> ux_device_class_storage_media_op == UX_DEVICE_CLASS_STORAGE_MEDIA_READ)
+        {
+
+            /* Obtain the status of the device.  */
+            status =  storage_lun -> ux_slave_class_storage_media_status(storage,
+                                    storage -> ux_device_class_storage_media_op_lun,
+                                    storage_lun -> ux_slave_class_storage_media_id, &media_status);
+
+            /* If the media is ready, execute the read command from the local media.  */
+            if (status == UX_SUCCESS)
+            {
+                status =  storage_lun -> ux_slave_class_storage_media_read(storage,
+                                    storage -> ux_device_class_storage_media_op_lun,
+                                    storage -> ux_device_class_storage_media_op_buffer,
+                                    storage -> ux_device_class_storage_media_op_n_lb,
+                                    storage -> ux_device_class_storage_media_op_lba, &read_status);
+
+                /* On read error, the read status is reported for sense.  */
+                if (status != UX_SUCCESS)
+                    media_status =  read_status;
+            }
+        }
+        else
+        {
+
+            /* Execute the write command to the local media.  */
+            status =  storage_lun -> ux_slave_class_storage_media_write(storage,
+                                    storage -> ux_device_class_storage_media_op_lun,
+                                    storage -> ux_device_class_storage_media_op_buffer,
+                                    storage -> ux_device_class_storage_media_op_n_lb,
+                                    storage -> ux_device_class_storage_media_op_lba, &media_status);
+        }
+
+        /* Save the results.  */
+        storage -> ux_device_class_storage_media_op_status =  status;
+        storage -> ux_device_class_storage_media_op_media_status =  media_status;
+
+        /* Signal the storage class thread that the request is done.  */
+        _ux_device_semaphore_put(&storage -> ux_device_class_storage_media_done_semaphore);
+    }
+}
+#endif
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_storage_read                       PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,6 +60,10 @@
 /*                                                                        */ 
 /*    (ux_slave_class_storage_media_read)   Read from media               */ 
 /*    (ux_slave_class_storage_media_status) Get media status              */ 
+/*    _ux_device_class_storage_media_request                              */
+/*                                          Start media read/write        */
+/*    _ux_device_class_storage_media_wait                                 */
+/*                                          Wait media read/write         */
 /*    _ux_device_stack_endpoint_stall       Stall endpoint                */ 
 /*    _ux_device_stack_transfer_request     Transfer request              */ 
 /*    _ux_utility_long_get_big_endian       Get 32-bit big endian         */ 
@@ -84,6 +88,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added RTOS double buffer,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_class_storage_read(UX_SLAVE_CLASS_STORAGE *storage, ULONG lun, 
@@ -102,6 +109,12 @@ ULONG                   total_length;
 ULONG                   number_blocks; 
 ULONG                   transfer_length;
 ULONG                   done_length;
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+UCHAR                   *buffer[2];
+ULONG                   buffer_index;
+ULONG                   next_length;
+ULONG                   next_number_blocks;
+#endif
 #endif
 
 
@@ -191,6 +204,120 @@ ULONG                   done_length;
         return(UX_ERROR);
     }
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+    /* Use the IN and OUT endpoint buffers in turn: the media thread reads the
+       next block into one buffer while the other buffer is sent to the host.  */
+    buffer[0] =  transfer_request -> ux_slave_transfer_request_data_pointer;
+    buffer[1] =  endpoint_out -> ux_slave_endpoint_transfer_request.ux_slave_transfer_request_data_pointer;
+    buffer_index =  0;
+
+    /* Compute the first transfer and start reading it from the local media.  */
+    done_length = 0;
+    transfer_length =  UX_MIN(total_length, UX_SLAVE_CLASS_STORAGE_BUFFER_SIZE);
+    number_blocks = transfer_length / storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_media_block_length;
+    if (total_number_blocks)
+    {
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_STORAGE_READ, storage, lun, buffer[0],
+                                number_blocks, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+        _ux_device_class_storage_media_request(storage, UX_DEVICE_CLASS_STORAGE_MEDIA_READ, lun,
+                                               buffer[0], number_blocks, lba);
+    }
+
+    /* It may take several transfers to send the requested data.  */
+    while (total_number_blocks)
+    {
+
+        /* Wait for the media read of the current buffer.  */
+        status =  _ux_device_class_storage_media_wait(storage, &media_status);
+
+        /* Update the request sense.  */
+        storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_request_sense_status = media_status;
+
+        /* If there is a problem, return a failed command.  */
+        if (status != UX_SUCCESS)
+        {
+
+            /* We have a problem, request error. Return a bad completion and wait for the
+               REQUEST_SENSE command.  */
+            _ux_device_stack_endpoint_stall(endpoint_in);
+
+            /* Update residue.  */
+            storage -> ux_slave_class_storage_csw_residue = storage -> ux_slave_class_storage_host_length - done_length;
+
+            /* Restore the buffer of the transfer request.  */
+            transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+
+            /* Return an error.  */
+            return(UX_ERROR);
+        }
+
+        /* Update the LBA address and the number of blocks to read.  */
+        lba += number_blocks;
+        total_number_blocks -= number_blocks;
+
+        /* Start reading the next block into the other buffer.  */
+        next_length =  UX_MIN(total_length - transfer_length, UX_SLAVE_CLASS_STORAGE_BUFFER_SIZE);
+        next_number_blocks = next_length / storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_media_block_length;
+        if (total_number_blocks)
+        {
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            UX_TRACE_IN_LINE_INSERT(UX_TRACE_DEVICE_CLASS_STORAGE_READ, storage, lun, buffer[buffer_index ^ 1],
+                                    next_number_blocks, UX_TRACE_DEVICE_CLASS_EVENTS, 0, 0)
+
+            _ux_device_class_storage_media_request(storage, UX_DEVICE_CLASS_STORAGE_MEDIA_READ, lun,
+                                                   buffer[buffer_index ^ 1], next_number_blocks, lba);
+        }
+
+        /* Sends the data payload back to the caller.  */
+        transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[buffer_index];
+        status =  _ux_device_stack_transfer_request(transfer_request, transfer_length, transfer_length);
+
+        /* Check the status.  */
+        if(status != UX_SUCCESS)
+        {
+
+            /* The next media read uses the other buffer, wait for it before leaving.  */
+            if (total_number_blocks)
+                _ux_device_class_storage_media_wait(storage, &media_status);
+
+            /* We have a problem, request error. Return a bad completion and wait for the
+               REQUEST_SENSE command.  */
+            _ux_device_stack_endpoint_stall(endpoint_in);
+    
+            /* Update residue.  */
+            storage -> ux_slave_class_storage_csw_residue = storage -> ux_slave_class_storage_host_length - done_length;
+
+            /* Update the REQUEST_SENSE codes.  */
+            storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_request_sense_status =
+                                                UX_DEVICE_CLASS_STORAGE_SENSE_STATUS(0x02,0x54,0x00);
+
+            /* Restore the buffer of the transfer request.  */
+            transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+
+            /* Return an error.  */
+            return(UX_ERROR);
+
+        }
+
+        /* Update the length to remain.  */
+        total_length -= transfer_length;
+        done_length += transfer_length;
+
+        /* Next transfer uses the other buffer.  */
+        transfer_length =  next_length;
+        number_blocks =  next_number_blocks;
+        buffer_index ^= 1;
+    }
+
+    /* Restore the buffer of the transfer request.  */
+    transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+#else
+
     /* It may take several transfers to send the requested data.  */
     done_length = 0;
     while (total_number_blocks)
@@ -291,6 +418,7 @@ ULONG                   done_length;
         /* Update the number of blocks to read.  */
         total_number_blocks -= number_blocks;
     }
+#endif
 
     /* Case (4), (5). Host length too large.  */
     if (storage -> ux_slave_class_storage_host_length > done_length)
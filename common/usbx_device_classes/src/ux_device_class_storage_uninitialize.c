@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_storage_uninitialize               PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,7 @@
 /*                                                                        */ 
 /*    _ux_utility_memory_free               Free memory                   */
 /*    _ux_device_thread_delete              Delete thread                 */
+/*    _ux_device_semaphore_delete           Delete semaphore              */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -75,6 +76,9 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added RTOS double buffer,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_class_storage_uninitialize(UX_SLAVE_CLASS_COMMAND *command)
@@ -101,6 +105,15 @@ UX_SLAVE_CLASS                          *class_ptr;
         _ux_utility_memory_free(class_ptr -> ux_slave_class_thread_stack);
 #endif
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+        /* Remove the media thread and its resources.  */
+        _ux_device_thread_delete(&storage -> ux_device_class_storage_media_thread);
+        _ux_utility_memory_free(storage -> ux_device_class_storage_media_thread_stack);
+        _ux_device_semaphore_delete(&storage -> ux_device_class_storage_media_request_semaphore);
+        _ux_device_semaphore_delete(&storage -> ux_device_class_storage_media_done_semaphore);
+#endif
+
         /* Free the resources.  */
         _ux_utility_memory_free(storage);
     }
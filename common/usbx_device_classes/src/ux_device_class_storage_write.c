@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_device_class_storage_write                      PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,6 +60,10 @@
 /*    (ux_slave_class_storage_media_status) Get media status              */ 
 /*    (ux_slave_class_storage_media_write)  Write to media                */ 
 /*    _ux_device_class_storage_csw_send     Send CSW                      */ 
+/*    _ux_device_class_storage_media_request                              */
+/*                                          Start media read/write        */
+/*    _ux_device_class_storage_media_wait                                 */
+/*                                          Wait media read/write         */
 /*    _ux_device_stack_endpoint_stall       Stall endpoint                */ 
 /*    _ux_device_stack_transfer_request     Transfer request              */ 
 /*    _ux_utility_long_get_big_endian       Get 32-bit big endian         */ 
@@ -86,6 +90,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added RTOS double buffer,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_device_class_storage_write(UX_SLAVE_CLASS_STORAGE *storage, ULONG lun, 
@@ -104,6 +111,12 @@ ULONG                   total_length;
 ULONG                   number_blocks; 
 ULONG                   transfer_length;
 ULONG                   done_length;
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+UCHAR                   *buffer[2];
+ULONG                   buffer_index;
+ULONG                   media_length;
+UINT                    media_write_status;
+#endif
 #endif
 
 
@@ -215,6 +228,117 @@ ULONG                   done_length;
         return(UX_ERROR);
     }
 
+#if defined(UX_DEVICE_CLASS_STORAGE_DOUBLE_BUFFER_ENABLE)
+
+    /* Use the OUT and IN endpoint buffers in turn: the media thread writes one
+       buffer to the media while the next block is received in the other one.  */
+    buffer[0] =  transfer_request -> ux_slave_transfer_request_data_pointer;
+    buffer[1] =  endpoint_in -> ux_slave_endpoint_transfer_request.ux_slave_transfer_request_data_pointer;
+    buffer_index =  0;
+    media_length =  0;
+
+    /* Default status to success.  */
+    status =  UX_SUCCESS;
+
+    /* It may take several transfers to send the requested data.  */
+    done_length = 0;
+    while (total_length || media_length)
+    {
+
+        /* Receive the next block while the previous one is written.  */
+        if (total_length)
+        {
+
+            /* How much can we receive in this transfer?  */
+            if (total_length > UX_SLAVE_CLASS_STORAGE_BUFFER_SIZE)
+                transfer_length =  UX_SLAVE_CLASS_STORAGE_BUFFER_SIZE;
+            else
+                transfer_length =  total_length;
+
+            /* Get the data payload from the host.  */
+            transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[buffer_index];
+            status =  _ux_device_stack_transfer_request(transfer_request, transfer_length, transfer_length);
+        }
+
+        /* Wait for the media write of the previous block.  */
+        if (media_length)
+        {
+            media_write_status =  _ux_device_class_storage_media_wait(storage, &media_status);
+
+            /* If there is a problem, return a failed command.  */
+            if (media_write_status != UX_SUCCESS)
+            {
+
+                /* We have a problem, request error. Return a bad completion and wait for the
+                   REQUEST_SENSE command.  */
+                _ux_device_stack_endpoint_stall(endpoint_out);
+
+                /* Update residue.  */
+                storage -> ux_slave_class_storage_csw_residue = storage -> ux_slave_class_storage_host_length - done_length;
+
+                /* And update the REQUEST_SENSE codes.  */
+                storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_request_sense_status = media_status;
+
+                /* Restore the buffer of the transfer request.  */
+                transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+
+                /* Return an error.  */
+                return(UX_ERROR);
+            }
+
+            /* The previous block is on the media.  */
+            done_length += media_length;
+            media_length =  0;
+        }
+
+        /* Nothing more received, all done.  */
+        if (total_length == 0)
+            break;
+
+        /* Check the status.  */
+        if (status != UX_SUCCESS)
+        {
+
+            /* We have a problem, request error. Return a bad completion and wait for the
+               REQUEST_SENSE command.  */
+            _ux_device_stack_endpoint_stall(endpoint_out);
+
+            /* Update residue.  */
+            storage -> ux_slave_class_storage_csw_residue = storage -> ux_slave_class_storage_host_length - done_length;
+
+            /* And update the REQUEST_SENSE codes.  */
+            storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_request_sense_status =
+                                                UX_DEVICE_CLASS_STORAGE_SENSE_STATUS(0x02,0x54,0x00);
+
+            /* Restore the buffer of the transfer request.  */
+            transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+
+            /* Return an error.  */
+            return(UX_ERROR);
+        }
+
+        /* Compute the number of blocks to transfer.  */
+        number_blocks = transfer_length / storage -> ux_slave_class_storage_lun[lun].ux_slave_class_storage_media_block_length;
+
+        /* Start the write command to the local media.  */
+        _ux_device_class_storage_media_request(storage, UX_DEVICE_CLASS_STORAGE_MEDIA_WRITE, lun,
+                                               buffer[buffer_index], number_blocks, lba);
+        media_length =  transfer_length;
+
+        /* Update the lba.  */
+        lba += number_blocks;
+
+        /* Update the length to remain.  */
+        total_length -= transfer_length;
+
+        /* Next block is received in the other buffer.  */
+        buffer_index ^= 1;
+    }
+
+    /* Restore the buffer of the transfer request.  */
+    transfer_request -> ux_slave_transfer_request_data_pointer =  buffer[0];
+#else
+
     /* Default status to success.  */
     status =  UX_SUCCESS;
 
@@ -282,6 +406,7 @@ ULONG                   done_length;
         total_length -= transfer_length;
         done_length += transfer_length;
     }
+#endif
 
     /* Update residue.  */
     storage -> ux_slave_class_storage_csw_residue = storage -> ux_slave_class_storage_host_length - done_length;
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_host_class_cdc_acm.h                             PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -55,6 +55,10 @@
 /*                                            used defined line coding    */
 /*                                            instead of magic number,    */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added multiple reception    */
+/*                                            transfers and backpressure, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -78,6 +82,18 @@ extern   "C" {
 #define UX_HOST_CLASS_CDC_ACM_ENABLE_ERROR_CHECKING
 #endif
 
+/* Define the number of bulk IN transfers kept in flight in reception mode. More than one
+   transfer is only armed if the HCD accepts several requests outstanding on an endpoint
+   (UX_HCD_CAPABILITY_CONCURRENT_TRANSFERS), as the host simulator and OHCI do. EHCI resets
+   the QH of the endpoint on each request, with it reception falls back to a single transfer.  */
+#ifndef UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT
+#define UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT          1
+#endif
+
+/* Defined, reception is paused when the reception buffer is full, until
+   _reception_resume is called, instead of being stopped with UX_BUFFER_OVERFLOW.  */
+/* #define UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE  */
+
 
 /* Define CDC ACM Class constants.  */
 
@@ -201,6 +217,7 @@ extern   "C" {
 #define UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STOPPED           0
 #define UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STARTED           1
 #define UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_IN_TRANSFER       2
+#define UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_PAUSED            3
 
 /* Define supported notification types.  */
 
@@ -241,6 +258,9 @@ typedef struct UX_HOST_CLASS_CDC_ACM_STRUCT
     
     VOID           (*ux_host_class_cdc_acm_device_status_change_callback)(struct UX_HOST_CLASS_CDC_ACM_STRUCT *cdc_acm, 
                                                                 ULONG  notification_type, ULONG notification_value);
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+    UX_TRANSFER    ux_host_class_cdc_acm_reception_transfer_requests[UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT - 1];
+#endif
 #if !defined(UX_HOST_STANDALONE)
     UX_SEMAPHORE   ux_host_class_cdc_acm_semaphore;
 #else
@@ -314,9 +334,26 @@ typedef struct UX_HOST_CLASS_CDC_ACM_RECEPTION_STRUCT
                                                                 UINT  status,
                                                                 UCHAR *reception_buffer, 
                                                                 ULONG reception_size);
+    UCHAR          *ux_host_class_cdc_acm_reception_data_next;
+    ULONG          ux_host_class_cdc_acm_reception_transfer_count;
+    ULONG          ux_host_class_cdc_acm_reception_transfer_max;
+    ULONG          ux_host_class_cdc_acm_reception_transfer_index;
+    UINT           ux_host_class_cdc_acm_reception_arm_busy;
+    UINT           ux_host_class_cdc_acm_reception_arm_pending;
 
 } UX_HOST_CLASS_CDC_ACM_RECEPTION;
 
+/* Define CDC ACM reception transfer access, the first one is the bulk IN endpoint transfer request.  */
+
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+#define UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER(cdc_acm, index)                                  \
+    (((index) == 0) ? &(cdc_acm) -> ux_host_class_cdc_acm_bulk_in_endpoint -> ux_endpoint_transfer_request :  \
+                      &(cdc_acm) -> ux_host_class_cdc_acm_reception_transfer_requests[(index) - 1])
+#else
+#define UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER(cdc_acm, index)                                  \
+    (&(cdc_acm) -> ux_host_class_cdc_acm_bulk_in_endpoint -> ux_endpoint_transfer_request)
+#endif
+
 /* Define CDC ACM Line Coding IOCTL structure.  */
 
 typedef struct UX_HOST_CLASS_CDC_ACM_LINE_CODING_STRUCT
@@ -371,6 +408,9 @@ UINT  _ux_host_class_cdc_acm_reception_start (UX_HOST_CLASS_CDC_ACM *cdc_acm,
                                     UX_HOST_CLASS_CDC_ACM_RECEPTION *cdc_acm_reception);
                                     
 VOID  _ux_host_class_cdc_acm_reception_callback (UX_TRANSFER *transfer_request);
+UINT  _ux_host_class_cdc_acm_reception_arm(UX_HOST_CLASS_CDC_ACM *cdc_acm);
+UINT  _ux_host_class_cdc_acm_reception_resume(UX_HOST_CLASS_CDC_ACM *cdc_acm, 
+                                    UX_HOST_CLASS_CDC_ACM_RECEPTION *cdc_acm_reception);
 
 UINT  _ux_host_class_cdc_acm_write_with_callback(UX_HOST_CLASS_CDC_ACM *cdc_acm, UCHAR *data_pointer, 
                                   ULONG requested_length);
@@ -389,6 +429,8 @@ UINT  _uxe_host_class_cdc_acm_reception_stop (UX_HOST_CLASS_CDC_ACM *cdc_acm,
                                     UX_HOST_CLASS_CDC_ACM_RECEPTION *cdc_acm_reception);
 UINT  _uxe_host_class_cdc_acm_reception_start (UX_HOST_CLASS_CDC_ACM *cdc_acm, 
                                     UX_HOST_CLASS_CDC_ACM_RECEPTION *cdc_acm_reception);
+UINT  _uxe_host_class_cdc_acm_reception_resume(UX_HOST_CLASS_CDC_ACM *cdc_acm, 
+                                    UX_HOST_CLASS_CDC_ACM_RECEPTION *cdc_acm_reception);
 UINT  _uxe_host_class_cdc_acm_write_with_callback(UX_HOST_CLASS_CDC_ACM *cdc_acm, UCHAR *data_pointer, 
                                   ULONG requested_length);
 
@@ -404,6 +446,7 @@ UINT  _uxe_host_class_cdc_acm_write_with_callback(UX_HOST_CLASS_CDC_ACM *cdc_acm
 #define ux_host_class_cdc_acm_ioctl                     _uxe_host_class_cdc_acm_ioctl
 #define ux_host_class_cdc_acm_reception_start           _uxe_host_class_cdc_acm_reception_start
 #define ux_host_class_cdc_acm_reception_stop            _uxe_host_class_cdc_acm_reception_stop
+#define ux_host_class_cdc_acm_reception_resume          _uxe_host_class_cdc_acm_reception_resume
 
 #define ux_host_class_cdc_acm_write_with_callback       _uxe_host_class_cdc_acm_write_with_callback
 
@@ -414,6 +457,7 @@ UINT  _uxe_host_class_cdc_acm_write_with_callback(UX_HOST_CLASS_CDC_ACM *cdc_acm
 #define ux_host_class_cdc_acm_ioctl                     _ux_host_class_cdc_acm_ioctl
 #define ux_host_class_cdc_acm_reception_start           _ux_host_class_cdc_acm_reception_start
 #define ux_host_class_cdc_acm_reception_stop            _ux_host_class_cdc_acm_reception_stop
+#define ux_host_class_cdc_acm_reception_resume          _ux_host_class_cdc_acm_reception_resume
 
 #define ux_host_class_cdc_acm_write_with_callback       _ux_host_class_cdc_acm_write_with_callback
 
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_host_class_cdc_ecm.h                             PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,6 +60,10 @@
 /*  10-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transmit segments,    */
+/*                                            added receive ring,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -154,6 +158,26 @@ extern   "C" {
 #endif
 
 #define UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE                    14
+
+/* Define transmit batching with transfer segments, see UX_HOST_TRANSFER_SEGMENTS_ENABLE.
+   Up to XMIT_FRAMES queued frames are sent in one bulk OUT transfer, each frame ending with
+   a short packet or a ZLP. Chained packets are sent from packet memory, only the bytes around
+   chain boundaries not aligned to max packet size are copied in XMIT_BOUNCE_COUNT bounce buffers
+   of max packet size.  */
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+#ifndef UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES
+#define UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES                      4
+#endif
+#ifndef UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS
+#define UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS                    (UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES * 4)
+#endif
+#ifndef UX_HOST_CLASS_CDC_ECM_XMIT_BOUNCE_COUNT
+#define UX_HOST_CLASS_CDC_ECM_XMIT_BOUNCE_COUNT                (UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES * 2)
+#endif
+#if UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS < 2
+#error "UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS must be at least 2 (frame and ZLP)"
+#endif
+#endif
                                                                 
 #define UX_HOST_CLASS_CDC_ECM_DEVICE_INIT_DELAY                (1 * UX_PERIODIC_RATE)
 #define UX_HOST_CLASS_CDC_ECM_CLASS_TRANSFER_TIMEOUT           300000
@@ -254,6 +278,16 @@ extern   "C" {
 #define UX_HOST_CLASS_CDC_ECM_PACKET_POOL_INSTANCE_WAIT         100
 #endif
 
+/* Define receive ring, see UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE in ux_user.h.
+   Packets of the IP packet pool are received in directly, without copy.  */
+
+#if defined(UX_HOST_STANDALONE)
+#undef UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE
+#endif
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE) && (UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE < 2)
+#error "UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE must be at least 2"
+#endif
+
 /* Define  CDC_ECM Class instance structure.  */
 
 typedef struct UX_HOST_CLASS_CDC_ECM_STRUCT
@@ -295,6 +329,23 @@ typedef struct UX_HOST_CLASS_CDC_ECM_STRUCT
     UCHAR           *ux_host_class_cdc_ecm_xmit_buffer;
     UCHAR           *ux_host_class_cdc_ecm_receive_buffer;
 #endif
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+    UX_TRANSFER_SEGMENT
+                    ux_host_class_cdc_ecm_xmit_segments[UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS];
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+    UCHAR           *ux_host_class_cdc_ecm_xmit_bounce_buffer;
+#endif
+    ULONG           ux_host_class_cdc_ecm_xmit_frames;
+    UINT            ux_host_class_cdc_ecm_xmit_segments_support;
+#endif
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+    NX_PACKET       *ux_host_class_cdc_ecm_receive_ring[UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE];
+    ULONG           ux_host_class_cdc_ecm_receive_ring_head;
+    ULONG           ux_host_class_cdc_ecm_receive_ring_count;
+    NX_PACKET       *ux_host_class_cdc_ecm_receive_queue_head;
+    NX_PACKET       *ux_host_class_cdc_ecm_receive_queue_tail;
+    UINT            ux_host_class_cdc_ecm_receive_armed;
+#endif
 
     UCHAR           ux_host_class_cdc_ecm_node_id[UX_HOST_CLASS_CDC_ECM_NODE_ID_LENGTH];
     VOID            (*ux_host_class_cdc_ecm_device_status_change_callback)(struct UX_HOST_CLASS_CDC_ECM_STRUCT *cdc_ecm, 
@@ -329,9 +380,13 @@ UINT  _ux_host_class_cdc_ecm_endpoints_get(UX_HOST_CLASS_CDC_ECM *cdc_ecm);
 UINT  _ux_host_class_cdc_ecm_entry(UX_HOST_CLASS_COMMAND *command);
 UINT  _ux_host_class_cdc_ecm_write(VOID *cdc_ecm_class, NX_PACKET *packet);
 VOID  _ux_host_class_cdc_ecm_interrupt_notification(UX_TRANSFER *transfer_request);
+VOID  _ux_host_class_cdc_ecm_receive_ring_clean(UX_HOST_CLASS_CDC_ECM *cdc_ecm);
+VOID  _ux_host_class_cdc_ecm_receive_ring_process(UX_HOST_CLASS_CDC_ECM *cdc_ecm);
+VOID  _ux_host_class_cdc_ecm_reception_callback(UX_TRANSFER *transfer_request);
 VOID  _ux_host_class_cdc_ecm_thread(ULONG parameter);
 VOID  _ux_host_class_cdc_ecm_transmission_callback(UX_TRANSFER *transfer_request);
 VOID  _ux_host_class_cdc_ecm_transmit_queue_clean(UX_HOST_CLASS_CDC_ECM *cdc_ecm_control);
+ULONG _ux_host_class_cdc_ecm_transmit_segments_build(UX_HOST_CLASS_CDC_ECM *cdc_ecm, NX_PACKET *packet);
 UINT  _ux_host_class_cdc_ecm_mac_address_get(UX_HOST_CLASS_CDC_ECM *cdc_ecm);
                                     
 /* Define CDC ECM Class API prototypes.  */
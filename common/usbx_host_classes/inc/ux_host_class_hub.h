@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_host_class_hub.h                                 PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -50,6 +50,10 @@
 /*  07-29-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added enumeration pipeline  */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -217,6 +221,11 @@ typedef struct UX_HOST_CLASS_HUB_STRUCT
                     ux_host_class_hub_descriptor;
     UINT            ux_host_class_hub_port_state;
     UINT            ux_host_class_hub_port_power;
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE) && !defined(UX_HOST_STANDALONE)
+    UINT            ux_host_class_hub_port_enumerate;
+    ULONG           ux_host_class_hub_change_time;
+    UX_DEVICE       *ux_host_class_hub_port_device[UX_MAX_HUB_PORTS + 1];
+#endif
 
 #if defined(UX_HOST_STANDALONE)
     UINT            ux_host_class_hub_run_status;
@@ -256,6 +265,7 @@ UINT    _ux_host_class_hub_port_change_process(UX_HOST_CLASS_HUB *hub, UINT port
 VOID    _ux_host_class_hub_port_change_reset_process(UX_HOST_CLASS_HUB *hub, UINT port, UINT port_status);
 VOID    _ux_host_class_hub_port_change_suspend_process(UX_HOST_CLASS_HUB *hub, UINT port, UINT port_status);
 UINT    _ux_host_class_hub_port_reset(UX_HOST_CLASS_HUB *hub, UINT port);
+VOID    _ux_host_class_hub_ports_enumerate(UX_HOST_CLASS_HUB *hub);
 UINT    _ux_host_class_hub_ports_power(UX_HOST_CLASS_HUB *hub);
 UINT    _ux_host_class_hub_status_get(UX_HOST_CLASS_HUB *hub, UINT port, USHORT *port_status, USHORT *port_change);
 VOID    _ux_host_class_hub_transfer_request_completed(UX_TRANSFER *transfer_request);
@@ -59,6 +59,10 @@
 /*  xx-xx-xxxx     Yajun xia                Modified comment(s),          */
 /*                                            added error checks support, */
 /*                                            resulting in version 6.x    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added frame assembly        */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -75,6 +79,10 @@ extern   "C" {
 
 #endif
 
+/* Compile option: if defined, payloads are assembled into frame buffers
+   (see ux_host_class_video_frame_callback_set).  */
+/* #define UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT  */
+
 /* Internal option: enable the basic USBX error checking. This define is typically used
    while debugging application.  */
 #if defined(UX_ENABLE_ERROR_CHECKING) && !defined(UX_HOST_CLASS_VIDEO_ENABLE_ERROR_CHECKING)
@@ -386,6 +394,32 @@ extern UCHAR _ux_system_host_class_video_name[];
 #define UX_HOST_CLASS_VIDEO_TRANSFER_REQUEST_COUNT                                          8
 #endif
 
+/* Define Video Class payload header constants.  */
+
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_LENGTH                                           0
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO                                             1
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_PTS                                              2
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_MIN_LENGTH                                       2
+
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_FID                                         0x01
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_EOF                                         0x02
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_PTS                                         0x04
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_SCR                                         0x08
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_STI                                         0x20
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_ERR                                         0x40
+#define UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_EOH                                         0x80
+
+/* Define Video Class frame buffer status.  */
+
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_EOF                                                0x01
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_PTS                                                0x02
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_SCR                                                0x04
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_ERROR                                              0x10
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_OVERFLOW                                           0x20
+#define UX_HOST_CLASS_VIDEO_FRAME_BUFFER_ABORTED                                            0x40
+
+#define UX_HOST_CLASS_VIDEO_FRAME_FID_NONE                                                  0xFF
+
 typedef struct UX_HOST_CLASS_VIDEO_INTERFACE_HEADER_DESCRIPTOR_STRUCT
 {
 
@@ -504,6 +538,23 @@ typedef struct UX_HOST_CLASS_VIDEO_PROCESSING_UNIT_DESCRIPTOR_STRUCT
 } UX_HOST_CLASS_VIDEO_PROCESSING_UNIT_DESCRIPTOR;
 
 
+/* Define Video Class frame buffer structure.  */
+
+typedef struct UX_HOST_CLASS_VIDEO_FRAME_BUFFER_STRUCT
+{
+
+    UCHAR           *ux_host_class_video_frame_buffer_data;
+    ULONG           ux_host_class_video_frame_buffer_size;
+    ULONG           ux_host_class_video_frame_buffer_length;
+    ULONG           ux_host_class_video_frame_buffer_status;
+    ULONG           ux_host_class_video_frame_buffer_pts;
+    ULONG           ux_host_class_video_frame_buffer_scr_stc;
+    ULONG           ux_host_class_video_frame_buffer_scr_sof;
+    struct UX_HOST_CLASS_VIDEO_FRAME_BUFFER_STRUCT
+                    *ux_host_class_video_frame_buffer_next;
+} UX_HOST_CLASS_VIDEO_FRAME_BUFFER;
+
+
 /* Define Video Class instance structure.  */
 
 typedef struct UX_HOST_CLASS_VIDEO_STRUCT
@@ -539,6 +590,19 @@ typedef struct UX_HOST_CLASS_VIDEO_STRUCT
     UX_SEMAPHORE    ux_host_class_video_semaphore;
     UX_SEMAPHORE    ux_host_class_video_semaphore_control_request;
     VOID            (*ux_host_class_video_transfer_completion_function)(UX_TRANSFER*);
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+    VOID            (*ux_host_class_video_frame_callback)(struct UX_HOST_CLASS_VIDEO_STRUCT *,
+                                                          UX_HOST_CLASS_VIDEO_FRAME_BUFFER *);
+    UX_HOST_CLASS_VIDEO_FRAME_BUFFER
+                    *ux_host_class_video_frame_buffer_head;
+    UX_HOST_CLASS_VIDEO_FRAME_BUFFER
+                    *ux_host_class_video_frame_buffer_tail;
+    UX_HOST_CLASS_VIDEO_FRAME_BUFFER
+                    *ux_host_class_video_frame_buffer_current;
+    ULONG           ux_host_class_video_frame_fid;
+    ULONG           ux_host_class_video_frame_drop;
+    ULONG           ux_host_class_video_frames_dropped;
+#endif
 
 } UX_HOST_CLASS_VIDEO;
 
@@ -668,6 +732,11 @@ ULONG   _ux_host_class_video_max_payload_get(UX_HOST_CLASS_VIDEO *video);
 UINT    _ux_host_class_video_transfer_buffer_add(UX_HOST_CLASS_VIDEO *video, UCHAR* buffer);
 UINT    _ux_host_class_video_transfer_buffers_add(UX_HOST_CLASS_VIDEO *video, UCHAR** buffers, ULONG num_buffers);
 VOID    _ux_host_class_video_transfer_callback_set(UX_HOST_CLASS_VIDEO *video, VOID (*callback_function)(UX_TRANSFER*));
+VOID    _ux_host_class_video_frame_assemble(UX_HOST_CLASS_VIDEO *video, UX_TRANSFER *transfer_request);
+UINT    _ux_host_class_video_frame_buffer_add(UX_HOST_CLASS_VIDEO *video, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *frame_buffer);
+VOID    _ux_host_class_video_frame_buffers_flush(UX_HOST_CLASS_VIDEO *video);
+UINT    _ux_host_class_video_frame_callback_set(UX_HOST_CLASS_VIDEO *video,
+                        VOID (*callback_function)(UX_HOST_CLASS_VIDEO *, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *));
 UINT    _ux_host_class_video_entities_parse(UX_HOST_CLASS_VIDEO *video,
                         UINT(*parse_function)(VOID  *arg,
                                             UCHAR *packed_interface_descriptor,
@@ -690,6 +759,9 @@ ULONG   _uxe_host_class_video_max_payload_get(UX_HOST_CLASS_VIDEO *video);
 UINT    _uxe_host_class_video_transfer_buffer_add(UX_HOST_CLASS_VIDEO *video, UCHAR* buffer);
 UINT    _uxe_host_class_video_transfer_buffers_add(UX_HOST_CLASS_VIDEO *video, UCHAR** buffers, ULONG num_buffers);
 VOID    _uxe_host_class_video_transfer_callback_set(UX_HOST_CLASS_VIDEO *video, VOID (*callback_function)(UX_TRANSFER*));
+UINT    _uxe_host_class_video_frame_buffer_add(UX_HOST_CLASS_VIDEO *video, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *frame_buffer);
+UINT    _uxe_host_class_video_frame_callback_set(UX_HOST_CLASS_VIDEO *video,
+                        VOID (*callback_function)(UX_HOST_CLASS_VIDEO *, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *));
 UINT    _uxe_host_class_video_entities_parse(UX_HOST_CLASS_VIDEO *video,
                         UINT(*parse_function)(VOID  *arg,
                                             UCHAR *packed_interface_descriptor,
@@ -716,6 +788,8 @@ UINT    _uxe_host_class_video_control_request(UX_HOST_CLASS_VIDEO *video,
 #define ux_host_class_video_transfer_buffer_add     _uxe_host_class_video_transfer_buffer_add
 #define ux_host_class_video_transfer_buffers_add    _uxe_host_class_video_transfer_buffers_add
 #define ux_host_class_video_transfer_callback_set   _uxe_host_class_video_transfer_callback_set
+#define ux_host_class_video_frame_buffer_add        _uxe_host_class_video_frame_buffer_add
+#define ux_host_class_video_frame_callback_set      _uxe_host_class_video_frame_callback_set
 #define ux_host_class_video_entities_parse          _uxe_host_class_video_entities_parse
 #define ux_host_class_video_control_request         _uxe_host_class_video_control_request
 
@@ -734,6 +808,8 @@ UINT    _uxe_host_class_video_control_request(UX_HOST_CLASS_VIDEO *video,
 #define ux_host_class_video_transfer_buffer_add     _ux_host_class_video_transfer_buffer_add
 #define ux_host_class_video_transfer_buffers_add    _ux_host_class_video_transfer_buffers_add
 #define ux_host_class_video_transfer_callback_set   _ux_host_class_video_transfer_callback_set
+#define ux_host_class_video_frame_buffer_add        _ux_host_class_video_frame_buffer_add
+#define ux_host_class_video_frame_callback_set      _ux_host_class_video_frame_callback_set
 #define ux_host_class_video_entities_parse          _ux_host_class_video_entities_parse
 #define ux_host_class_video_control_request         _ux_host_class_video_control_request
 
@@ -32,6 +32,9 @@
 
 #if !defined(UX_HOST_STANDALONE)
 static inline UINT _ux_host_class_asix_try_all_vid_pids(UX_HOST_CLASS_COMMAND *command);
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+static inline const UX_HOST_CLASS_MATCH *_ux_host_class_asix_match_get(VOID);
+#endif
 #endif
 
 
@@ -40,7 +43,7 @@ static inline UINT _ux_host_class_asix_try_all_vid_pids(UX_HOST_CLASS_COMMAND *c
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_asix_entry                           PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -83,6 +86,9 @@ static inline UINT _ux_host_class_asix_try_all_vid_pids(UX_HOST_CLASS_COMMAND *c
 /*                                            fixed compile warning,      */
 /*                                            refined VID/PID check flow, */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_asix_entry(UX_HOST_CLASS_COMMAND *command)
@@ -100,6 +106,14 @@ UINT    status;
     switch (command -> ux_host_class_command_request)
     {
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_asix_match_get();
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
@@ -158,4 +172,25 @@ UINT    n_id_pairs = n_ids >> 1;
     }
     return(UX_NO_CLASS_MATCH);
 }
+
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+static UX_HOST_CLASS_MATCH _ux_host_class_asix_match[sizeof(_ux_host_class_asix_vid_pid_array) / 4 + 1];
+
+static inline const UX_HOST_CLASS_MATCH *_ux_host_class_asix_match_get(VOID)
+{
+UINT    i, pos;
+UINT    n_ids = sizeof(_ux_host_class_asix_vid_pid_array) >> 1;
+UINT    n_id_pairs = n_ids >> 1;
+
+    /* Build the match list from the VID/PID array, the last entry is kept zero.  */
+    for (i = 0, pos = 0; i < n_id_pairs; i ++, pos += 2)
+    {
+        _ux_host_class_asix_match[i].ux_host_class_match_usage = UX_HOST_CLASS_COMMAND_USAGE_PIDVID;
+        _ux_host_class_asix_match[i].ux_host_class_match_flags = UX_HOST_CLASS_MATCH_VID | UX_HOST_CLASS_MATCH_PID;
+        _ux_host_class_asix_match[i].ux_host_class_match_vid = _ux_host_class_asix_vid_pid_array[pos    ];
+        _ux_host_class_asix_match[i].ux_host_class_match_pid = _ux_host_class_asix_vid_pid_array[pos + 1];
+    }
+    return(_ux_host_class_asix_match);
+}
+#endif
 #endif
@@ -30,12 +30,27 @@
 #include "ux_host_stack.h"
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/* Define the devices or interfaces the class may accept in query.  */
+static const UX_HOST_CLASS_MATCH _ux_host_class_audio_match[] =
+{
+#if defined(UX_HOST_CLASS_AUDIO_2_SUPPORT)
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_PROTOCOL,
+                            UX_HOST_CLASS_AUDIO_CLASS, 0, UX_HOST_CLASS_AUDIO_PROTOCOL_IP_VERSION_02_00),
+#endif
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_PROTOCOL,
+                            UX_HOST_CLASS_AUDIO_CLASS, 0, UX_HOST_CLASS_AUDIO_PROTOCOL_IP_VERSION_01_00),
+    UX_HOST_CLASS_MATCH_END
+};
+#endif
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_audio_entry                          PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -74,6 +89,9 @@
 /*  07-29-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added audio 2.0 support,    */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_audio_entry(UX_HOST_CLASS_COMMAND *command)
@@ -88,6 +106,14 @@ UINT        status;
     {
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices or interfaces we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_audio_match;
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
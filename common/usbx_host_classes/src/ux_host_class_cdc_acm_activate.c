@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_cdc_acm_activate                     PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,8 @@
 /*    _ux_host_class_cdc_acm_configure        Configure cdc_acm class     */
 /*    _ux_host_class_cdc_acm_endpoints_get    Get endpoints of cdc_acm    */
 /*    _ux_host_class_cdc_acm_ioctl            IOCTL function for ACM      */
+/*    _ux_host_stack_class_instance_allocate Allocate class instance      */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_destroy   Destroy the class instance  */
 /*    _ux_host_stack_endpoint_transfer_abort  Abort transfer              */
 /*    _ux_utility_memory_allocate             Allocate memory block       */
@@ -87,6 +89,11 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            created reception transfer  */
+/*                                            semaphores,                 */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_acm_activate(UX_HOST_CLASS_COMMAND *command)
@@ -104,6 +111,9 @@ ULONG                               descriptors_length;
 #else
 UX_HOST_CLASS_CDC_ACM_LINE_CODING   line_coding;
 UX_HOST_CLASS_CDC_ACM_LINE_STATE    line_state;
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+ULONG                               transfer_index;
+#endif
 #endif
 
     /* The CDC ACM class is always activated by the interface descriptor and not the
@@ -111,7 +121,8 @@ UX_HOST_CLASS_CDC_ACM_LINE_STATE    line_state;
     interface_ptr =  (UX_INTERFACE *) command -> ux_host_class_command_container;
 
     /* Obtain memory for this class instance.  */
-    cdc_acm =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_CDC_ACM));
+    cdc_acm =  _ux_host_stack_class_instance_allocate(command -> ux_host_class_command_class_ptr,
+                    UX_NO_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_CDC_ACM));
 
     /* Instance creation fail. */
     if (cdc_acm == UX_NULL)
@@ -127,11 +138,35 @@ UX_HOST_CLASS_CDC_ACM_LINE_STATE    line_state;
     {
 
         /* Free instance memory. */
-        _ux_utility_memory_free(cdc_acm);
+        _ux_host_stack_class_instance_free(command -> ux_host_class_command_class_ptr, cdc_acm);
 
         /* Semaphore creation error. */
         return(UX_SEMAPHORE_ERROR);
     }
+
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+
+    /* Create the semaphores of the additional reception transfer requests.  */
+    for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT - 1; transfer_index ++)
+    {
+        status =  _ux_host_semaphore_create(&cdc_acm -> ux_host_class_cdc_acm_reception_transfer_requests[transfer_index].ux_transfer_request_semaphore,
+                                            "ux_host_class_cdc_acm_reception_semaphore", 0);
+        if (status != UX_SUCCESS)
+        {
+
+            /* Delete the semaphores created.  */
+            while (transfer_index --)
+                _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_reception_transfer_requests[transfer_index].ux_transfer_request_semaphore);
+            _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_semaphore);
+
+            /* Free instance memory. */
+            _ux_host_stack_class_instance_free(command -> ux_host_class_command_class_ptr, cdc_acm);
+
+            /* Semaphore creation error. */
+            return(UX_SEMAPHORE_ERROR);
+        }
+    }
+#endif
 #endif
 
     /* Store the class container into this instance.  */
@@ -360,13 +395,20 @@ UX_HOST_CLASS_CDC_ACM_LINE_STATE    line_state;
 
     /* Destroy the semaphore.  */
     _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_semaphore);
+
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+
+    /* Destroy the semaphores of the reception transfer requests.  */
+    for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT - 1; transfer_index ++)
+        _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_reception_transfer_requests[transfer_index].ux_transfer_request_semaphore);
+#endif
 #endif
 
     /* Unmount instance. */
     interface_ptr -> ux_interface_class_instance = UX_NULL;
 
     /* Free instance. */
-    _ux_utility_memory_free(cdc_acm);
+    _ux_host_stack_class_instance_free(cdc_acm -> ux_host_class_cdc_acm_class, cdc_acm);
 
     return(status);
 }
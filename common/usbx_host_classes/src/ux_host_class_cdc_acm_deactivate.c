@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_acm_deactivate                   PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,8 +57,10 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_destroy Destroy the class instance    */ 
 /*    _ux_host_stack_endpoint_transfer_abort Abort endpoint transfer      */ 
+/*    _ux_host_stack_transfer_request_abort Abort transfer request        */
 /*    _ux_utility_memory_free               Free memory block             */ 
 /*    _ux_host_semaphore_get                Get protection semaphore      */ 
 /*    _ux_host_semaphore_delete             Delete protection semaphore   */ 
@@ -78,6 +80,11 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            aborted all reception       */
+/*                                            transfers,                  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_acm_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -87,6 +94,9 @@ UX_HOST_CLASS_CDC_ACM       *cdc_acm;
 UX_TRANSFER                 *transfer_request;
 #if !defined(UX_HOST_STANDALONE)
 UINT                        status;
+#endif
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+ULONG                       transfer_index;
 #endif
 
     /* Get the instance for this class.  */
@@ -136,6 +146,17 @@ UINT                        status;
 
             /* We need to abort transactions on the bulk In pipe.  */
             _ux_host_stack_endpoint_transfer_abort(cdc_acm -> ux_host_class_cdc_acm_bulk_in_endpoint);
+
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+
+        /* And the other reception transfers on the bulk In pipe.  */
+        for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT - 1; transfer_index ++)
+        {
+            transfer_request =  &cdc_acm -> ux_host_class_cdc_acm_reception_transfer_requests[transfer_index];
+            if (transfer_request -> ux_transfer_request_completion_code == UX_TRANSFER_STATUS_PENDING)
+                _ux_host_stack_transfer_request_abort(transfer_request);
+        }
+#endif
     
         /* Then endpoint OUT.  */       
         transfer_request =  &cdc_acm -> ux_host_class_cdc_acm_bulk_out_endpoint -> ux_endpoint_transfer_request;
@@ -167,6 +188,13 @@ UINT                        status;
 
     /* Destroy the semaphore.  */
     _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_semaphore);
+
+#if UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT > 1
+
+    /* Destroy the semaphores of the reception transfer requests.  */
+    for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT - 1; transfer_index ++)
+        _ux_host_semaphore_delete(&cdc_acm -> ux_host_class_cdc_acm_reception_transfer_requests[transfer_index].ux_transfer_request_semaphore);
+#endif
 #endif
 
     /* Before we free the device resources, we need to inform the application
@@ -179,7 +207,7 @@ UINT                        status;
     }
 
     /* Free the cdc_acm instance memory.  */
-    _ux_utility_memory_free(cdc_acm);
+    _ux_host_stack_class_instance_free(cdc_acm -> ux_host_class_cdc_acm_class, cdc_acm);
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_CLASS_CDC_ACM_DEACTIVATE, cdc_acm, 0, 0, 0, UX_TRACE_HOST_CLASS_EVENTS, 0, 0)
@@ -47,12 +47,26 @@ static inline UINT  _ux_host_class_cdc_acm_activate_wait(UX_HOST_CLASS_COMMAND *
 #endif
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/* Define the devices or interfaces the class may accept in query.  */
+static const UX_HOST_CLASS_MATCH _ux_host_class_cdc_acm_match[] =
+{
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS, UX_HOST_CLASS_CDC_DATA_CLASS, 0, 0),
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_SUBCLASS,
+                            UX_HOST_CLASS_CDC_CONTROL_CLASS, UX_HOST_CLASS_CDC_ACM_SUBCLASS, 0),
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_SUBCLASS,
+                            UX_HOST_CLASS_CDC_CONTROL_CLASS, UX_HOST_CLASS_CDC_DLC_SUBCLASS, 0),
+    UX_HOST_CLASS_MATCH_END
+};
+#endif
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_acm_entry                        PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -80,6 +94,7 @@ static inline UINT  _ux_host_class_cdc_acm_activate_wait(UX_HOST_CLASS_COMMAND *
 /*                                                                        */ 
 /*    _ux_host_class_cdc_acm_activate       Activate cdc_acm class        */ 
 /*    _ux_host_class_cdc_acm_deactivate     Deactivate cdc_acm class      */ 
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -99,6 +114,10 @@ static inline UINT  _ux_host_class_cdc_acm_activate_wait(UX_HOST_CLASS_COMMAND *
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_acm_entry(UX_HOST_CLASS_COMMAND *command)
@@ -112,6 +131,14 @@ UINT    status;
     switch (command -> ux_host_class_command_request)
     {
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices or interfaces we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_cdc_acm_match;
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
@@ -564,7 +591,7 @@ ULONG                       tick, diff;
             interface_ptr -> ux_interface_class_instance = UX_NULL;
 
             /* Free instance. */
-            _ux_utility_memory_free(cdc_acm);
+            _ux_host_stack_class_instance_free(cdc_acm -> ux_host_class_cdc_acm_class, cdc_acm);
         }
 
         /* Done, OK to go on.  */
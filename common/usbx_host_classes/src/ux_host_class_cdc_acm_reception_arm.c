@@ -0,0 +1,176 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   ACM CDC Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_cdc_acm.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_cdc_acm_reception_arm                PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function arms bulk in transfers on the free blocks of the      */
+/*    reception buffer, until UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_   */
+/*    COUNT transfers are in flight or the next block still holds data    */
+/*    not released by the application (data tail).                        */
+/*                                                                        */
+/*    Blocks are armed in buffer order by one caller at a time. A call    */
+/*    made while another caller is arming is recorded and served by that  */
+/*    caller before it returns.                                           */
+/*                                                                        */
+/*    With UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE one block is kept */
+/*    free, and the reception is paused when no transfer can be armed.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_acm                               Pointer to cdc_acm class      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_transfer_request       Process transfer request      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    CDC ACM Class                                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_class_cdc_acm_reception_arm(UX_HOST_CLASS_CDC_ACM *cdc_acm)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
+UX_TRANSFER                         *transfer_request;
+UCHAR                               *block;
+UCHAR                               *next_block;
+UINT                                status;
+
+
+    /* Get the pointer to the acm reception structure.  */
+    cdc_acm_reception =  cdc_acm -> ux_host_class_cdc_acm_reception;
+
+    /* Only one caller arms transfers, so that blocks are queued in order.  */
+    UX_DISABLE
+    if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_busy)
+    {
+
+        /* Let the current caller check the buffer again.  */
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_pending =  UX_TRUE;
+        UX_RESTORE
+        return(UX_SUCCESS);
+    }
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_busy =  UX_TRUE;
+
+    status =  UX_SUCCESS;
+    while (cdc_acm_reception -> ux_host_class_cdc_acm_reception_state == UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STARTED)
+    {
+
+        /* Get the next block to arm, and the block after it.  */
+        block =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_next;
+        if (block + cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size >=
+            cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer + cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer_size)
+            next_block =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer;
+        else
+            next_block =  block + cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size;
+
+        /* Check if a transfer is free and if the block does not hold data not read yet.  */
+        if ((cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count == cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_max) ||
+#if defined(UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE)
+            (next_block == cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_tail))
+#else
+            ((block == cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_tail) &&
+             (cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count != 0)))
+#endif
+        {
+
+            /* The application may have released blocks meanwhile, check again.  */
+            if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_pending)
+            {
+                cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_pending =  UX_FALSE;
+                continue;
+            }
+
+#if defined(UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE)
+
+            /* Nothing is in flight, wait for the application to release blocks.  */
+            if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count == 0)
+                cdc_acm_reception -> ux_host_class_cdc_acm_reception_state =  UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_PAUSED;
+#endif
+            break;
+        }
+
+        /* Take the block and the next transfer request.  */
+        transfer_request =  UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER(cdc_acm, cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_index);
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_index ++;
+        if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_index == cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_max)
+            cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_index =  0;
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count ++;
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_next =  next_block;
+        UX_RESTORE
+
+        /* Arm the transfer on the block.  */
+        transfer_request -> ux_transfer_request_data_pointer =  block;
+        status =  _ux_host_stack_transfer_request(transfer_request);
+
+        UX_DISABLE
+        if (status != UX_SUCCESS)
+        {
+
+            /* The reception is stopped.  */
+            cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count --;
+            cdc_acm_reception -> ux_host_class_cdc_acm_reception_state =  UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STOPPED;
+            break;
+        }
+    }
+
+    /* Arming is done.  */
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_busy =  UX_FALSE;
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_pending =  UX_FALSE;
+    UX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
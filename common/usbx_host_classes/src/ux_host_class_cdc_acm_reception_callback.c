@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_cdc_acm_reception_callback           PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -44,7 +44,11 @@
 /*                                                                        */
 /*    This function is the callback from the USBX transfer functions,     */
 /*    it is called when a full or partial transfer has been done for a    */
-/*    bulk in transfer. It calls back the application.                    */
+/*    bulk in transfer. It calls back the application and arms transfers  */
+/*    on the blocks released by the application.                          */
+/*                                                                        */
+/*    With UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE a full buffer     */
+/*    pauses the reception instead of stopping it with overflow error.    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -56,7 +60,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _ux_host_stack_transfer_request       Process transfer request      */
+/*    _ux_host_class_cdc_acm_reception_arm  Arm reception transfers       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -69,11 +73,18 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            supported multiple          */
+/*                                            transfers in flight and     */
+/*                                            backpressure,               */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_host_class_cdc_acm_reception_callback (UX_TRANSFER *transfer_request)
 {
 
+UX_INTERRUPT_SAVE_AREA
+
 UX_HOST_CLASS_CDC_ACM               *cdc_acm;
 UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
 
@@ -95,6 +106,10 @@ UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
 
     }
 
+    /* Transfers complete in order, the head block is the one just filled.  */
+    UX_DISABLE
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count --;
+
     /* Move to the next reception buffer.  Check if we are at the end of the application buffer.  */
     if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head + cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size >=
         cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer + cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer_size)
@@ -106,6 +121,9 @@ UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
 
             /* Program the head to be after the current buffer.  */
             cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head +=  cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size;
+    UX_RESTORE
+
+#if !defined(UX_HOST_CLASS_CDC_ACM_RECEPTION_BACKPRESSURE)
 
     /* OVERFLOW check: if the head reaches the tail buffer that contains reception data */
     if (cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_tail ==  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head)
@@ -125,6 +143,7 @@ UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
 
         return;
     }
+#endif
 
     /* We need to report this transfer to the application.  */
     cdc_acm_reception -> ux_host_class_cdc_acm_reception_callback(cdc_acm,
@@ -132,13 +151,9 @@ UX_HOST_CLASS_CDC_ACM_RECEPTION     *cdc_acm_reception;
                                                                     transfer_request -> ux_transfer_request_data_pointer,
                                                                     transfer_request -> ux_transfer_request_actual_length);
 
-    /* Set data pointer to the next reception buffer.  */
-    transfer_request -> ux_transfer_request_data_pointer = cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head;
-
-    /* Arm another transfer.  */
-    _ux_host_stack_transfer_request(transfer_request);
+    /* Arm transfers on the free blocks.  */
+    _ux_host_class_cdc_acm_reception_arm(cdc_acm);
 
     /* There is no status to be reported back to the stack.  */
     return;
 }
-
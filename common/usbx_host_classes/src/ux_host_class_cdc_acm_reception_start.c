@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_acm_reception_start              PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -48,6 +48,10 @@
 /*    application callback function is invoked and a new transfer request */
 /*    is rescheduled.                                                     */
 /*                                                                        */
+/*    Up to UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT transfers are  */
+/*    kept in flight, on consecutive blocks of the reception buffer, if   */
+/*    the HCD accepts concurrent transfers on one endpoint.               */
+/*                                                                        */
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
 /*    cdc_acm                               Pointer to cdc_acm class      */ 
@@ -59,7 +63,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    _ux_host_stack_transfer_request       Process transfer request      */ 
+/*    _ux_host_class_cdc_acm_reception_arm  Arm reception transfers       */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -72,6 +76,10 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            supported multiple          */
+/*                                            transfers in flight,        */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_acm_reception_start (UX_HOST_CLASS_CDC_ACM *cdc_acm, 
@@ -80,6 +88,7 @@ UINT  _ux_host_class_cdc_acm_reception_start (UX_HOST_CLASS_CDC_ACM *cdc_acm,
 
 UX_TRANSFER     *transfer_request;
 UINT            status;
+ULONG           transfer_index;
     
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_CLASS_CDC_ACM_RECEPTION_START, cdc_acm, 0, 0, 0, UX_TRACE_HOST_CLASS_EVENTS, 0, 0)
@@ -115,14 +124,31 @@ UINT            status;
     cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer;
     cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_tail =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer;
 
-    /* Get the pointer to the bulk in endpoint in the transfer_request.  */
-    transfer_request =  &cdc_acm -> ux_host_class_cdc_acm_bulk_in_endpoint -> ux_endpoint_transfer_request;
-    
-    /* Initialize the transfer request.  */
-    transfer_request -> ux_transfer_request_class_instance      =  (VOID *) cdc_acm;
-    transfer_request -> ux_transfer_request_data_pointer        =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_head;
-    transfer_request -> ux_transfer_request_requested_length    =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size;
-    transfer_request -> ux_transfer_request_completion_function =  _ux_host_class_cdc_acm_reception_callback;
+    /* The first block is armed first, no transfer is in flight yet.  */
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_next =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_data_buffer;
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_count =  0;
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_index =  0;
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_busy =  UX_FALSE;
+    cdc_acm_reception -> ux_host_class_cdc_acm_reception_arm_pending =  UX_FALSE;
+
+    /* Several transfers are kept in flight only if the HCD accepts them on one endpoint.  */
+    if (UX_DEVICE_HCD_GET(cdc_acm -> ux_host_class_cdc_acm_device) -> ux_hcd_capabilities &
+        UX_HCD_CAPABILITY_CONCURRENT_TRANSFERS)
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_max =  UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT;
+    else
+        cdc_acm_reception -> ux_host_class_cdc_acm_reception_transfer_max =  1;
+
+    /* Initialize the transfer requests, the first one is the one of the bulk in endpoint.  */
+    for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT; transfer_index ++)
+    {
+        transfer_request =  UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER(cdc_acm, transfer_index);
+        transfer_request -> ux_transfer_request_endpoint            =  cdc_acm -> ux_host_class_cdc_acm_bulk_in_endpoint;
+        transfer_request -> ux_transfer_request_type                =  UX_REQUEST_IN;
+        transfer_request -> ux_transfer_request_packet_length       =  cdc_acm -> ux_host_class_cdc_acm_bulk_in_endpoint -> ux_endpoint_transfer_request.ux_transfer_request_packet_length;
+        transfer_request -> ux_transfer_request_class_instance      =  (VOID *) cdc_acm;
+        transfer_request -> ux_transfer_request_requested_length    =  cdc_acm_reception -> ux_host_class_cdc_acm_reception_block_size;
+        transfer_request -> ux_transfer_request_completion_function =  _ux_host_class_cdc_acm_reception_callback;
+    }
     
     /* Save the acm reception structure in the acm structure.  */
     cdc_acm -> ux_host_class_cdc_acm_reception = cdc_acm_reception;
@@ -130,9 +156,9 @@ UINT            status;
     /* And declare we have a transfer in progress.  */
     cdc_acm_reception -> ux_host_class_cdc_acm_reception_state =  UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STARTED;
 
-    /* Arm a first transfer on the bulk in endpoint. There is a callback to this function so we return to the caller
+    /* Arm the first transfers on the bulk in endpoint. There is a callback to this function so we return to the caller
        right away. */
-    status =  _ux_host_stack_transfer_request(transfer_request);
+    status =  _ux_host_class_cdc_acm_reception_arm(cdc_acm);
 
     /* We do not know if the first transfer was successful yet.  If the status is not OK, we need to stop the transfer
        in progress flag. */
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_acm_reception_stop               PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -58,6 +58,7 @@
 /*                                                                        */ 
 /*    _ux_host_stack_endpoint_transfer_abort                              */
 /*                                          Abort transfer                */
+/*    _ux_host_stack_transfer_request_abort Abort transfer request        */
 /*    _ux_host_semaphore_get                Get semaphore                 */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -74,6 +75,10 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            aborted all reception       */
+/*                                            transfers,                  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_acm_reception_stop(UX_HOST_CLASS_CDC_ACM *cdc_acm, 
@@ -81,6 +86,7 @@ UINT  _ux_host_class_cdc_acm_reception_stop(UX_HOST_CLASS_CDC_ACM *cdc_acm,
 {
 
 UX_TRANSFER              *transfer_request;
+ULONG                    transfer_index;
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_CLASS_CDC_ACM_RECEPTION_STOP, cdc_acm, 0, 0, 0, UX_TRACE_HOST_CLASS_EVENTS, 0, 0)
@@ -122,19 +128,27 @@ UX_TRANSFER              *transfer_request;
     /* Declare the reception stopped.  */
     cdc_acm_reception -> ux_host_class_cdc_acm_reception_state =  UX_HOST_CLASS_CDC_ACM_RECEPTION_STATE_STOPPED;
 
-    /* Obtain pointer to transfer request.  */
-    transfer_request = &cdc_acm -> ux_host_class_cdc_acm_bulk_in_endpoint -> ux_endpoint_transfer_request;
+    for (transfer_index = 0; transfer_index < UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER_COUNT; transfer_index ++)
+    {
+
+        /* Obtain pointer to transfer request.  */
+        transfer_request =  UX_HOST_CLASS_CDC_ACM_RECEPTION_TRANSFER(cdc_acm, transfer_index);
 
-    /* Reset the completion callback function.  */
-    transfer_request -> ux_transfer_request_completion_function = UX_NULL;
+        /* Abort the other transfers still in flight.  */
+        if (transfer_index != 0)
+            _ux_host_stack_transfer_request_abort(transfer_request);
+
+        /* Reset the completion callback function.  */
+        transfer_request -> ux_transfer_request_completion_function = UX_NULL;
 
 #if !defined(UX_HOST_STANDALONE)
 
-    /* Clear semaphore counts that were (incorrectly) increased during each transfer 
-       completion.  */
-    while (transfer_request -> ux_transfer_request_semaphore.tx_semaphore_count)
-        _ux_host_semaphore_get(&transfer_request -> ux_transfer_request_semaphore, 0);
+        /* Clear semaphore counts that were (incorrectly) increased during each transfer 
+           completion.  */
+        while (transfer_request -> ux_transfer_request_semaphore.tx_semaphore_count)
+            _ux_host_semaphore_get(&transfer_request -> ux_transfer_request_semaphore, 0);
 #endif
+    }
 
     /* This function never really fails.  */
     return(UX_SUCCESS);
@@ -37,7 +37,7 @@ UX_HOST_CLASS_CDC_ECM_NX_ETHERNET_POOL_ALLOCSIZE_ASSERT
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_activate                     PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,8 @@ UX_HOST_CLASS_CDC_ECM_NX_ETHERNET_POOL_ALLOCSIZE_ASSERT
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_class_instance_allocate Allocate class instance      */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_transfer_request          Transfer request           */
 /*    _ux_host_class_cdc_ecm_endpoints_get     Get endpoints of cdc_ecm   */ 
 /*    _ux_host_class_cdc_ecm_mac_address_get   Get MAC address */
@@ -104,6 +106,9 @@ UX_HOST_CLASS_CDC_ECM_NX_ETHERNET_POOL_ALLOCSIZE_ASSERT
 /*                                            deprecated ECM pool option, */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_ecm_activate(UX_HOST_CLASS_COMMAND *command)
@@ -132,7 +137,8 @@ UX_INTERFACE                        *cur_interface;
     }
 
     /* Obtain memory for this class instance.  */
-    cdc_ecm =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_CDC_ECM));
+    cdc_ecm =  _ux_host_stack_class_instance_allocate(command -> ux_host_class_command_class_ptr,
+                    UX_NO_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_CDC_ECM));
     if (cdc_ecm == UX_NULL)
         return(UX_MEMORY_INSUFFICIENT);
 
@@ -358,7 +364,7 @@ UX_INTERFACE                        *cur_interface;
     if (cdc_ecm -> ux_host_class_cdc_ecm_thread_stack != UX_NULL)
         _ux_utility_memory_free(cdc_ecm -> ux_host_class_cdc_ecm_thread_stack);
 
-    _ux_utility_memory_free(cdc_ecm);
+    _ux_host_stack_class_instance_free(cdc_ecm -> ux_host_class_cdc_ecm_class, cdc_ecm);
     
     /* Return completion status.  */
     return(status);    
@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_deactivate                   PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -58,6 +58,9 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_class_cdc_ecm_receive_ring_clean                           */
+/*                                          Clean receive ring            */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_destroy Destroy the class instance    */ 
 /*    _ux_host_stack_endpoint_transfer_abort Abort endpoint transfer      */ 
 /*    _ux_utility_memory_free               Free memory block             */ 
@@ -93,6 +96,11 @@
 /*                                            deprecated ECM pool option, */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            added transmit segments,    */
+/*                                            added receive ring,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_ecm_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -189,6 +197,12 @@ UX_TRANSFER                 *transfer_request;
     /* Free the CDC-ECM thread's stack memory.  */
     _ux_utility_memory_free(cdc_ecm -> ux_host_class_cdc_ecm_thread_stack);
 
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+
+    /* Release the packets of the receive ring.  */
+    _ux_host_class_cdc_ecm_receive_ring_clean(cdc_ecm);
+#endif
+
     /* Destroy the bulk semaphores.  */
     _ux_host_semaphore_delete(&cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_transfer_waiting_for_check_and_arm_to_finish_semaphore);
     _ux_host_semaphore_delete(&cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_transfer_waiting_for_check_and_arm_to_finish_semaphore);
@@ -203,6 +217,10 @@ UX_TRANSFER                 *transfer_request;
         _ux_utility_memory_free(cdc_ecm -> ux_host_class_cdc_ecm_receive_buffer);
     if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer)
         _ux_utility_memory_free(cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer);
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+    if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer)
+        _ux_utility_memory_free(cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer);
+#endif
 #endif
 
     /* Before we free the device resources, we need to inform the application
@@ -219,7 +237,7 @@ UX_TRANSFER                 *transfer_request;
     UX_TRACE_OBJECT_UNREGISTER(cdc_ecm);
 
     /* Free the cdc_ecm control instance memory.  */
-    _ux_utility_memory_free(cdc_ecm);
+    _ux_host_stack_class_instance_free(cdc_ecm -> ux_host_class_cdc_ecm_class, cdc_ecm);
 
     /* Return successful status.  */
     return(UX_SUCCESS);
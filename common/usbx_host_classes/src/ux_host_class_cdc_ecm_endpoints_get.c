@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_cdc_ecm_endpoints_get                PORTABLE C      */
-/*                                                           6.1.9        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -73,6 +73,10 @@
 /*                                            use pre-calculated value    */
 /*                                            instead of wMaxPacketSize,  */
 /*                                            resulting in version 6.1.9  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transmit segments,    */
+/*                                            added receive ring,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_ecm_endpoints_get(UX_HOST_CLASS_CDC_ECM *cdc_ecm)
@@ -150,6 +154,14 @@ UX_INTERFACE    *data_interface;
             /* We have found the bulk endpoint, save it.  */
             cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_endpoint =  endpoint;
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+            /* Frames are sent in batches of transfer segments if the HCD supports it.  */
+            if (UX_DEVICE_HCD_GET(cdc_ecm -> ux_host_class_cdc_ecm_device) -> ux_hcd_capabilities &
+                UX_HCD_CAPABILITY_TRANSFER_SEGMENTS)
+                cdc_ecm -> ux_host_class_cdc_ecm_xmit_segments_support =  UX_TRUE;
+#endif
+
             break;
         }
     }
@@ -186,8 +198,15 @@ UX_INTERFACE    *data_interface;
             /* Set the class instance in the transfer request.  */
             endpoint -> ux_endpoint_transfer_request.ux_transfer_request_class_instance =  (VOID *) cdc_ecm;
 
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+
+            /* The receive ring callback re-arms the transfer request.  */
+            endpoint -> ux_endpoint_transfer_request.ux_transfer_request_completion_function =  _ux_host_class_cdc_ecm_reception_callback;
+#else
+
             /* The transfer request has NO callback function.  */
             endpoint -> ux_endpoint_transfer_request.ux_transfer_request_completion_function =  UX_NULL;
+#endif
 
             /* We have found the bulk endpoint, save it.  */
             cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_endpoint =  endpoint;
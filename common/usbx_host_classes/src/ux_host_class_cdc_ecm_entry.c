@@ -30,12 +30,25 @@
 #include "ux_host_stack.h"
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/* Define the devices or interfaces the class may accept in query.  */
+static const UX_HOST_CLASS_MATCH _ux_host_class_cdc_ecm_match[] =
+{
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_SUBCLASS,
+                            UX_HOST_CLASS_CDC_DATA_CLASS, 0, 0),
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS | UX_HOST_CLASS_MATCH_SUBCLASS,
+                            UX_HOST_CLASS_CDC_CONTROL_CLASS, UX_HOST_CLASS_CDC_ECM_CONTROL_SUBCLASS, 0),
+    UX_HOST_CLASS_MATCH_END
+};
+#endif
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_entry                        PORTABLE C      */ 
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -74,6 +87,9 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            fixed standalone compile,   */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_ecm_entry(UX_HOST_CLASS_COMMAND *command)
@@ -91,6 +107,14 @@ UINT    status;
     switch (command -> ux_host_class_command_request)
     {
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices or interfaces we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_cdc_ecm_match;
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   CDC_ECM Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_cdc_ecm.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_cdc_ecm_receive_ring_clean           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the packets of the receive ring and the      */
+/*    received packets not yet passed to NetX. The bulk in transfer must  */
+/*    have been aborted.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_ecm                               CDC ECM instance              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_release                     Release NetX packet           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    CDC ECM thread and deactivation                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_cdc_ecm_receive_ring_clean(UX_HOST_CLASS_CDC_ECM *cdc_ecm)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+NX_PACKET               *packet;
+NX_PACKET               *next_packet;
+ULONG                   ring_head;
+ULONG                   ring_count;
+
+
+    /* Take the received packets and the ring.  */
+    UX_DISABLE
+    packet =  cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head;
+    cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head =  UX_NULL;
+    ring_head =  cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head;
+    ring_count =  cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count;
+    cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count =  0;
+    UX_RESTORE
+
+    /* Release the received packets.  */
+    while (packet != UX_NULL)
+    {
+        next_packet =  packet -> nx_packet_queue_next;
+        nx_packet_release(packet);
+        packet =  next_packet;
+    }
+
+    /* Release the packets of the ring.  */
+    while (ring_count != 0)
+    {
+        nx_packet_release(cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[ring_head]);
+        ring_head =  (ring_head + 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+        ring_count --;
+    }
+}
+#endif
@@ -0,0 +1,249 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   CDC_ECM Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_cdc_ecm.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_cdc_ecm_receive_ring_process         PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs one pass of the receive ring for the CDC ECM     */
+/*    thread while the link is up. It refills the ring with packets from  */
+/*    the IP packet pool, arms the reception if it is idle, waits for     */
+/*    reception and passes all the frames received so far to NetX.        */
+/*                                                                        */
+/*    Receptions done while the ring is not empty are re-armed by         */
+/*    _ux_host_class_cdc_ecm_reception_callback.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_ecm                               CDC ECM instance              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_semaphore_get                Get semaphore                 */
+/*    _ux_host_semaphore_get_norc           Get semaphore                 */
+/*    _ux_host_semaphore_put                Put semaphore                 */
+/*    _ux_host_stack_transfer_request       Process transfer request      */
+/*    _ux_network_driver_packet_received    Process received packet       */
+/*    _ux_utility_delay_ms                  Delay                         */
+/*    nx_packet_allocate                    Allocate NetX packet          */
+/*    nx_packet_release                     Release NetX packet           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _ux_host_class_cdc_ecm_thread         CDC ECM thread                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_cdc_ecm_receive_ring_process(UX_HOST_CLASS_CDC_ECM *cdc_ecm)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_TRANSFER             *transfer_request;
+NX_PACKET               *packet;
+NX_PACKET               *next_packet;
+ULONG                   wait_option;
+UINT                    status;
+
+
+    /* Get the bulk in transfer request.  */
+    transfer_request =  &cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_endpoint -> ux_endpoint_transfer_request;
+
+    /* Refill the ring. A slot is kept for the armed packet, that goes back in the ring
+       if its transfer fails. Only wait for a packet if there is nothing to receive in.  */
+    while (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count + cdc_ecm -> ux_host_class_cdc_ecm_receive_armed <
+           UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+    {
+
+        if ((cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count == 0) &&
+            (cdc_ecm -> ux_host_class_cdc_ecm_receive_armed == UX_FALSE))
+            wait_option =  UX_MS_TO_TICK(UX_HOST_CLASS_CDC_ECM_PACKET_POOL_WAIT);
+        else
+            wait_option =  NX_NO_WAIT;
+
+        status =  nx_packet_allocate(cdc_ecm -> ux_host_class_cdc_ecm_packet_pool, &packet,
+                                     NX_RECEIVE_PACKET, wait_option);
+        if (status != NX_SUCCESS)
+        {
+
+            /* Packet allocation timed out, nothing can be received.  */
+            if (wait_option != NX_NO_WAIT)
+            {
+
+                /* Error trap. No need for trace, since NetX does it.  */
+                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+                return;
+            }
+            break;
+        }
+
+        /* Adjust the prepend pointer to take into account the non 3 bit alignment of the ethernet header.  */
+        packet -> nx_packet_prepend_ptr += sizeof(USHORT);
+
+        /* Frames are received in the packet, it must hold a full frame.  */
+        if ((ULONG)(packet -> nx_packet_data_end - packet -> nx_packet_prepend_ptr) < UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE)
+        {
+
+            /* Error trap.  */
+            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_CLASS_ETH_SIZE_ERROR);
+
+            /* Release packet.  */
+            nx_packet_release(packet);
+
+            /* Delay to let other threads to run.  */
+            _ux_utility_delay_ms(1);
+            return;
+        }
+
+        /* Add the packet to the ring, if there is still room for it.  */
+        UX_DISABLE
+        if (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count + cdc_ecm -> ux_host_class_cdc_ecm_receive_armed <
+            UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+        {
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[(cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head +
+                            cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE] =  packet;
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count ++;
+            packet =  UX_NULL;
+        }
+        UX_RESTORE
+
+        /* The ring is full.  */
+        if (packet != UX_NULL)
+        {
+            nx_packet_release(packet);
+            break;
+        }
+    }
+
+    /* Take a packet from the ring if the reception is idle.  */
+    packet =  UX_NULL;
+    UX_DISABLE
+    if ((cdc_ecm -> ux_host_class_cdc_ecm_receive_armed == UX_FALSE) &&
+        (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count != 0))
+    {
+        packet =  cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head];
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head =
+            (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head + 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count --;
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_armed =  UX_TRUE;
+        transfer_request -> ux_transfer_request_user_specific =  packet;
+    }
+    UX_RESTORE
+
+    if (packet != UX_NULL)
+    {
+
+        /* Link this packet to the reception transfer request.  */
+        transfer_request -> ux_transfer_request_data_pointer =  packet -> nx_packet_prepend_ptr;
+        transfer_request -> ux_transfer_request_requested_length =  UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE;
+        transfer_request -> ux_transfer_request_actual_length =  0;
+
+        /* We're arming the transfer now.  */
+        cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_transfer_check_and_arm_in_process =  UX_TRUE;
+
+        /* Ask USB to schedule a reception if the link is up.  */
+        if (cdc_ecm -> ux_host_class_cdc_ecm_link_state == UX_HOST_CLASS_CDC_ECM_LINK_STATE_UP)
+            status =  _ux_host_stack_transfer_request(transfer_request);
+        else
+            status =  UX_ERROR;
+
+        /* Signal that we are done arming and resume waiting thread if necessary.  */
+        cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_transfer_check_and_arm_in_process =  UX_FALSE;
+        if (cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_transfer_waiting_for_check_and_arm_to_finish == UX_TRUE)
+            _ux_host_semaphore_put(&cdc_ecm -> ux_host_class_cdc_ecm_bulk_in_transfer_waiting_for_check_and_arm_to_finish_semaphore);
+
+        if (status != UX_SUCCESS)
+        {
+
+            /* Put the packet back in the ring, unless a callback did it.  */
+            UX_DISABLE
+            if (transfer_request -> ux_transfer_request_user_specific == packet)
+            {
+                transfer_request -> ux_transfer_request_user_specific =  UX_NULL;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head =
+                    (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head + UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE - 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head] =  packet;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count ++;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_armed =  UX_FALSE;
+            }
+            UX_RESTORE
+            return;
+        }
+    }
+
+    /* Wait for receptions, if none is waiting to be passed to NetX.  */
+    if ((cdc_ecm -> ux_host_class_cdc_ecm_receive_armed == UX_TRUE) &&
+        (cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head == UX_NULL))
+        _ux_host_semaphore_get_norc(&transfer_request -> ux_transfer_request_semaphore, UX_WAIT_FOREVER);
+
+    /* Take all the received packets.  */
+    UX_DISABLE
+    packet =  cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head;
+    cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head =  UX_NULL;
+    UX_RESTORE
+
+    /* Each completion puts the transfer semaphore, drain the puts of the
+       packets taken so the thread wakes up once per batch. A packet queued
+       meanwhile is seen in the queue before waiting again.  */
+    do
+    {
+        status =  _ux_host_semaphore_get(&transfer_request -> ux_transfer_request_semaphore, UX_NO_WAIT);
+    } while (status == UX_SUCCESS);
+
+    /* And send them to the NetX USB broker.  */
+    while (packet != UX_NULL)
+    {
+        next_packet =  packet -> nx_packet_queue_next;
+        packet -> nx_packet_queue_next =  UX_NULL;
+        _ux_network_driver_packet_received(cdc_ecm -> ux_host_class_cdc_ecm_network_handle, packet);
+        packet =  next_packet;
+    }
+}
+#endif
@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   CDC_ECM Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_cdc_ecm.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_cdc_ecm_reception_callback           PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the callback from the USBX transfer functions,     */
+/*    it is called when a bulk in transfer of the receive ring is done.   */
+/*                                                                        */
+/*    The received packet is queued for the CDC ECM thread, and the next  */
+/*    packet of the ring is armed at once, so that reception goes on      */
+/*    while the thread passes the frames to NetX. If the ring is empty,   */
+/*    or on error, the thread arms the next reception.                    */
+/*                                                                        */
+/*    The packet is only taken while the reception is armed, and is       */
+/*    unlinked from the transfer request once taken, so that a late       */
+/*    abort callback does not return a queued packet to the ring.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    transfer_request                      Pointer to transfer request   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_semaphore_put                Put semaphore                 */
+/*    _ux_host_stack_transfer_request       Process transfer request      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    HCD                                                                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_cdc_ecm_reception_callback(UX_TRANSFER *transfer_request)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_CLASS_CDC_ECM           *cdc_ecm;
+NX_PACKET                       *packet;
+UINT                            completion_code;
+
+
+    /* Get the class instance for this transfer request.  */
+    cdc_ecm =  (UX_HOST_CLASS_CDC_ECM *) transfer_request -> ux_transfer_request_class_instance;
+    completion_code =  transfer_request -> ux_transfer_request_completion_code;
+
+    UX_DISABLE
+
+    /* Take the packet of the transfer, unless it's already taken by a
+       previous callback of the same transfer.  */
+    packet =  (NX_PACKET *) transfer_request -> ux_transfer_request_user_specific;
+    if ((cdc_ecm -> ux_host_class_cdc_ecm_receive_armed == UX_FALSE) || (packet == UX_NULL))
+    {
+        UX_RESTORE
+
+        /* On abort, the thread waiting for the transfer is not woken up by the stack.  */
+        if (completion_code == UX_TRANSFER_STATUS_ABORT)
+            _ux_host_semaphore_put(&transfer_request -> ux_transfer_request_semaphore);
+        return;
+    }
+    transfer_request -> ux_transfer_request_user_specific =  UX_NULL;
+
+    if (completion_code == UX_SUCCESS)
+    {
+
+        /* Set the packet length.  */
+        packet -> nx_packet_length =  transfer_request -> ux_transfer_request_actual_length;
+        packet -> nx_packet_append_ptr =
+            packet -> nx_packet_prepend_ptr + transfer_request -> ux_transfer_request_actual_length;
+        packet -> nx_packet_queue_next =  UX_NULL;
+
+        /* Queue the packet for the thread.  */
+        if (cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head == UX_NULL)
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_head =  packet;
+        else
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_tail -> nx_packet_queue_next =  packet;
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_queue_tail =  packet;
+
+        /* Get the next packet from the ring, if the link is still up.  */
+        packet =  UX_NULL;
+        if ((cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count != 0) &&
+            (cdc_ecm -> ux_host_class_cdc_ecm_link_state == UX_HOST_CLASS_CDC_ECM_LINK_STATE_UP) &&
+            (cdc_ecm -> ux_host_class_cdc_ecm_state == UX_HOST_CLASS_INSTANCE_LIVE))
+        {
+            packet =  cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head];
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head =
+                (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head + 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+            cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count --;
+            transfer_request -> ux_transfer_request_user_specific =  packet;
+        }
+    }
+    else
+    {
+
+        /* The packet is not used, put it back in the ring.  */
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head =
+            (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head + UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE - 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head] =  packet;
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count ++;
+        packet =  UX_NULL;
+    }
+
+    /* The thread arms the reception if it is not done here.  */
+    if (packet == UX_NULL)
+        cdc_ecm -> ux_host_class_cdc_ecm_receive_armed =  UX_FALSE;
+
+    UX_RESTORE
+
+    /* Arm the next reception.  */
+    if (packet != UX_NULL)
+    {
+        transfer_request -> ux_transfer_request_data_pointer =  packet -> nx_packet_prepend_ptr;
+        transfer_request -> ux_transfer_request_requested_length =  UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE;
+        transfer_request -> ux_transfer_request_actual_length =  0;
+        if (_ux_host_stack_transfer_request(transfer_request) != UX_SUCCESS)
+        {
+
+            /* Put the packet back, the thread will retry.  */
+            UX_DISABLE
+            if (transfer_request -> ux_transfer_request_user_specific == packet)
+            {
+                transfer_request -> ux_transfer_request_user_specific =  UX_NULL;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head =
+                    (cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head + UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE - 1) % UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring[cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_head] =  packet;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_ring_count ++;
+                cdc_ecm -> ux_host_class_cdc_ecm_receive_armed =  UX_FALSE;
+            }
+            UX_RESTORE
+        }
+    }
+
+    /* On abort, the thread waiting for the transfer is not woken up by the stack.  */
+    if (completion_code == UX_TRANSFER_STATUS_ABORT)
+        _ux_host_semaphore_put(&transfer_request -> ux_transfer_request_semaphore);
+}
+#endif
@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_thread                       PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,10 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_class_cdc_ecm_receive_ring_clean                           */
+/*                                          Clean receive ring            */
+/*    _ux_host_class_cdc_ecm_receive_ring_process                         */
+/*                                          Receive through ring          */
 /*    _ux_host_class_cdc_ecm_transmit_queue_clean                         */
 /*                                          Clean transmit queue          */
 /*    _ux_host_stack_transfer_request       Transfer request              */
@@ -99,17 +103,22 @@
 /*                                            deprecated ECM pool option, */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added receive ring,         */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_host_class_cdc_ecm_thread(ULONG parameter)
 {
 
 UX_HOST_CLASS_CDC_ECM       *cdc_ecm;
+#if !defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
 UX_TRANSFER                 *transfer_request;
 NX_PACKET                   *packet;
 UINT                        status;
-USB_NETWORK_DEVICE_TYPE     *usb_network_device_ptr;
 ULONG                       packet_buffer_size;
+#endif
+USB_NETWORK_DEVICE_TYPE     *usb_network_device_ptr;
 
 
     /* Cast the parameter passed in the thread into the cdc_ecm pointer.  */
@@ -160,6 +169,12 @@ ULONG                       packet_buffer_size;
                     continue;
                 }
 
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+
+                /* Receive through the ring of packets.  */
+                _ux_host_class_cdc_ecm_receive_ring_process(cdc_ecm);
+#else
+
                 /* We can accept reception. Get a NX Packet. */
                 status =  nx_packet_allocate(cdc_ecm -> ux_host_class_cdc_ecm_packet_pool, &packet,
                                              NX_RECEIVE_PACKET, UX_MS_TO_TICK(UX_HOST_CLASS_CDC_ECM_PACKET_POOL_WAIT));
@@ -330,6 +345,7 @@ ULONG                       packet_buffer_size;
                     /* Error trap. No need for trace, since NetX does it.  */
                     _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
                 }
+#endif
             }
         }
         else
@@ -338,6 +354,12 @@ ULONG                       packet_buffer_size;
             /* The link state is pending down. We need to free the xmit queue.  */
             _ux_host_class_cdc_ecm_transmit_queue_clean(cdc_ecm);
 
+#if defined(UX_HOST_CLASS_CDC_ECM_RECEIVE_RING_SIZE)
+
+            /* And the receive ring, reception has been aborted.  */
+            _ux_host_class_cdc_ecm_receive_ring_clean(cdc_ecm);
+#endif
+
             /* Link state can now be set to down.  */
 
             /* Notify the network driver.  */
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_transmission_callback        PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_class_cdc_ecm_transmit_segments_build                      */
+/*                                          Build transmit segments       */
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
 /*    nx_packet_transmit_release            Release NetX packet           */
 /*                                                                        */ 
@@ -83,6 +85,9 @@
 /*  10-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transmit segments,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_host_class_cdc_ecm_transmission_callback(UX_TRANSFER *transfer_request)
@@ -91,6 +96,12 @@ VOID  _ux_host_class_cdc_ecm_transmission_callback(UX_TRANSFER *transfer_request
     UX_PARAMETER_NOT_USED(transfer_request);
 #else
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+UX_INTERRUPT_SAVE_AREA
+
+NX_PACKET                       *last_packet;
+ULONG                           frames;
+#endif
 UX_HOST_CLASS_CDC_ECM           *cdc_ecm;
 NX_PACKET                       *current_packet;
 NX_PACKET                       *next_packet;
@@ -127,6 +138,50 @@ ULONG                           copied;
         return;
     }
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+    /* With transfer segments, a batch of frames has been sent, ZLPs included.  */
+    if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_segments_support == UX_TRUE)
+    {
+        if (transfer_request -> ux_transfer_request_completion_code == UX_SUCCESS)
+        {
+
+            /* Remove the frames sent from the queue.  */
+            UX_DISABLE
+            last_packet =  current_packet;
+            for (frames = cdc_ecm -> ux_host_class_cdc_ecm_xmit_frames; frames > 1; frames --)
+                last_packet =  last_packet -> nx_packet_queue_next;
+            next_packet =  last_packet -> nx_packet_queue_next;
+            last_packet -> nx_packet_queue_next =  UX_NULL;
+            cdc_ecm -> ux_host_class_cdc_ecm_xmit_queue_head =  next_packet;
+            UX_RESTORE
+
+            /* Send the next batch.  */
+            if (next_packet != UX_NULL)
+            {
+                _ux_host_class_cdc_ecm_transmit_segments_build(cdc_ecm, next_packet);
+                _ux_host_stack_transfer_request(transfer_request);
+            }
+
+            /* Free the packets just sent.  */
+            while (current_packet != UX_NULL)
+            {
+                next_packet =  current_packet -> nx_packet_queue_next;
+                current_packet -> nx_packet_prepend_ptr =  current_packet -> nx_packet_prepend_ptr + UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE; 
+                current_packet -> nx_packet_length =  current_packet -> nx_packet_length - UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE;
+                nx_packet_transmit_release(current_packet);
+                current_packet =  next_packet;
+            }
+        }
+        else
+
+            /* The transfer failed. Retry it.  */
+            _ux_host_stack_transfer_request(transfer_request);
+
+        return;
+    }
+#endif
+
     /* Check the state of the transfer.  */
     if (transfer_request -> ux_transfer_request_completion_code == UX_SUCCESS)
     {
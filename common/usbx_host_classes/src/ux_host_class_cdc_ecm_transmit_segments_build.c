@@ -0,0 +1,295 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */ 
+/** USBX Component                                                        */ 
+/**                                                                       */
+/**   CDC_ECM Class                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_cdc_ecm.h"
+#include "ux_host_stack.h"
+
+
+#if !defined(UX_HOST_STANDALONE) && defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_cdc_ecm_transmit_segments_build      PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function prepares the bulk OUT transfer request to send the    */
+/*    frames queued from the given packet, up to                          */
+/*    UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES of them, in one transfer.         */
+/*                                                                        */
+/*    Each frame is given as transfer segments, its end is marked by a    */
+/*    short packet or by a ZLP. Packets are sent from their own memory.   */
+/*    In a chain, the bytes of a packet beyond its last full max packet   */
+/*    size are completed from the next packets in a bounce buffer, so     */
+/*    that only the last segment of a frame is a short one.               */
+/*                                                                        */
+/*    The frames that do not fit in the segments are left for the next    */
+/*    transfer. If the first frame does not fit, it is copied to the      */
+/*    transmit buffer.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cdc_ecm                               CDC ECM instance              */
+/*    packet                                First packet to send          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Number of frames in the transfer                                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_memory_copy               Copy memory                   */
+/*    nx_packet_data_extract_offset         Extract data from packet      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    CDC ECM Class                                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _ux_host_class_cdc_ecm_transmit_segments_build(UX_HOST_CLASS_CDC_ECM *cdc_ecm, NX_PACKET *packet)
+{
+
+UX_TRANSFER             *transfer_request;
+UX_TRANSFER_SEGMENT     *segments;
+NX_PACKET               *first_packet;
+ULONG                   segment_count;
+ULONG                   frame_segment_count;
+ULONG                   max_packet_size;
+ULONG                   total_length;
+ULONG                   frames;
+UINT                    overflow;
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+NX_PACKET               *chain_packet;
+UCHAR                   *data_pointer;
+ULONG                   data_length;
+ULONG                   direct_length;
+UCHAR                   *bounce;
+ULONG                   bounce_length;
+ULONG                   bounce_count;
+ULONG                   frame_bounce_count;
+ULONG                   copied;
+#endif
+
+
+    /* Get the bulk out transfer request and its max packet size.  */
+    transfer_request =  &cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_endpoint -> ux_endpoint_transfer_request;
+    max_packet_size =  transfer_request -> ux_transfer_request_packet_length;
+
+    segments =  cdc_ecm -> ux_host_class_cdc_ecm_xmit_segments;
+    segment_count =  0;
+    total_length =  0;
+    frames =  0;
+    overflow =  UX_FALSE;
+    first_packet =  packet;
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+    bounce_count =  0;
+#endif
+
+    /* Add the queued frames one by one.  */
+    while ((packet != UX_NULL) && (frames < UX_HOST_CLASS_CDC_ECM_XMIT_FRAMES))
+    {
+
+        /* Remember where the frame starts, to remove it if it does not fit.  */
+        frame_segment_count =  segment_count;
+
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+        frame_bounce_count =  bounce_count;
+
+        if (packet -> nx_packet_next != UX_NULL)
+        {
+
+            /* Add the chain packet by packet.  */
+            bounce =  UX_NULL;
+            bounce_length =  0;
+            for (chain_packet = packet; chain_packet != UX_NULL; chain_packet = chain_packet -> nx_packet_next)
+            {
+
+                data_pointer =  chain_packet -> nx_packet_prepend_ptr;
+                data_length =  (ULONG)(chain_packet -> nx_packet_append_ptr - chain_packet -> nx_packet_prepend_ptr);
+
+                /* Complete the pending bounce buffer first.  */
+                if (bounce != UX_NULL)
+                {
+                    copied =  max_packet_size - bounce_length;
+                    if (copied > data_length)
+                        copied =  data_length;
+                    _ux_utility_memory_copy(bounce + bounce_length, data_pointer, copied); /* Use case of memcpy is verified. */
+                    bounce_length +=  copied;
+                    data_pointer +=  copied;
+                    data_length -=  copied;
+
+                    /* Still not full, go on with next packet.  */
+                    if (bounce_length < max_packet_size)
+                        continue;
+
+                    if (segment_count == UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS)
+                    {
+                        overflow =  UX_TRUE;
+                        break;
+                    }
+                    segments[segment_count].ux_transfer_segment_data_pointer =  bounce;
+                    segments[segment_count].ux_transfer_segment_length =  max_packet_size;
+                    segment_count ++;
+                    bounce =  UX_NULL;
+                }
+
+                /* Send from the packet: all the rest of the last packet, or
+                   full max packet size runs of the others.  */
+                direct_length =  data_length;
+                if (chain_packet -> nx_packet_next != UX_NULL)
+                    direct_length -=  data_length % max_packet_size;
+                if (direct_length != 0)
+                {
+                    if (segment_count == UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS)
+                    {
+                        overflow =  UX_TRUE;
+                        break;
+                    }
+                    segments[segment_count].ux_transfer_segment_data_pointer =  data_pointer;
+                    segments[segment_count].ux_transfer_segment_length =  direct_length;
+                    segment_count ++;
+                    data_pointer +=  direct_length;
+                    data_length -=  direct_length;
+                }
+
+                /* Start a bounce buffer with the remaining bytes.  */
+                if (data_length != 0)
+                {
+                    if (bounce_count == UX_HOST_CLASS_CDC_ECM_XMIT_BOUNCE_COUNT)
+                    {
+                        overflow =  UX_TRUE;
+                        break;
+                    }
+                    bounce =  cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer + bounce_count * max_packet_size;
+                    bounce_count ++;
+                    _ux_utility_memory_copy(bounce, data_pointer, data_length); /* Use case of memcpy is verified. */
+                    bounce_length =  data_length;
+                }
+            }
+
+            /* A pending bounce buffer ends the frame.  */
+            if ((overflow == UX_FALSE) && (bounce != UX_NULL))
+            {
+                if (segment_count == UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS)
+                    overflow =  UX_TRUE;
+                else
+                {
+                    segments[segment_count].ux_transfer_segment_data_pointer =  bounce;
+                    segments[segment_count].ux_transfer_segment_length =  bounce_length;
+                    segment_count ++;
+                }
+            }
+        }
+        else
+#endif
+        {
+
+            /* The frame is sent from the packet.  */
+            if (segment_count == UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS)
+                overflow =  UX_TRUE;
+            else
+            {
+                segments[segment_count].ux_transfer_segment_data_pointer =  packet -> nx_packet_prepend_ptr;
+                segments[segment_count].ux_transfer_segment_length =  packet -> nx_packet_length;
+                segment_count ++;
+            }
+        }
+
+        /* A frame of max packet size multiple ends with a ZLP.  */
+        if ((overflow == UX_FALSE) && ((packet -> nx_packet_length % max_packet_size) == 0))
+        {
+            if (segment_count == UX_HOST_CLASS_CDC_ECM_XMIT_SEGMENTS)
+                overflow =  UX_TRUE;
+            else
+            {
+                segments[segment_count].ux_transfer_segment_data_pointer =  packet -> nx_packet_prepend_ptr;
+                segments[segment_count].ux_transfer_segment_length =  0;
+                segment_count ++;
+            }
+        }
+
+        /* If the frame does not fit, leave it for next transfer.  */
+        if (overflow == UX_TRUE)
+        {
+            segment_count =  frame_segment_count;
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+            bounce_count =  frame_bounce_count;
+#endif
+            break;
+        }
+
+        /* One more frame.  */
+        total_length +=  packet -> nx_packet_length;
+        frames ++;
+        packet =  packet -> nx_packet_queue_next;
+    }
+
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+
+    /* The first frame is a long chain, copy it to the transmit buffer.  */
+    if (frames == 0)
+    {
+        nx_packet_data_extract_offset(first_packet, 0, cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer,
+                                      first_packet -> nx_packet_length, &copied);
+        segments[0].ux_transfer_segment_data_pointer =  cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer;
+        segments[0].ux_transfer_segment_length =  first_packet -> nx_packet_length;
+        segments[1].ux_transfer_segment_data_pointer =  cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer;
+        segments[1].ux_transfer_segment_length =  0;
+        segment_count =  ((first_packet -> nx_packet_length % max_packet_size) == 0) ? 2 : 1;
+        total_length =  first_packet -> nx_packet_length;
+        frames =  1;
+    }
+#endif
+
+    /* Setup the transaction parameters.  */
+    transfer_request -> ux_transfer_request_segments =  segments;
+    transfer_request -> ux_transfer_request_segment_count =  segment_count;
+    transfer_request -> ux_transfer_request_data_pointer =  segments[0].ux_transfer_segment_data_pointer;
+    transfer_request -> ux_transfer_request_requested_length =  total_length;
+
+    /* Store the first packet of this transaction.  */
+    transfer_request -> ux_transfer_request_user_specific =  first_packet;
+
+    /* Remember the number of frames sent.  */
+    cdc_ecm -> ux_host_class_cdc_ecm_xmit_frames =  frames;
+
+    /* Return the number of frames.  */
+    return(frames);
+}
+#endif
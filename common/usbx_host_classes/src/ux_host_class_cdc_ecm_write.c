@@ -36,7 +36,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_cdc_ecm_write                        PORTABLE C      */ 
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -45,6 +45,8 @@
 /*                                                                        */ 
 /*    This function writes to the cdc_ecm interface. The call is          */ 
 /*    non-blocking and queues the packet if there is an on-going write.   */
+/*    With transfer segments, the queued packets are sent in batches, see */
+/*    _ux_host_class_cdc_ecm_transmit_segments_build.                     */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -57,6 +59,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_class_cdc_ecm_transmit_segments_build                      */
+/*                                          Build transmit segments       */
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
 /*    _ux_host_semaphore_put                Release protection semaphore  */ 
 /*    nx_packet_transmit_release            Release NetX packet           */
@@ -84,6 +88,9 @@
 /*  10-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            supported NX packet chain,  */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transmit segments,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_cdc_ecm_write(VOID *cdc_ecm_class, NX_PACKET *packet)
@@ -97,6 +104,9 @@ UCHAR                   *packet_header;
 UX_HOST_CLASS_CDC_ECM   *cdc_ecm;
 #ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
 ULONG                   copied;
+#endif
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+NX_PACKET               *next_packet;
 #endif
 
     /* Get the instance.  */
@@ -105,6 +115,37 @@ ULONG                   copied;
     /* If trace is enabled, insert this event into the trace buffer.  */
     UX_TRACE_IN_LINE_INSERT(UX_TRACE_HOST_CLASS_CDC_ECM_WRITE, cdc_ecm, 0, 0, 0, UX_TRACE_HOST_CLASS_EVENTS, 0, 0)
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE) && defined(UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT)
+
+    /* Chained packets sent in transfer segments need the transmit and bounce buffers,
+       they are created before the packet is queued.  */
+    if ((cdc_ecm -> ux_host_class_cdc_ecm_xmit_segments_support == UX_TRUE) &&
+        (packet -> nx_packet_next != UX_NULL) &&
+        (cdc_ecm -> ux_host_class_cdc_ecm_state == UX_HOST_CLASS_INSTANCE_LIVE))
+    {
+        if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer == UX_NULL)
+            cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer = _ux_utility_memory_allocate(UX_NO_ALIGN,
+                                UX_CACHE_SAFE_MEMORY, UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE);
+        if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer == UX_NULL)
+            cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer = _ux_utility_memory_allocate_mulc_safe(UX_NO_ALIGN,
+                                UX_CACHE_SAFE_MEMORY, UX_HOST_CLASS_CDC_ECM_XMIT_BOUNCE_COUNT,
+                                cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_endpoint -> ux_endpoint_transfer_request.ux_transfer_request_packet_length);
+        if ((cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer == UX_NULL) ||
+            (cdc_ecm -> ux_host_class_cdc_ecm_xmit_bounce_buffer == UX_NULL))
+        {
+
+            /* Error trap.  */
+            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+
+            /* Release the packet.  */
+            packet -> nx_packet_prepend_ptr =  packet -> nx_packet_prepend_ptr + UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE; 
+            packet -> nx_packet_length =  packet -> nx_packet_length - UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE;
+            nx_packet_transmit_release(packet);
+            return(UX_MEMORY_INSUFFICIENT);
+        }
+    }
+#endif
+
     /* We're arming transfer now.  */
     cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_transfer_check_and_arm_in_process =  UX_TRUE;
 
@@ -169,42 +210,52 @@ ULONG                   copied;
             /* Get the pointer to the bulk out endpoint transfer request.  */
             transfer_request =  &cdc_ecm -> ux_host_class_cdc_ecm_bulk_out_endpoint -> ux_endpoint_transfer_request;
 
-#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+            if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_segments_support == UX_TRUE)
 
-            if (packet -> nx_packet_next != UX_NULL)
+                /* Send the queued frames in transfer segments.  */
+                _ux_host_class_cdc_ecm_transmit_segments_build(cdc_ecm, packet);
+            else
+#endif
             {
 
-                /* Create buffer.  */
-                if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer == UX_NULL)
+#ifdef UX_HOST_CLASS_CDC_ECM_PACKET_CHAIN_SUPPORT
+
+                if (packet -> nx_packet_next != UX_NULL)
                 {
-                    cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer = _ux_utility_memory_allocate(UX_NO_ALIGN,
-                                        UX_CACHE_SAFE_MEMORY, UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE);
+
+                    /* Create buffer.  */
                     if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer == UX_NULL)
                     {
-                        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
-                        return(UX_MEMORY_INSUFFICIENT);
+                        cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer = _ux_utility_memory_allocate(UX_NO_ALIGN,
+                                            UX_CACHE_SAFE_MEMORY, UX_HOST_CLASS_CDC_ECM_NX_PAYLOAD_SIZE);
+                        if (cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer == UX_NULL)
+                        {
+                            _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_MEMORY_INSUFFICIENT);
+                            return(UX_MEMORY_INSUFFICIENT);
+                        }
                     }
-                }
 
-                /* Put packet to continuous buffer to transfer.  */
-                packet_header = cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer;
-                nx_packet_data_extract_offset(packet, 0, packet_header, packet -> nx_packet_length, &copied);
-            }
-            else
+                    /* Put packet to continuous buffer to transfer.  */
+                    packet_header = cdc_ecm -> ux_host_class_cdc_ecm_xmit_buffer;
+                    nx_packet_data_extract_offset(packet, 0, packet_header, packet -> nx_packet_length, &copied);
+                }
+                else
 #endif
-            {
+                {
 
-                /* Load the address of the current packet header at the physical header.  */
-                packet_header =  packet -> nx_packet_prepend_ptr;
+                    /* Load the address of the current packet header at the physical header.  */
+                    packet_header =  packet -> nx_packet_prepend_ptr;
 
-            }
+                }
 
-            /* Setup the transaction parameters.  */
-            transfer_request -> ux_transfer_request_data_pointer     =  packet_header;
-            transfer_request -> ux_transfer_request_requested_length =  packet -> nx_packet_length;
+                /* Setup the transaction parameters.  */
+                transfer_request -> ux_transfer_request_data_pointer     =  packet_header;
+                transfer_request -> ux_transfer_request_requested_length =  packet -> nx_packet_length;
             
-            /* Store the packet that owns this transaction.  */
-            transfer_request -> ux_transfer_request_user_specific =  packet;
+                /* Store the packet that owns this transaction.  */
+                transfer_request -> ux_transfer_request_user_specific =  packet;
+            }
 
             /* Arm the transfer request.  */
             status =  _ux_host_stack_transfer_request(transfer_request);
@@ -213,6 +264,24 @@ ULONG                   copied;
             if (status != UX_SUCCESS)
             {
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+                /* Clear the queue. Packets queued meanwhile are freed too.  */
+                UX_DISABLE
+                packet =  cdc_ecm -> ux_host_class_cdc_ecm_xmit_queue_head;
+                cdc_ecm -> ux_host_class_cdc_ecm_xmit_queue_head =  UX_NULL;
+                UX_RESTORE
+
+                while (packet != UX_NULL)
+                {
+                    next_packet =  packet -> nx_packet_queue_next;
+                    packet -> nx_packet_prepend_ptr =  packet -> nx_packet_prepend_ptr + UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE; 
+                    packet -> nx_packet_length =  packet -> nx_packet_length - UX_HOST_CLASS_CDC_ECM_ETHERNET_SIZE;
+                    nx_packet_transmit_release(packet);
+                    packet =  next_packet;
+                }
+#else
+
                 /* Clear the queue. No need to clear the tail.  */
                 cdc_ecm -> ux_host_class_cdc_ecm_xmit_queue_head =  UX_NULL;
 
@@ -223,6 +292,7 @@ ULONG                   copied;
 
                 /* And ask Netx to release it.  */
                 nx_packet_transmit_release(packet);
+#endif
     
                 /* Could not arm this transfer.  */
                 status =  UX_ERROR;
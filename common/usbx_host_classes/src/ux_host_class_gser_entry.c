@@ -30,12 +30,22 @@
 #include "ux_host_stack.h"
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/* Define the devices or interfaces the class may accept in query.  */
+static const UX_HOST_CLASS_MATCH _ux_host_class_gser_match[] =
+{
+    UX_HOST_CLASS_MATCH_VID_PID(UX_HOST_CLASS_GSER_VENDOR_ID, UX_HOST_CLASS_GSER_PRODUCT_ID),
+    UX_HOST_CLASS_MATCH_END
+};
+#endif
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_gser_entry                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -70,6 +80,9 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_gser_entry(UX_HOST_CLASS_COMMAND *command)
@@ -83,6 +96,14 @@ UINT    status;
     switch (command -> ux_host_class_command_request)
     {
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices or interfaces we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_gser_match;
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
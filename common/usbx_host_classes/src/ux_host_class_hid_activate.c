@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_hid_activate                         PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -59,6 +59,8 @@
 /*    _ux_host_class_hid_descriptor_parse   Parse descriptor              */ 
 /*    _ux_host_class_hid_interrupt_endpoint_search  Search endpoint       */ 
 /*    _ux_host_class_hid_instance_clean     Clean up instance resources   */
+/*    _ux_host_stack_class_instance_allocate Allocate class instance      */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_create  Create class instance         */ 
 /*    _ux_host_stack_class_instance_destroy Destroy class instance        */ 
 /*    _ux_utility_memory_allocate           Allocate memory block         */ 
@@ -83,6 +85,9 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_hid_activate(UX_HOST_CLASS_COMMAND  *command)
@@ -98,7 +103,8 @@ UINT                status;
     interface_ptr =  (UX_INTERFACE *) command -> ux_host_class_command_container;
     
     /* Instantiate this HID class */
-    hid =  _ux_utility_memory_allocate(UX_NO_ALIGN,  UX_REGULAR_MEMORY,sizeof(UX_HOST_CLASS_HID));
+    hid =  _ux_host_stack_class_instance_allocate(command -> ux_host_class_command_class_ptr,
+                    UX_NO_ALIGN,  UX_REGULAR_MEMORY,sizeof(UX_HOST_CLASS_HID));
     if (hid == UX_NULL)
         return(UX_MEMORY_INSUFFICIENT);
         
@@ -203,7 +209,7 @@ UINT                status;
     interface_ptr -> ux_interface_class_instance = UX_NULL;
 
     /* Free instance. */
-    _ux_utility_memory_free(hid);
+    _ux_host_stack_class_instance_free(hid -> ux_host_class_hid_class, hid);
 
     /* Return error code. */
     return(status);
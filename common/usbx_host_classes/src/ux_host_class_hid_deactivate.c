@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_hid_deactivate                       PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    (ux_host_class_hid_client_handler)    HID client handler            */ 
 /*    _ux_host_class_hid_instance_clean     HID instance clean            */ 
 /*    _ux_host_stack_class_instance_destroy Destroy the class instance    */ 
@@ -80,6 +81,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_hid_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -168,7 +172,7 @@ UINT                                status;
     UX_TRACE_OBJECT_UNREGISTER(hid);
 
     /* The HID is now free again.  */
-    _ux_utility_memory_free(hid);
+    _ux_host_stack_class_instance_free(hid -> ux_host_class_hid_class, hid);
 
     /* Return successful completion.  */
     return(UX_SUCCESS);         
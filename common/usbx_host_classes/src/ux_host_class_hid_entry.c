@@ -46,12 +46,22 @@ static inline UINT _ux_host_class_hid_activate_wait(UX_HOST_CLASS_COMMAND *comma
 #endif
 
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+/* Define the devices or interfaces the class may accept in query.  */
+static const UX_HOST_CLASS_MATCH _ux_host_class_hid_match[] =
+{
+    UX_HOST_CLASS_MATCH_CSP(UX_HOST_CLASS_MATCH_CLASS, UX_HOST_CLASS_HID_CLASS, 0, 0),
+    UX_HOST_CLASS_MATCH_END
+};
+#endif
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_hid_entry                            PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -74,6 +84,7 @@ static inline UINT _ux_host_class_hid_activate_wait(UX_HOST_CLASS_COMMAND *comma
 /*                                                                        */
 /*    _ux_host_class_hid_activate           Activate HID class            */
 /*    _ux_host_class_hid_deactivate         Deactivate HID class          */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_utility_memory_free               Free memory                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -97,6 +108,10 @@ static inline UINT _ux_host_class_hid_activate_wait(UX_HOST_CLASS_COMMAND *comma
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            added class match list,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_hid_entry(UX_HOST_CLASS_COMMAND *command)
@@ -113,6 +128,14 @@ UX_HOST_CLASS_HID_CLIENT_COMMAND    client_command;
     switch (command -> ux_host_class_command_request)
     {
 
+#if defined(UX_HOST_CLASS_MATCH_INDEX_ENABLE)
+    case UX_HOST_CLASS_COMMAND_MATCH_GET:
+
+        /* Give the stack the list of devices or interfaces we may accept.  */
+        command -> ux_host_class_command_container =  (VOID *)_ux_host_class_hid_match;
+        return(UX_SUCCESS);
+#endif
+
     case UX_HOST_CLASS_COMMAND_QUERY:
 
         /* The query command is used to let the stack enumeration process know if we want to own
@@ -591,7 +614,7 @@ UINT                    status;
             _ux_utility_memory_free(hid -> ux_host_class_hid_allocated);
 
         /* Free instance. */
-        _ux_utility_memory_free(hid);
+        _ux_host_stack_class_instance_free(hid -> ux_host_class_hid_class, hid);
         return(UX_STATE_NEXT);
 
     case UX_HOST_CLASS_HID_ENUM_DONE                     :
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_hid_field_decompress                 PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -43,6 +43,8 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */ 
 /*    This function will decompress a field and return the usage/value.   */ 
+/*    Each value is extracted from the bytes covering it with shift and   */ 
+/*    mask instead of bit by bit.                                         */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -69,6 +71,10 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            extracted values with shift */
+/*                                            and mask,                   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_hid_field_decompress(UX_HOST_CLASS_HID_FIELD *hid_field, UCHAR *report_buffer, UX_HOST_CLASS_HID_CLIENT_REPORT *client_report)
@@ -76,55 +82,55 @@ UINT  _ux_host_class_hid_field_decompress(UX_HOST_CLASS_HID_FIELD *hid_field, UC
 
 ULONG       field_report_count;
 ULONG       field_report_size;
-ULONG       data_offset_byte;
+ULONG       field_value_mask;
 ULONG       data_offset_bit;
-ULONG       data_offset_bit_in_report;
+ULONG       data_offset_bit_in_byte;
+ULONG       data_bytes;
 ULONG       field_value;
-ULONG       field_value_bit_shifting;
 ULONG       field_usage;
-ULONG       report_content;
+UCHAR       *report_content;
 
 
-    /* Calculate the address of the beginning of the field in the report.  */
-    data_offset_byte =  (hid_field -> ux_host_class_hid_field_report_offset >> 3);
+    /* Get the report size in bits, it's not larger than 32 (checked while parsing).  */
+    field_report_size =  hid_field -> ux_host_class_hid_field_report_size;
 
-    /* Calculate the bit start address. Hopefully things will be on a boundary but not necessary.  */
-    data_offset_bit =  hid_field -> ux_host_class_hid_field_report_offset & 7;
+    /* Build the mask of the value bits.  */
+    field_value_mask =  (field_report_size >= 32) ? 0xFFFFFFFFu : ((1u << field_report_size) - 1u);
+
+    /* Calculate the bit start address of the field in the report.  */
+    data_offset_bit =  hid_field -> ux_host_class_hid_field_report_offset;
 
     /* Each report field has a report_count value. This count is used to extract values from the 
        incoming report and build each usage/value instance.  */
     for (field_report_count = 0; field_report_count < hid_field -> ux_host_class_hid_field_report_count; field_report_count++)
     {
 
-        /* Get the report size in bits.  */
-        field_report_size =  hid_field -> ux_host_class_hid_field_report_size;
-        
-        /* We use the bit offset for this report and not the generic field bit offset.  */
-        data_offset_bit_in_report = data_offset_bit;
-        
-        /* Reset the local value.  */
-        field_value =  0;
-        
-        /* And start with bit 0 in the target value.  */
-        field_value_bit_shifting =  0;
-        
-        /* Build the value field bit by bit.  */
-        while (field_report_size-- != 0)
-        {
+        /* Locate the first byte of the value and the number of bytes the value spans.  */
+        report_content =  report_buffer + (data_offset_bit >> 3);
+        data_offset_bit_in_byte =  data_offset_bit & 7;
+        data_bytes =  (data_offset_bit_in_byte + field_report_size + 7) >> 3;
 
-            /* Read the content. This method is redundant if we are not changing byte but it 
-               makes the algorithm much easier.  */
-            report_content =  (ULONG) *(report_buffer + data_offset_byte + (data_offset_bit_in_report >> 3));        
-            
-            /* Shift the current value content to allow space to store the new bit.  */
-            field_value |=  ((report_content >> (data_offset_bit_in_report & 7)) & 1) << field_value_bit_shifting;
-                
-            /* Move to next bit in the report.  */
-            data_offset_bit_in_report++;
-            
-            /* And the next bit in the value.  */
-            field_value_bit_shifting++;
-        }        
+        /* Load the bytes at once (little endian) instead of bit by bit, only the bytes
+           covering the value are read.  */
+        field_value =  0;
+        if (data_bytes > 0)
+            field_value  =  (ULONG) report_content[0];
+        if (data_bytes > 1)
+            field_value |=  (ULONG) report_content[1] << 8;
+        if (data_bytes > 2)
+            field_value |=  (ULONG) report_content[2] << 16;
+        if (data_bytes > 3)
+            field_value |=  (ULONG) report_content[3] << 24;
+
+        /* Shift the value to bit 0.  */
+        field_value >>=  data_offset_bit_in_byte;
+
+        /* A value not on byte boundary may span a 5th byte.  */
+        if (data_bytes > 4)
+            field_value |=  (ULONG) report_content[4] << (32 - data_offset_bit_in_byte);
+
+        /* Keep the value bits only.  */
+        field_value &=  field_value_mask;
 
         /* The Usage value will depend if the data is defined as a variable or an array in the HID report.  */
         if (hid_field -> ux_host_class_hid_field_value & UX_HOST_CLASS_HID_ITEM_VARIABLE)
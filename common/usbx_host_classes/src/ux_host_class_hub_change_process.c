@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_hub_change_process                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,8 +56,10 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_host_class_hub_port_change_process Port change process          */ 
+/*    _ux_host_class_hub_ports_enumerate    Enumerate addressed devices   */
 /*    _ux_host_stack_transfer_request       Process transfer request      */ 
 /*    _ux_utility_short_get                 Get 16-bit word               */ 
+/*    _ux_utility_time_get                  Get current time              */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -70,6 +72,10 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added enumeration pipeline  */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_hub_change_process(UX_HOST_CLASS_HUB *hub)
@@ -94,6 +100,13 @@ UINT            status;
     else
         port_status_change_bits =  (USHORT)_ux_utility_short_get(transfer_request -> ux_transfer_request_data_pointer);
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+    /* Ports changed together are debounced together, from the time the
+       change is reported.  */
+    hub -> ux_host_class_hub_change_time =  _ux_utility_time_get();
+#endif
+
     /* Scan all bits and report the change on each port.  */
     for (port_index = 1; port_index <= hub -> ux_host_class_hub_descriptor.bNbPorts; port_index++)
     {
@@ -102,6 +115,13 @@ UINT            status;
             _ux_host_class_hub_port_change_process(hub, port_index);
     }
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE) && !defined(UX_HOST_STANDALONE)
+
+    /* Now all new devices are addressed, enumerate them.  */
+    if (hub -> ux_host_class_hub_port_enumerate)
+        _ux_host_class_hub_ports_enumerate(hub);
+#endif
+
     /* The HUB could also have changed.  */
     if (port_status_change_bits & 1)
         _ux_host_class_hub_hub_change_process(hub);
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_hub_port_change_connection_process   PORTABLE C      */ 
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -60,9 +60,12 @@
 /*    _ux_host_class_hub_feature            Set HUB feature               */ 
 /*    _ux_host_class_hub_port_reset         Reset port                    */ 
 /*    _ux_host_class_hub_status_get         Get status                    */ 
+/*    _ux_host_stack_new_device_address     Create and address device     */
 /*    _ux_host_stack_new_device_create      Create new device             */ 
 /*    _ux_host_stack_device_remove          Remove device                 */ 
 /*    _ux_utility_delay_ms                  Thread sleep                  */ 
+/*    _ux_utility_thread_sleep              Thread sleep                  */
+/*    _ux_utility_time_get                  Get current time              */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -88,6 +91,10 @@
 /*  07-29-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            added standalone support,   */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added enumeration pipeline  */
+/*                                            support,                    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_host_class_hub_port_change_connection_process(UX_HOST_CLASS_HUB *hub, UINT port, UINT port_status)
@@ -102,6 +109,10 @@ USHORT      port_power;
 UINT        status;
 USHORT      local_port_status;
 USHORT      local_port_change;
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+UINT        pipeline;
+ULONG       elapsed;
+#endif
 #endif
     
     /* If trace is enabled, insert this event into the trace buffer.  */
@@ -138,10 +149,30 @@ USHORT      local_port_change;
            not process the same change event again.  */
         _ux_host_class_hub_feature(hub, port, UX_CLEAR_FEATURE, UX_HOST_CLASS_HUB_C_PORT_CONNECTION);
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+
+        /* The first try is pipelined, unless this is the fall back of a failed
+           pipelined enumeration, see _ux_host_class_hub_ports_enumerate.  */
+        pipeline =  (hub -> ux_host_class_hub_port_enumerate & (UINT)(1 << port)) ? UX_FALSE : UX_TRUE;
+        hub -> ux_host_class_hub_port_enumerate &= (UINT)~(1 << port);
+#endif
+
         /* Some devices are known to fail on the first try.  */
         for (device_enumeration_retry = 0; device_enumeration_retry < UX_HOST_CLASS_HUB_ENUMERATION_RETRY; device_enumeration_retry++)
         {
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+            if (pipeline && device_enumeration_retry == 0)
+            {
+
+                /* Wait for debounce, counted from the hub change.  */
+                elapsed =  (ULONG) _ux_utility_time_elapsed(hub -> ux_host_class_hub_change_time, _ux_utility_time_get());
+                if (elapsed < UX_MS_TO_TICK(UX_HOST_CLASS_HUB_ENUMERATION_DEBOUNCE_DELAY))
+                    _ux_utility_thread_sleep(UX_MS_TO_TICK(UX_HOST_CLASS_HUB_ENUMERATION_DEBOUNCE_DELAY) - elapsed + 1);
+            }
+            else
+#endif
+
             /* Wait for debounce.  */
             _ux_utility_delay_ms(UX_HOST_CLASS_HUB_ENUMERATION_DEBOUNCE_DELAY);
 
@@ -185,6 +216,29 @@ USHORT      local_port_change;
             /* Wait for reset recovery.  */
             _ux_utility_delay_ms(UX_HOST_CLASS_HUB_ENUMERATION_RESET_RECOVERY_DELAY);
 
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE)
+            if (pipeline && device_enumeration_retry == 0)
+            {
+
+                /* Only create the device and set its address, so the next port
+                   can be reset. The device is enumerated once all changed ports
+                   are processed, see _ux_host_class_hub_ports_enumerate.  */
+                status =  _ux_host_stack_new_device_address(UX_DEVICE_HCD_GET(hub -> ux_host_class_hub_device),
+                                            hub -> ux_host_class_hub_device,
+                                            port, device_speed, port_power,
+                                            &device);
+                if (status == UX_SUCCESS)
+                {
+
+                    /* Mark the device to enumerate.  */
+                    hub -> ux_host_class_hub_port_device[port] =  device;
+                    hub -> ux_host_class_hub_port_enumerate |= (UINT)(1 << port);
+                    return;
+                }
+            }
+            else
+#endif
+
             /* Perform the device creation.  */
             status =  _ux_host_stack_new_device_create(UX_DEVICE_HCD_GET(hub -> ux_host_class_hub_device),
                                             hub -> ux_host_class_hub_device,
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   HUB Class                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_hub.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_ENUMERATION_PIPELINE_ENABLE) && !defined(UX_HOST_STANDALONE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_hub_ports_enumerate                  PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enumerates the devices addressed by                   */
+/*    _ux_host_class_hub_port_change_connection_process while the hub     */
+/*    changes are processed. As each device left the default address      */
+/*    before the next port was reset, the debounce and address waits of   */
+/*    the ports are overlapped.                                           */
+/*                                                                        */
+/*    If the enumeration of a device fails, the port connection is        */
+/*    processed again without pipeline, with the usual retries.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hub                                   Pointer to HUB                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_class_hub_port_change_connection_process                   */
+/*                                          Process connection            */
+/*    _ux_host_stack_new_device_enumerate   Enumerate device              */
+/*    _ux_utility_delay_ms                  Thread sleep                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    HUB Class                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_hub_ports_enumerate(UX_HOST_CLASS_HUB *hub)
+{
+
+UX_DEVICE   *device;
+UINT        port_index;
+UINT        status;
+
+
+    /* Enumerate the addressed devices, in port order.  */
+    for (port_index = 1; port_index <= hub -> ux_host_class_hub_descriptor.bNbPorts; port_index++)
+    {
+
+        /* Check if there is a device to enumerate on this port.  */
+        if ((hub -> ux_host_class_hub_port_enumerate & (UINT)(1 << port_index)) == 0)
+            continue;
+
+        /* Get the addressed device.  */
+        device =  hub -> ux_host_class_hub_port_device[port_index];
+        hub -> ux_host_class_hub_port_device[port_index] =  UX_NULL;
+
+        /* Read the descriptors, parse the configurations and look for a class.  */
+        status =  _ux_host_stack_new_device_enumerate(device);
+
+        /* As in connection process, no retry if there is no class found.  */
+        if (status == UX_SUCCESS || status == UX_NO_CLASS_MATCH)
+        {
+
+            /* The device is enumerated.  */
+            hub -> ux_host_class_hub_port_enumerate &= (UINT)~(1 << port_index);
+
+            /* If the device instance is ready, notify application for unconfigured device.  */
+            if (_ux_system_host -> ux_system_host_change_function)
+            {
+                _ux_system_host -> ux_system_host_change_function(UX_DEVICE_CONNECTION, UX_NULL, (VOID*)device);
+            }
+
+            if (status == UX_NO_CLASS_MATCH)
+            {
+
+                /* Error trap. */
+                _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_ROOT_HUB, UX_DEVICE_ENUMERATION_FAILURE);
+
+                /* If trace is enabled, insert this event into the trace buffer.  */
+                UX_TRACE_IN_LINE_INSERT(UX_TRACE_ERROR, UX_DEVICE_ENUMERATION_FAILURE, port_index, 0, 0, UX_TRACE_ERRORS, 0, 0)
+            }
+            continue;
+        }
+
+        /* Wait for a while.  */
+        _ux_utility_delay_ms(UX_HOST_CLASS_HUB_ENUMERATION_RETRY_DELAY);
+
+        /* Process the connection again, the device is removed and the port is
+           reset for the retries. The port bit is still set so the connection
+           process does not pipeline it again.  */
+        _ux_host_class_hub_port_change_connection_process(hub, port_index, UX_HOST_CLASS_HUB_PORT_STATUS_CONNECTION);
+    }
+
+    /* Return to caller.  */
+    return;
+}
+#endif
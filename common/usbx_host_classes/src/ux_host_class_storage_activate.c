@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_storage_activate                     PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,8 @@
 /*    _ux_host_class_storage_configure      Configure storage device      */
 /*    _ux_host_class_storage_device_initialize                            */
 /*                                          Initialize storage device     */
+/*    _ux_host_stack_class_instance_allocate Allocate class instance      */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_stack_class_instance_create  Create class instance         */
 /*    _ux_host_stack_class_instance_destroy Destroy class instance        */
 /*    _ux_utility_memory_allocate           Allocate memory block         */
@@ -81,6 +83,9 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_storage_activate(UX_HOST_CLASS_COMMAND *command)
@@ -97,7 +102,8 @@ UINT                    status;
 
     /* Obtain memory for this class instance.  The memory used MUST BE allocated from a CACHE SAFE memory
        since the buffer for the CSW is an array contained within each storage instance. */
-    storage =  _ux_utility_memory_allocate(UX_SAFE_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_STORAGE));
+    storage =  _ux_host_stack_class_instance_allocate(command -> ux_host_class_command_class_ptr,
+                    UX_SAFE_ALIGN, UX_CACHE_SAFE_MEMORY, sizeof(UX_HOST_CLASS_STORAGE));
     if (storage == UX_NULL)
         return(UX_MEMORY_INSUFFICIENT);
 
@@ -122,7 +128,7 @@ UINT                    status;
     status =  _ux_host_class_storage_device_support_check(storage);
     if (status != UX_SUCCESS)
     {
-        _ux_utility_memory_free(storage);
+        _ux_host_stack_class_instance_free(storage -> ux_host_class_storage_class, storage);
         return(status);
     }
 
@@ -131,7 +137,7 @@ UINT                    status;
     status =  _ux_host_class_storage_endpoints_get(storage);
     if (status != UX_SUCCESS)
     {
-        _ux_utility_memory_free(storage);
+        _ux_host_stack_class_instance_free(storage -> ux_host_class_storage_class, storage);
         return(status);
     }
 
@@ -169,7 +175,7 @@ UINT                    status;
         interface_ptr -> ux_interface_class_instance =  (VOID *) UX_NULL;
 
         /* Free memory for class instance.  */
-        _ux_utility_memory_free(storage);
+        _ux_host_stack_class_instance_free(storage -> ux_host_class_storage_class, storage);
 
         return(status);
     }
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_storage_deactivate                   PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    ux_media_close                        Close media                   */ 
 /*    _ux_host_stack_endpoint_transfer_abort Abort transfer request       */ 
 /*    _ux_host_stack_class_instance_destroy Destroy class instance        */ 
@@ -90,6 +91,9 @@
 /*                                            improved media insert/eject */
 /*                                            management without FX,      */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_storage_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -240,7 +244,7 @@ VOID                            *memory;
     UX_TRACE_OBJECT_UNREGISTER(storage);
 
     /* Free the storage instance memory.  */
-    _ux_utility_memory_free(storage);
+    _ux_host_stack_class_instance_free(storage -> ux_host_class_storage_class, storage);
 
     /* Return successful completion.  */
     return(UX_SUCCESS);         
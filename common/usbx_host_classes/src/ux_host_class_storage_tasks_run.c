@@ -53,7 +53,7 @@ static inline UINT _ux_host_class_storage_transport_sense_check(UX_HOST_CLASS_ST
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_storage_tasks_run                    PORTABLE C      */
-/*                                                           6.2.0        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -80,6 +80,7 @@ static inline UINT _ux_host_class_storage_transport_sense_check(UX_HOST_CLASS_ST
 /*    _ux_host_class_storage_media_mount    Mount the media               */
 /*    _ux_host_class_storage_unit_ready_test                              */
 /*                                          Test for unit ready           */
+/*    _ux_host_stack_class_instance_free    Free class instance           */
 /*    _ux_host_class_storage_media_characteristics_get                    */
 /*                                          Get media characteristics     */
 /*    _ux_host_class_storage_media_format_capacity_get                    */
@@ -102,6 +103,9 @@ static inline UINT _ux_host_class_storage_transport_sense_check(UX_HOST_CLASS_ST
 /*  10-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            improved internal logic,    */
 /*                                            resulting in version 6.2.0  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used class instance pool,   */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_storage_tasks_run(UX_HOST_CLASS *storage_class)
@@ -215,7 +219,7 @@ INT             immediate_state;
                 _ux_host_stack_class_instance_destroy(
                     storage -> ux_host_class_storage_class, (VOID *) storage);
                 interface_ptr -> ux_interface_class_instance =  (VOID *) UX_NULL;
-                _ux_utility_memory_free(storage);
+                _ux_host_stack_class_instance_free(storage -> ux_host_class_storage_class, storage);
                 return;
             }
 
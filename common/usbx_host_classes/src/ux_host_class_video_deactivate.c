@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_host_class_video_deactivate                     PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -56,6 +56,8 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_host_class_video_frame_buffers_flush                            */
+/*                                          Return frame buffers          */
 /*    _ux_host_stack_class_instance_destroy Destroy class instance        */ 
 /*    _ux_host_stack_endpoint_transfer_abort                              */
 /*                                          Abort outstanding transfer    */ 
@@ -85,6 +87,9 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            refined macros names,       */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            returned frame buffers,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_video_deactivate(UX_HOST_CLASS_COMMAND *command)
@@ -110,6 +115,12 @@ UINT                    status;
     if (video -> ux_host_class_video_isochronous_endpoint)
         _ux_host_stack_endpoint_transfer_abort(video -> ux_host_class_video_isochronous_endpoint);
 
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+
+    /* Return frame buffers to application.  */
+    _ux_host_class_video_frame_buffers_flush(video);
+#endif
+
     /* The enumeration thread needs to sleep a while to allow the application or the class that may be using
        endpoints to exit properly.  */
     _ux_host_thread_schedule_other(UX_THREAD_PRIORITY_ENUM); 
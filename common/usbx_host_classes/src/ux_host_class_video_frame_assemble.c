@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Video Class                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_video.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_video_frame_assemble                 PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function assembles the payload of a completed isoch transfer   */
+/*    into the current frame buffer.                                      */
+/*                                                                        */
+/*    The payload header is checked and stripped, the payload data is     */
+/*    appended to the frame buffer. PTS and SCR of the first payload that */
+/*    has them are saved in the frame buffer. A frame ends on EOF or on   */
+/*    FID toggle, then it's passed to the frame callback. Errors reported */
+/*    by the transfer or the payload header are flagged in the frame      */
+/*    buffer status.                                                      */
+/*                                                                        */
+/*    If there is no free frame buffer, the frame is dropped until the    */
+/*    next FID toggle.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*    transfer_request                      Pointer to transfer request   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_utility_long_get                  Get 32-bit value              */
+/*    _ux_utility_short_get                 Get 16-bit value              */
+/*    _ux_utility_memory_copy               Copy memory                   */
+/*    (ux_host_class_video_frame_callback)  Frame callback                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Video Class                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_video_frame_assemble(UX_HOST_CLASS_VIDEO *video, UX_TRANSFER *transfer_request)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_CLASS_VIDEO_FRAME_BUFFER    *frame_buffer;
+UCHAR                               *data;
+ULONG                               length;
+ULONG                               header_length;
+ULONG                               header_info;
+ULONG                               fid;
+ULONG                               offset;
+
+
+    /* Get the payload.  */
+    data =    transfer_request -> ux_transfer_request_data_pointer;
+    length =  transfer_request -> ux_transfer_request_actual_length;
+
+    /* Get the frame buffer in assembly.  */
+    frame_buffer =  video -> ux_host_class_video_frame_buffer_current;
+
+    /* Check transfer status and payload header.  */
+    if ((transfer_request -> ux_transfer_request_completion_code != UX_SUCCESS) ||
+        (length < UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_MIN_LENGTH) ||
+        (data[UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_LENGTH] < UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_MIN_LENGTH) ||
+        (data[UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_LENGTH] > length))
+    {
+
+        /* Data of the frame is lost.  */
+        if (frame_buffer != UX_NULL)
+            frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_ERROR;
+        return;
+    }
+    header_length =  data[UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_LENGTH];
+    header_info =    data[UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO];
+    fid =            header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_FID;
+
+    /* FID toggle starts a new frame.  */
+    if (fid != video -> ux_host_class_video_frame_fid)
+    {
+
+        /* Pass the frame in assembly, its EOF is missing.  */
+        if (frame_buffer != UX_NULL)
+        {
+            video -> ux_host_class_video_frame_buffer_current =  UX_NULL;
+            video -> ux_host_class_video_frame_callback(video, frame_buffer);
+            frame_buffer =  UX_NULL;
+        }
+
+        /* Stop dropping, unless it's the first payload after start, the
+           first frame may be partial.  */
+        if (video -> ux_host_class_video_frame_fid != UX_HOST_CLASS_VIDEO_FRAME_FID_NONE)
+            video -> ux_host_class_video_frame_drop =  UX_FALSE;
+        video -> ux_host_class_video_frame_fid =  fid;
+    }
+
+    /* Skip the payloads of a frame that is dropped.  */
+    if (video -> ux_host_class_video_frame_drop)
+    {
+
+        /* Dropped frame ends.  */
+        if (header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_EOF)
+            video -> ux_host_class_video_frame_drop =  UX_FALSE;
+        return;
+    }
+
+    /* Start a new frame buffer.  */
+    if (frame_buffer == UX_NULL)
+    {
+
+        /* Nothing to assemble.  */
+        if (length == header_length)
+            return;
+
+        /* Get a free frame buffer.  */
+        UX_DISABLE
+        frame_buffer =  video -> ux_host_class_video_frame_buffer_head;
+        if (frame_buffer != UX_NULL)
+        {
+            video -> ux_host_class_video_frame_buffer_head =  frame_buffer -> ux_host_class_video_frame_buffer_next;
+            if (video -> ux_host_class_video_frame_buffer_head == UX_NULL)
+                video -> ux_host_class_video_frame_buffer_tail =  UX_NULL;
+        }
+        UX_RESTORE
+
+        /* No buffer, drop the frame.  */
+        if (frame_buffer == UX_NULL)
+        {
+            video -> ux_host_class_video_frames_dropped ++;
+            if ((header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_EOF) == 0)
+                video -> ux_host_class_video_frame_drop =  UX_TRUE;
+            return;
+        }
+
+        /* Frame buffer is empty.  */
+        frame_buffer -> ux_host_class_video_frame_buffer_next =    UX_NULL;
+        frame_buffer -> ux_host_class_video_frame_buffer_length =  0;
+        frame_buffer -> ux_host_class_video_frame_buffer_status =  0;
+        frame_buffer -> ux_host_class_video_frame_buffer_pts =     0;
+        frame_buffer -> ux_host_class_video_frame_buffer_scr_stc = 0;
+        frame_buffer -> ux_host_class_video_frame_buffer_scr_sof = 0;
+        video -> ux_host_class_video_frame_buffer_current =  frame_buffer;
+    }
+
+    /* Save presentation time stamp.  */
+    offset =  UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_PTS;
+    if (header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_PTS)
+    {
+        if ((header_length >= offset + 4) &&
+            !(frame_buffer -> ux_host_class_video_frame_buffer_status & UX_HOST_CLASS_VIDEO_FRAME_BUFFER_PTS))
+        {
+            frame_buffer -> ux_host_class_video_frame_buffer_pts =  _ux_utility_long_get(data + offset);
+            frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_PTS;
+        }
+        offset += 4;
+    }
+
+    /* Save source clock reference.  */
+    if (header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_SCR)
+    {
+        if ((header_length >= offset + 6) &&
+            !(frame_buffer -> ux_host_class_video_frame_buffer_status & UX_HOST_CLASS_VIDEO_FRAME_BUFFER_SCR))
+        {
+            frame_buffer -> ux_host_class_video_frame_buffer_scr_stc =  _ux_utility_long_get(data + offset);
+            frame_buffer -> ux_host_class_video_frame_buffer_scr_sof =  _ux_utility_short_get(data + offset + 4);
+            frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_SCR;
+        }
+    }
+
+    /* Device reports error in the frame.  */
+    if (header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_ERR)
+        frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_ERROR;
+
+    /* Append payload data, as much as the frame buffer can take.  */
+    length -=  header_length;
+    offset =   frame_buffer -> ux_host_class_video_frame_buffer_size -
+               frame_buffer -> ux_host_class_video_frame_buffer_length;
+    if (length > offset)
+    {
+        length =  offset;
+        frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_OVERFLOW;
+    }
+    _ux_utility_memory_copy(frame_buffer -> ux_host_class_video_frame_buffer_data +
+                            frame_buffer -> ux_host_class_video_frame_buffer_length,
+                            data + header_length, length); /* Use case of memcpy is verified. */
+    frame_buffer -> ux_host_class_video_frame_buffer_length += length;
+
+    /* End of frame, pass it.  */
+    if (header_info & UX_HOST_CLASS_VIDEO_PAYLOAD_HEADER_INFO_EOF)
+    {
+        frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_EOF;
+        video -> ux_host_class_video_frame_buffer_current =  UX_NULL;
+        video -> ux_host_class_video_frame_callback(video, frame_buffer);
+    }
+
+    /* Return to caller.  */
+    return;
+}
+#endif
@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Video Class                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_video.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_video_frame_buffer_add               PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a frame buffer to the video class, for payloads  */
+/*    to be assembled into. Frame buffers are filled in the order they    */
+/*    are added. The frame buffer is owned by the class until it's passed */
+/*    to the frame callback.                                              */
+/*                                                                        */
+/*    The data and size fields must be set by the caller, other fields   */
+/*    are filled by the class.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*    frame_buffer                          Pointer to frame buffer       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_stack_class_instance_verify  Verify instance is valid      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*    Video Class                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_class_video_frame_buffer_add(UX_HOST_CLASS_VIDEO *video, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *frame_buffer)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+
+    /* Ensure the instance is valid.  */
+    if (_ux_host_stack_class_instance_verify(_ux_system_host_class_video_name, (VOID *) video) != UX_SUCCESS)
+    {
+
+        /* Error trap. */
+        _ux_system_error_handler(UX_SYSTEM_LEVEL_THREAD, UX_SYSTEM_CONTEXT_CLASS, UX_HOST_CLASS_INSTANCE_UNKNOWN);
+
+        return(UX_HOST_CLASS_INSTANCE_UNKNOWN);
+    }
+
+    /* Frame buffer is empty.  */
+    frame_buffer -> ux_host_class_video_frame_buffer_next =    UX_NULL;
+    frame_buffer -> ux_host_class_video_frame_buffer_length =  0;
+    frame_buffer -> ux_host_class_video_frame_buffer_status =  0;
+
+    /* Append it to the free frame buffers, the list is also accessed
+       in transfer completion.  */
+    UX_DISABLE
+    if (video -> ux_host_class_video_frame_buffer_tail == UX_NULL)
+        video -> ux_host_class_video_frame_buffer_head =  frame_buffer;
+    else
+        video -> ux_host_class_video_frame_buffer_tail -> ux_host_class_video_frame_buffer_next =  frame_buffer;
+    video -> ux_host_class_video_frame_buffer_tail =  frame_buffer;
+    UX_RESTORE
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_class_video_frame_buffer_add              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in video frame buffer add function      */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*    frame_buffer                          Pointer to frame buffer       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_class_video_frame_buffer_add Add frame buffer              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_class_video_frame_buffer_add(UX_HOST_CLASS_VIDEO *video, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *frame_buffer)
+{
+
+    /* Sanity checks.  */
+    if ((video == UX_NULL) || (frame_buffer == UX_NULL) ||
+        (frame_buffer -> ux_host_class_video_frame_buffer_data == UX_NULL) ||
+        (frame_buffer -> ux_host_class_video_frame_buffer_size == 0))
+        return(UX_INVALID_PARAMETER);
+
+    /* Call the actual video frame buffer add function.  */
+    return(_ux_host_class_video_frame_buffer_add(video, frame_buffer));
+}
+#endif
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Video Class                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_video.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_video_frame_buffers_flush            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns all frame buffers owned by the video class to */
+/*    the application, through the frame callback with ABORTED status.    */
+/*    The frame in assembly is returned first, with the data assembled.   */
+/*                                                                        */
+/*    It's called after the isoch transfers are aborted.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (ux_host_class_video_frame_callback)  Frame callback                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Video Class                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+VOID  _ux_host_class_video_frame_buffers_flush(UX_HOST_CLASS_VIDEO *video)
+{
+
+UX_INTERRUPT_SAVE_AREA
+
+UX_HOST_CLASS_VIDEO_FRAME_BUFFER    *frame_buffer;
+UX_HOST_CLASS_VIDEO_FRAME_BUFFER    *next_frame_buffer;
+
+
+    /* Detach the frame buffers.  */
+    UX_DISABLE
+    frame_buffer =  video -> ux_host_class_video_frame_buffer_current;
+    if (frame_buffer != UX_NULL)
+        frame_buffer -> ux_host_class_video_frame_buffer_next =  video -> ux_host_class_video_frame_buffer_head;
+    else
+        frame_buffer =  video -> ux_host_class_video_frame_buffer_head;
+    video -> ux_host_class_video_frame_buffer_current =  UX_NULL;
+    video -> ux_host_class_video_frame_buffer_head =     UX_NULL;
+    video -> ux_host_class_video_frame_buffer_tail =     UX_NULL;
+
+    /* Next stream starts with a new frame.  */
+    video -> ux_host_class_video_frame_fid =   UX_HOST_CLASS_VIDEO_FRAME_FID_NONE;
+    video -> ux_host_class_video_frame_drop =  UX_TRUE;
+    UX_RESTORE
+
+    /* Return them to application.  */
+    while (frame_buffer != UX_NULL)
+    {
+        next_frame_buffer =  frame_buffer -> ux_host_class_video_frame_buffer_next;
+        frame_buffer -> ux_host_class_video_frame_buffer_next =  UX_NULL;
+        frame_buffer -> ux_host_class_video_frame_buffer_status |= UX_HOST_CLASS_VIDEO_FRAME_BUFFER_ABORTED;
+        if (video -> ux_host_class_video_frame_callback != UX_NULL)
+            video -> ux_host_class_video_frame_callback(video, frame_buffer);
+        frame_buffer =  next_frame_buffer;
+    }
+}
+#endif
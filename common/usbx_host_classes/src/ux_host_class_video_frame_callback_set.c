@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Video Class                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_host_class_video.h"
+#include "ux_host_stack.h"
+
+
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_host_class_video_frame_callback_set             PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the frame callback and enables frame assembly.   */
+/*                                                                        */
+/*    With frame assembly, the payloads of the isoch transfers added by   */
+/*    ux_host_class_video_transfer_buffer(s)_add are assembled into the   */
+/*    frame buffers added by ux_host_class_video_frame_buffer_add: the    */
+/*    payload headers are stripped and whole frames are passed to the     */
+/*    callback, with PTS/SCR and status. The transfer callback is still   */
+/*    invoked after, to add the transfer buffer again.                    */
+/*                                                                        */
+/*    The callback is invoked in transfer completion context, it gets     */
+/*    the frame buffer back and it can add it again once consumed.        */
+/*                                                                        */
+/*    It should be set while the video is not streaming. Setting it to    */
+/*    UX_NULL disables frame assembly, the frame buffers owned by the     */
+/*    class are returned to the previous callback.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*    callback_function                     Frame callback function       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_class_video_frame_buffers_flush                            */
+/*                                          Return frame buffers          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_host_class_video_frame_callback_set(UX_HOST_CLASS_VIDEO *video,
+                        VOID (*callback_function)(UX_HOST_CLASS_VIDEO *, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *))
+{
+
+    /* Return frame buffers owned and reset assembly state.  */
+    _ux_host_class_video_frame_buffers_flush(video);
+
+    /* Save the callback function in the video instance.  */
+    video -> ux_host_class_video_frame_callback =  callback_function;
+    video -> ux_host_class_video_frames_dropped =  0;
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _uxe_host_class_video_frame_callback_set            PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks errors in video frame callback set function    */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    video                                 Pointer to video class        */
+/*    callback_function                     Frame callback function       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_host_class_video_frame_callback_set                             */
+/*                                          Set frame callback            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _uxe_host_class_video_frame_callback_set(UX_HOST_CLASS_VIDEO *video,
+                        VOID (*callback_function)(UX_HOST_CLASS_VIDEO *, UX_HOST_CLASS_VIDEO_FRAME_BUFFER *))
+{
+
+    /* Sanity checks.  */
+    if (video == UX_NULL)
+        return(UX_INVALID_PARAMETER);
+
+    /* Call the actual video frame callback set function.  */
+    return(_ux_host_class_video_frame_callback_set(video, callback_function));
+}
+#endif
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_video_stop                           PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -54,6 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _ux_host_class_video_frame_buffers_flush                            */
+/*                                          Return frame buffers          */
 /*    _ux_host_stack_endpoint_transfer_abort                              */
 /*                                          Abort outstanding transfer    */
 /*    _ux_host_stack_interface_setting_select                             */
@@ -82,6 +84,9 @@
 /*                                            fixed parameter/variable    */
 /*                                            names conflict C++ keyword, */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            returned frame buffers,     */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_host_class_video_stop(UX_HOST_CLASS_VIDEO *video)
@@ -107,6 +112,12 @@ UINT                    streaming_interface;
         _ux_host_stack_endpoint_transfer_abort(video -> ux_host_class_video_isochronous_endpoint);
     }
 
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+
+    /* Return frame buffers to application.  */
+    _ux_host_class_video_frame_buffers_flush(video);
+#endif
+
     /* We found the alternate setting for the sampling values demanded, now we need
         to search its container.  */
     configuration =        video -> ux_host_class_video_streaming_interface -> ux_interface_configuration;
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_host_class_video_transfer_request_callback      PORTABLE C      */
-/*                                                           6.1.12       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -55,6 +55,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _ux_host_class_video_frame_assemble   Assemble payload to frame     */
 /*    (ux_host_class_video_transfer_completion_function)                  */
 /*                                          Transfer request completion   */
 /*                                                                        */
@@ -72,6 +73,9 @@
 /*  07-29-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            checked pending state,      */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added frame assembly,       */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_host_class_video_transfer_request_callback(UX_TRANSFER *transfer_request)
@@ -103,6 +107,13 @@ ULONG               transfer_index;
     /* Update the transfer index.  */
     video -> ux_host_class_video_transfer_request_end_index = transfer_index;
 
+#if defined(UX_HOST_CLASS_VIDEO_FRAME_ASSEMBLY_SUPPORT)
+
+    /* Assemble the payload into frame buffers.  */
+    if (video -> ux_host_class_video_frame_callback)
+        _ux_host_class_video_frame_assemble(video, transfer_request);
+#endif
+
     /* Call the completion routine.  */
     if (video -> ux_host_class_video_transfer_completion_function)
         video -> ux_host_class_video_transfer_completion_function(transfer_request);
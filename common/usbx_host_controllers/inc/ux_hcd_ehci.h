@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */ 
 /*                                                                        */ 
 /*    ux_hcd_ehci.h                                       PORTABLE C      */ 
-/*                                                           6.1.8        */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -55,6 +55,10 @@
 /*                                            added extern "C" keyword    */
 /*                                            for compatibility with C++, */
 /*                                            resulting in version 6.1.8  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added TD and ED free lists, */
+/*                                            added pending ED bitmap,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -371,6 +375,11 @@ typedef struct UX_HCD_EHCI_STRUCT
                     *ux_hcd_ehci_iso_done_transfer_tail;
     struct UX_EHCI_ED_STRUCT
                     *ux_hcd_ehci_interrupt_ed_list;
+    struct UX_EHCI_ED_STRUCT
+                    *ux_hcd_ehci_ed_free_list;
+    struct UX_EHCI_TD_STRUCT
+                    *ux_hcd_ehci_td_free_list;
+    ULONG           *ux_hcd_ehci_ed_pending;
     UX_MUTEX        ux_hcd_ehci_periodic_mutex;
     UX_SEMAPHORE    ux_hcd_ehci_protect_semaphore;
     UX_SEMAPHORE    ux_hcd_ehci_doorbell_semaphore;
@@ -425,6 +434,10 @@ typedef struct UX_EHCI_ED_STRUCT
             struct UX_ENDPOINT_STRUCT
                         *ux_ehci_ed_endpoint;               /* + 1 Dword.  */
         } INTR;
+        struct {                                            /* As free ED.  */
+            struct UX_EHCI_ED_STRUCT
+                        *ux_ehci_ed_next_free;              /* + 1 DWord.  */
+        } IDLE;
         struct {                                            /* Space: 7 DWord.  */
             ULONG       ux_ehci_ed_reserved[7];
         } RESERVED;
@@ -443,6 +456,7 @@ typedef struct UX_EHCI_ED_STRUCT
 #define UX_EHCI_QH_T                                        1u
 
 #define UX_EHCI_QH_STATIC                                   0x80000000u
+#define UX_EHCI_QH_INTERRUPT                                0x00010000u
 #define UX_EHCI_QH_SSPLIT_SCH_FULL_7                        0x40000000u
 #define UX_EHCI_QH_SSPLIT_SCH_FULL_6                        0x20000000u
 #define UX_EHCI_QH_SSPLIT_SCH_FULL_5                        0x10000000u
@@ -487,6 +501,10 @@ typedef struct UX_EHCI_ED_STRUCT
 #define UX_EHCI_TOGGLE_0                                    0u
 #define UX_EHCI_TOGGLE_1                                    0x80000000u
 
+/* Define the number of ULONGs in the pending ED bitmap, one bit per ED.  */
+
+#define UX_EHCI_ED_PENDING_MAP_SIZE(n)                      (((n) + 31u) >> 5)
+
 /* Define EHCI TD structure.  */
 
 typedef struct UX_EHCI_TD_STRUCT
@@ -512,7 +530,9 @@ typedef struct UX_EHCI_TD_STRUCT
     ULONG           ux_ehci_td_length;
     ULONG           ux_ehci_td_status;
     ULONG           ux_ehci_td_phase;
-    ULONG           ux_ehci_td_reserved_2[2];
+    struct UX_EHCI_TD_STRUCT
+                    *ux_ehci_td_next_free;
+    ULONG           ux_ehci_td_reserved_2;
     /* 16-DWord aligned.  */
 } UX_EHCI_TD;
 
@@ -792,7 +812,7 @@ typedef struct UX_EHCI_FSISO_TD_STRUCT
 /* Define EHCI function prototypes.  */
 
 void _ux_hcd_ehci_periodic_descriptor_link(VOID* prev, VOID* prev_next, VOID* next_prev, VOID* next);
-UX_EHCI_TD          *_ux_hcd_ehci_asynch_td_process(UX_EHCI_ED *ed, UX_EHCI_TD *td);
+UX_EHCI_TD          *_ux_hcd_ehci_asynch_td_process(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed, UX_EHCI_TD *td);
 UX_EHCI_HSISO_TD    *_ux_hcd_ehci_hsisochronous_tds_process(UX_HCD_EHCI *hcd_ehci, UX_EHCI_HSISO_TD* itd);
 UX_EHCI_FSISO_TD    *_ux_hcd_ehci_fsisochronous_tds_process(UX_HCD_EHCI *hcd_ehci, UX_EHCI_FSISO_TD* sitd);
 UINT    _ux_hcd_ehci_asynchronous_endpoint_create(UX_HCD_EHCI *hcd_ehci, UX_ENDPOINT *endpoint);
@@ -800,7 +820,8 @@ UINT    _ux_hcd_ehci_asynchronous_endpoint_destroy(UX_HCD_EHCI *hcd_ehci, UX_END
 UINT    _ux_hcd_ehci_controller_disable(UX_HCD_EHCI *hcd_ehci);
 VOID    _ux_hcd_ehci_done_queue_process(UX_HCD_EHCI *hcd_ehci);
 VOID    _ux_hcd_ehci_door_bell_wait(UX_HCD_EHCI *hcd_ehci);
-UINT    _ux_hcd_ehci_ed_clean(UX_EHCI_ED *ed);
+UINT    _ux_hcd_ehci_ed_clean(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed);
+VOID    _ux_hcd_ehci_ed_free(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed);
 UX_EHCI_ED          *_ux_hcd_ehci_ed_obtain(UX_HCD_EHCI *hcd_ehci);
 UINT    _ux_hcd_ehci_endpoint_reset(UX_HCD_EHCI *hcd_ehci, UX_ENDPOINT *endpoint);
 UINT    _ux_hcd_ehci_entry(UX_HCD *hcd, UINT function, VOID *parameter);
@@ -828,7 +849,10 @@ UINT    _ux_hcd_ehci_power_on_port(UX_HCD_EHCI *hcd_ehci, ULONG port_index);
 VOID    _ux_hcd_ehci_power_root_hubs(UX_HCD_EHCI *hcd_ehci);
 ULONG   _ux_hcd_ehci_register_read(UX_HCD_EHCI *hcd_ehci, ULONG ehci_register);
 VOID    _ux_hcd_ehci_register_write(UX_HCD_EHCI *hcd_ehci, ULONG ehci_register, ULONG value);
+VOID    _ux_hcd_ehci_regular_td_free(UX_HCD_EHCI *hcd_ehci, UX_EHCI_TD *td);
 UX_EHCI_TD          *_ux_hcd_ehci_regular_td_obtain(UX_HCD_EHCI *hcd_ehci);
+UINT    _ux_hcd_ehci_request_bulk_tds_add(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed, UX_TRANSFER *transfer_request,
+                                    UCHAR *data_pointer, ULONG payload_length);
 UINT    _ux_hcd_ehci_request_bulk_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *transfer_request);
 UINT    _ux_hcd_ehci_request_control_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *transfer_request);
 UINT    _ux_hcd_ehci_request_interrupt_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *transfer_request);
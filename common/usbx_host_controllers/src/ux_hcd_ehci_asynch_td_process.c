@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_asynch_td_process                      PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -48,6 +48,7 @@
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
+/*    hcd_ehci                              Pointer to EHCI controller    */ 
 /*    ed                                    Pointer to ED                 */ 
 /*    td                                    Pointer to TD                 */ 
 /*                                                                        */ 
@@ -59,6 +60,7 @@
 /*                                                                        */ 
 /*    (ux_transfer_request_completion_function) Completion function       */ 
 /*    _ux_hcd_ehci_ed_clean                 Clean ED                      */ 
+/*    _ux_hcd_ehci_regular_td_free          Free TD                       */
 /*    _ux_host_semaphore_put                Put semaphore                 */ 
 /*    _ux_utility_virtual_address           Get virtual address           */ 
 /*                                                                        */ 
@@ -76,9 +78,12 @@
 /*  01-31-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            refined macros names,       */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
-UX_EHCI_TD  *_ux_hcd_ehci_asynch_td_process(UX_EHCI_ED *ed, UX_EHCI_TD *td)
+UX_EHCI_TD  *_ux_hcd_ehci_asynch_td_process(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed, UX_EHCI_TD *td)
 {
 
 UX_TRANSFER     *transfer_request;
@@ -131,10 +136,10 @@ ULONG           pid;
         transfer_request -> ux_transfer_request_completion_code =  td_error;
         
         /* Clean the link.  */
-        _ux_hcd_ehci_ed_clean(ed);
+        _ux_hcd_ehci_ed_clean(hcd_ehci, ed);
 
         /* Free the TD that was just treated.  */
-        td -> ux_ehci_td_status =  UX_UNUSED;
+        _ux_hcd_ehci_regular_td_free(hcd_ehci, td);
 
         /* We may do a call back.  */
         if (transfer_request -> ux_transfer_request_completion_function != UX_NULL)
@@ -179,10 +184,10 @@ ULONG           pid;
             transfer_request -> ux_transfer_request_completion_code =  UX_SUCCESS;
         
             /* Clean the link.  */
-            _ux_hcd_ehci_ed_clean(ed);
+            _ux_hcd_ehci_ed_clean(hcd_ehci, ed);
 
             /* Free the TD that was just treated.  */
-            td -> ux_ehci_td_status =  UX_UNUSED;
+            _ux_hcd_ehci_regular_td_free(hcd_ehci, td);
 
             /* We may do a call back.  */
             if (transfer_request -> ux_transfer_request_completion_function != UX_NULL)
@@ -202,7 +207,7 @@ ULONG           pid;
     next_td =  _ux_utility_virtual_address((VOID *) td_element);
     
     /* Free the TD that was just treated.  */
-    td -> ux_ehci_td_status =  UX_UNUSED;
+    _ux_hcd_ehci_regular_td_free(hcd_ehci, td);
 
     /* This TD is now the first TD.  */
     ed -> ux_ehci_ed_first_td = next_td;
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_asynchronous_endpoint_destroy          PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -57,6 +57,7 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_door_bell_wait           Wait for door bell            */ 
+/*    _ux_hcd_ehci_ed_free                  Free ED                       */
 /*    _ux_utility_physical_address          Get physical address          */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -70,6 +71,9 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_asynchronous_endpoint_destroy(UX_HCD_EHCI *hcd_ehci, UX_ENDPOINT *endpoint)
@@ -109,7 +113,7 @@ UX_EHCI_LINK_POINTER    queue_head;
     _ux_hcd_ehci_door_bell_wait(hcd_ehci);
         
     /* Now we can safely make the ED free.  */
-    ed -> ux_ehci_ed_status =  UX_UNUSED;
+    _ux_hcd_ehci_ed_free(hcd_ehci, ed);
 
     /* Return successful completion.  */
     return(UX_SUCCESS);        
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_hcd_ehci_done_queue_process                     PORTABLE C      */
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -46,6 +46,10 @@
 /*    lists in search for transfers that occurred in the past             */
 /*    (micro-)frame.                                                      */
 /*                                                                        */
+/*    Only the interrupt and asynchronous EDs marked in the pending ED    */
+/*    bitmap, i.e. with TDs attached, are looked at. As in the periodic   */
+/*    list scan, the periodic mutex is held for interrupt EDs only.       */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    hcd_ehci                              Pointer to EHCI controller    */
@@ -63,7 +67,8 @@
 /*    _ux_hcd_ehci_fsisochronous_tds_process                              */
 /*                                          Process full speed (split)    */
 /*                                          isochronous TDs               */
-/*    _ux_utility_virtual_address           Get virtual address           */
+/*    _ux_host_mutex_on                     Get mutex                     */
+/*    _ux_host_mutex_off                    Put mutex                     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -82,14 +87,23 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            fixed standalone compile,   */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            processed pending EDs only, */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 VOID  _ux_hcd_ehci_done_queue_process(UX_HCD_EHCI *hcd_ehci)
 {
 
+UX_INTERRUPT_SAVE_AREA
+
 UX_EHCI_TD                      *td;
-UX_EHCI_PERIODIC_LINK_POINTER   ed;
-UX_EHCI_ED                      *start_ed;
+UX_EHCI_ED                      *ed;
+ULONG                           map_size;
+ULONG                           map_index;
+ULONG                           pending;
+ULONG                           bit;
+UINT                            periodic;
 
 
 #if UX_MAX_ISO_TD
@@ -122,54 +136,78 @@ UX_EHCI_PERIODIC_LINK_POINTER   lp;
 #endif
 #endif
 
-    /* We scan the linked interrupt list then.  */
-    _ux_host_mutex_on(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
-    ed.ed_ptr = hcd_ehci -> ux_hcd_ehci_interrupt_ed_list;
-    while(ed.ed_ptr != UX_NULL)
-    {
-
-        /* Retrieve the fist TD attached to this ED.  */
-        td =  ed.ed_ptr -> ux_ehci_ed_first_td;
-
-        /* Process TD until there is no next available.  */
-        while (td != UX_NULL)
-            td =  _ux_hcd_ehci_asynch_td_process(ed.ed_ptr, td);
-        
-        /* Next ED.  */
-        ed.ed_ptr = ed.ed_ptr -> ux_ehci_ed_next_ed;
-    }
-    _ux_host_mutex_off(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
-
-    /* Now we can parse the asynchronous list. The head ED is always empty and
-       used as an anchor only.  */
-    start_ed =  hcd_ehci -> ux_hcd_ehci_asynch_head_list;
-
-    /* Point to the next ED in the asynchronous tree.  */
-    ed.ed_ptr = start_ed -> ux_ehci_ed_queue_head;
-    ed.value &= UX_EHCI_LINK_ADDRESS_MASK;
-
-    /* Obtain the virtual address from the element.  */
-    ed.void_ptr = _ux_utility_virtual_address(ed.void_ptr);
-
-    /* Now traverse this list until we have found a non anchor endpoint that
-       has transfers done.  */
-    while (ed.ed_ptr != start_ed)
+    /* We scan the EDs that have transfers pending then. The interrupt and
+       asynchronous EDs are both found through the pending ED bitmap, so
+       EDs without transfers are skipped 32 at a time.  */
+    map_size =  UX_EHCI_ED_PENDING_MAP_SIZE(_ux_system_host -> ux_system_host_max_ed);
+    for (map_index = 0; map_index < map_size; map_index ++)
     {
 
-        /* Retrieve the fist TD attached to this ED.  */
-        td =  ed.ed_ptr -> ux_ehci_ed_first_td;
-        while (td != UX_NULL)
+        /* Get the EDs pending in this part of the map.  */
+        pending =  hcd_ehci -> ux_hcd_ehci_ed_pending[map_index];
+        ed =  &hcd_ehci -> ux_hcd_ehci_ed_list[map_index << 5];
+        for (bit = 1; pending != 0; bit <<= 1, ed ++)
         {
 
-            td =  _ux_hcd_ehci_asynch_td_process(ed.ed_ptr, td);
+            /* Check if this ED is pending.  */
+            if ((pending & bit) == 0)
+                continue;
+            pending &=  ~bit;
+
+            /* The map was read without protection, check the ED is still
+               pending and get its kind from the ED itself.  */
+            UX_DISABLE
+            if ((hcd_ehci -> ux_hcd_ehci_ed_pending[map_index] & bit) == 0)
+            {
+                UX_RESTORE
+                continue;
+            }
+            periodic =  (ed -> ux_ehci_ed_status & UX_EHCI_QH_INTERRUPT) ? UX_TRUE : UX_FALSE;
+            UX_RESTORE
+
+            /* Interrupt EDs are protected against periodic endpoint destroy,
+               asynchronous EDs are processed without the periodic mutex.  */
+            if (periodic)
+            {
+                _ux_host_mutex_on(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
+
+                /* The ED may have been destroyed, or even reused, while
+                   waiting.  */
+                UX_DISABLE
+                if ((hcd_ehci -> ux_hcd_ehci_ed_pending[map_index] & bit) == 0)
+                {
+                    UX_RESTORE
+                    _ux_host_mutex_off(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
+                    continue;
+                }
+                if ((ed -> ux_ehci_ed_status & UX_EHCI_QH_INTERRUPT) == 0)
+                {
+
+                    /* Reused as asynchronous ED, no mutex needed.  */
+                    periodic =  UX_FALSE;
+                }
+                UX_RESTORE
+                if (!periodic)
+                    _ux_host_mutex_off(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
+            }
+
+            /* Retrieve the fist TD attached to this ED.  */
+            td =  ed -> ux_ehci_ed_first_td;
+
+            /* Process TD until there is no next available.  */
+            while (td != UX_NULL)
+                td =  _ux_hcd_ehci_asynch_td_process(hcd_ehci, ed, td);
+
+            /* If all transfers are done the ED is no longer pending. A new
+               transfer may have been added by the completion callback.  */
+            UX_DISABLE
+            if (ed -> ux_ehci_ed_first_td == UX_NULL)
+                hcd_ehci -> ux_hcd_ehci_ed_pending[map_index] &=  ~bit;
+            UX_RESTORE
+
+            if (periodic)
+                _ux_host_mutex_off(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
         }
-
-        /* Point to the next ED in the asynchronous tree.  */
-        ed.ed_ptr = ed.ed_ptr -> ux_ehci_ed_queue_head;
-        ed.value &= UX_EHCI_LINK_ADDRESS_MASK;
-
-        /* Obtain the virtual address from the element.  */
-        ed.void_ptr = _ux_utility_virtual_address(ed.void_ptr);
     }
 }
 
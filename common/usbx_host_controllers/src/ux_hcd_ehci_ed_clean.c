@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_ed_clean                               PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -47,6 +47,7 @@
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
+/*    hcd_ehci                              Pointer to EHCI controller    */ 
 /*    ed                                    Pointer to ED                 */ 
 /*                                                                        */ 
 /*  OUTPUT                                                                */ 
@@ -55,6 +56,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _ux_hcd_ehci_regular_td_free          Free TD                       */
 /*    _ux_utility_virtual_address           Get virtual address           */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -68,9 +70,12 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
-UINT  _ux_hcd_ehci_ed_clean(UX_EHCI_ED *ed)
+UINT  _ux_hcd_ehci_ed_clean(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed)
 {
 
 UX_EHCI_TD      *td;
@@ -95,7 +100,7 @@ UX_EHCI_TD      *next_td;
         next_td =  _ux_utility_virtual_address(next_td);
 
         /* Mark the current TD as free.  */
-        td -> ux_ehci_td_status =  UX_UNUSED;
+        _ux_hcd_ehci_regular_td_free(hcd_ehci, td);
 
         td =  next_td;
     }
@@ -35,14 +35,14 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_ed_obtain                              PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */ 
-/*    This function obtains a free ED from the ED list.                   */ 
+/*    This function obtains a free ED from the ED free list.              */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -69,43 +69,46 @@
 /*                                            verified memset and memcpy  */
 /*                                            cases,                      */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UX_EHCI_ED  *_ux_hcd_ehci_ed_obtain(UX_HCD_EHCI *hcd_ehci)
 {
 
+UX_INTERRUPT_SAVE_AREA
+
 UX_EHCI_ED      *ed;
-ULONG           ed_index;
 
 
-    /* Start the search from the beginning of the list.  */
-    ed =  hcd_ehci -> ux_hcd_ehci_ed_list;
-    for (ed_index = 0; ed_index < _ux_system_host -> ux_system_host_max_ed; ed_index++)
+    /* Protect the free list.  */
+    UX_DISABLE
+
+    /* Take the ED at the head of the free list.  */
+    ed =  hcd_ehci -> ux_hcd_ehci_ed_free_list;
+    if (ed == UX_NULL)
     {
 
-        /* Check the ED status, a free ED is marked with the UNUSED flag.  */
-        if (ed -> ux_ehci_ed_status == UX_UNUSED)
-        {
+        /* There is no available ED in the ED list.  */
+        UX_RESTORE
+        return(UX_NULL);
+    }
+    hcd_ehci -> ux_hcd_ehci_ed_free_list =  ed -> REF_AS.IDLE.ux_ehci_ed_next_free;
 
-            /* The ED may have been used, so we reset all fields.  */
-            _ux_utility_memory_set(ed, 0, sizeof(UX_EHCI_ED)); /* Use case of memset is verified. */
+    /* Restore interrupts.  */
+    UX_RESTORE
 
-            /* This ED is now marked as USED.  */
-            ed -> ux_ehci_ed_status =  UX_USED;
+    /* The ED may have been used, so we reset all fields.  */
+    _ux_utility_memory_set(ed, 0, sizeof(UX_EHCI_ED)); /* Use case of memset is verified. */
 
-            /* We initialize the type of ED and mark its TD terminator to be safe.  */
-            ed -> ux_ehci_ed_queue_head =     (UX_EHCI_ED *) UX_EHCI_QH_TYP_QH;               
-            ed -> ux_ehci_ed_queue_element =  (UX_EHCI_TD *) UX_EHCI_TD_T;
-            
-            /* Success, return ED pointer.  */
-            return(ed);
-        }
+    /* This ED is now marked as USED.  */
+    ed -> ux_ehci_ed_status =  UX_USED;
 
-        /* Point to the next ED.  */
-        ed++;
-    }
+    /* We initialize the type of ED and mark its TD terminator to be safe.  */
+    ed -> ux_ehci_ed_queue_head =     (UX_EHCI_ED *) UX_EHCI_QH_TYP_QH;
+    ed -> ux_ehci_ed_queue_element =  (UX_EHCI_TD *) UX_EHCI_TD_T;
 
-    /* There is no available ED in the ED list.  */
-    return(UX_NULL);
+    /* Success, return ED pointer.  */
+    return(ed);
 }
-
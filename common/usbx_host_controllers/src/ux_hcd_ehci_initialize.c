@@ -60,7 +60,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _ux_hcd_ehci_initialize                             PORTABLE C      */
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -117,6 +117,11 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            fixed standalone compile,   */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added TD and ED free lists, */
+/*                                            added pending ED bitmap,    */
+/*                                            added transfer segments,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_initialize(UX_HCD *hcd)
@@ -128,9 +133,11 @@ UINT  _ux_hcd_ehci_initialize(UX_HCD *hcd)
 
 UX_HCD_EHCI             *hcd_ehci;
 UX_EHCI_ED              *ed;
+UX_EHCI_TD              *td;
 UX_EHCI_LINK_POINTER    lp;
 ULONG                   ehci_register;
 ULONG                   port_index;
+ULONG                   index;
 UINT                    status = UX_SUCCESS;
 
 
@@ -143,6 +150,12 @@ UINT                    status = UX_SUCCESS;
     hcd -> ux_hcd_available_bandwidth =  UX_EHCI_AVAILABLE_BANDWIDTH;
 #endif
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+    /* EHCI builds bulk OUT transfer segments.  */
+    hcd -> ux_hcd_capabilities |=  UX_HCD_CAPABILITY_TRANSFER_SEGMENTS;
+#endif
+
     /* Allocate memory for this EHCI HCD instance.  */
     hcd_ehci =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_HCD_EHCI));
     if (hcd_ehci == UX_NULL)
@@ -226,6 +239,31 @@ UINT                    status = UX_SUCCESS;
             status = (UX_MEMORY_INSUFFICIENT);
     }
 
+    /* Allocate the bitmap of EDs that have transfers pending.  */
+    if (status == UX_SUCCESS)
+    {
+        hcd_ehci -> ux_hcd_ehci_ed_pending =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(ULONG) * UX_EHCI_ED_PENDING_MAP_SIZE(_ux_system_host -> ux_system_host_max_ed));
+        if (hcd_ehci -> ux_hcd_ehci_ed_pending == UX_NULL)
+            status = (UX_MEMORY_INSUFFICIENT);
+    }
+
+    /* Link all the eds and tds in their free lists.  */
+    if (status == UX_SUCCESS)
+    {
+        for (index = _ux_system_host -> ux_system_host_max_ed; index > 0; index --)
+        {
+            ed =  &hcd_ehci -> ux_hcd_ehci_ed_list[index - 1];
+            ed -> REF_AS.IDLE.ux_ehci_ed_next_free =  hcd_ehci -> ux_hcd_ehci_ed_free_list;
+            hcd_ehci -> ux_hcd_ehci_ed_free_list =  ed;
+        }
+        for (index = _ux_system_host -> ux_system_host_max_td; index > 0; index --)
+        {
+            td =  &hcd_ehci -> ux_hcd_ehci_td_list[index - 1];
+            td -> ux_ehci_td_next_free =  hcd_ehci -> ux_hcd_ehci_td_free_list;
+            hcd_ehci -> ux_hcd_ehci_td_free_list =  td;
+        }
+    }
+
 #if UX_MAX_ISO_TD == 0 || !defined(UX_HCD_EHCI_SPLIT_TRANSFER_ENABLE)
     hcd_ehci -> ux_hcd_ehci_fsiso_td_list = UX_NULL;
 #else
@@ -418,6 +456,8 @@ UINT                    status = UX_SUCCESS;
         _ux_utility_memory_free(hcd_ehci -> ux_hcd_ehci_ed_list);
     if (hcd_ehci -> ux_hcd_ehci_td_list)
         _ux_utility_memory_free(hcd_ehci -> ux_hcd_ehci_td_list);
+    if (hcd_ehci -> ux_hcd_ehci_ed_pending)
+        _ux_utility_memory_free(hcd_ehci -> ux_hcd_ehci_ed_pending);
 #if UX_MAX_ISO_TD && defined(UX_HCD_EHCI_SPLIT_TRANSFER_ENABLE)
     if (hcd_ehci -> ux_hcd_ehci_fsiso_td_list)
         _ux_utility_memory_free(hcd_ehci -> ux_hcd_ehci_fsiso_td_list);
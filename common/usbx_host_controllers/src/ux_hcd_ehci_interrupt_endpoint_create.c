@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_interrupt_endpoint_create              PORTABLE C      */ 
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -73,6 +73,7 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_ed_obtain                Obtain an ED                  */ 
+/*    _ux_hcd_ehci_ed_free                  Free ED                       */
 /*    _ux_hcd_ehci_least_traffic_list_get   Get least traffic list        */ 
 /*    _ux_hcd_ehci_poll_rate_entry_get      Get anchor for poll rate      */
 /*    _ux_utility_physical_address          Get physical address          */ 
@@ -104,6 +105,10 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            fixed standalone compile,   */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            marked interrupt ED,        */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_interrupt_endpoint_create(UX_HCD_EHCI *hcd_ehci, UX_ENDPOINT *endpoint)
@@ -155,6 +160,10 @@ UINT                            i;
     /* Now do the opposite, attach the ED container to the physical ED.  */
     ed -> REF_AS.INTR.ux_ehci_ed_endpoint =  endpoint;
 
+    /* Mark the ED as interrupt ED, the done queue tells EDs apart without
+       going through the endpoint.  */
+    ed -> ux_ehci_ed_status |=  UX_EHCI_QH_INTERRUPT;
+
     /* Set the default MPS Capability info in the ED.  */
     max_packet_size = endpoint -> ux_endpoint_descriptor.wMaxPacketSize & UX_MAX_PACKET_SIZE_MASK;
     ed -> ux_ehci_ed_cap0 =  max_packet_size << UX_EHCI_QH_MPS_LOC;
@@ -296,7 +305,7 @@ UINT                            i;
     if (i >= interval)
     {
         _ux_host_mutex_off(&hcd_ehci -> ux_hcd_ehci_periodic_mutex);
-        ed -> ux_ehci_ed_status = UX_UNUSED;
+        _ux_hcd_ehci_ed_free(hcd_ehci, ed);
         return(UX_NO_BANDWIDTH_AVAILABLE);
     }
 
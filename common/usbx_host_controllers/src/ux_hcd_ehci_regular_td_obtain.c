@@ -35,14 +35,14 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_regular_td_obtain                      PORTABLE C      */ 
-/*                                                           6.1.11       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */ 
-/*     This function obtains a free TD from the regular TD list.          */ 
+/*     This function obtains a free TD from the regular TD free list.     */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -55,8 +55,6 @@
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _ux_utility_memory_set                Set memory block              */ 
-/*    _ux_host_mutex_on                     Get protection mutex          */
-/*    _ux_host_mutex_off                    Release protection mutex      */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -74,56 +72,50 @@
 /*  04-25-2022     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            fixed standalone compile,   */
 /*                                            resulting in version 6.1.11 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UX_EHCI_TD  *_ux_hcd_ehci_regular_td_obtain(UX_HCD_EHCI *hcd_ehci)
 {
 
+UX_INTERRUPT_SAVE_AREA
+
 UX_EHCI_TD      *td;
-ULONG           td_index;
 ULONG           td_element;
 
 
-    /* Get the mutex as this is a critical section.  */
-    _ux_host_mutex_on(&_ux_system -> ux_system_mutex);
+    /* Protect the free list, TDs are freed by the done queue process.  */
+    UX_DISABLE
 
-    /* Start the search from the beginning of the list.  */
-    td =  hcd_ehci -> ux_hcd_ehci_td_list;
-    for (td_index = 0; td_index < _ux_system_host -> ux_system_host_max_td; td_index++)
+    /* Take the TD at the head of the free list.  */
+    td =  hcd_ehci -> ux_hcd_ehci_td_free_list;
+    if (td == UX_NULL)
     {
 
-        /* Check the TD status, a free TD is marked with the USED flag.  */
-        if (td -> ux_ehci_td_status == UX_UNUSED)
-        {
-
-            /* The TD may have been used, so we reset all fields.  */
-            _ux_utility_memory_set(td, 0, sizeof(UX_EHCI_TD)); /* Use case of memset is verified. */
-
-            /* This TD is now marked as USED.  */
-            td -> ux_ehci_td_status =  UX_USED;
+        /* There is no available TD in the TD list.  */
+        UX_RESTORE
 
-            /* Initialize the link pointer and alternate TD fields.  */
-            td_element =  UX_EHCI_TD_T;
-            td -> ux_ehci_td_link_pointer =  (UX_EHCI_TD *) td_element;
-            td -> ux_ehci_td_alternate_link_pointer =  (UX_EHCI_TD *) td_element;
-            
-            /* Release the protection.  */
-            _ux_host_mutex_off(&_ux_system -> ux_system_mutex);
+        /* Error, return a null.  */
+        return(UX_NULL);
+    }
+    hcd_ehci -> ux_hcd_ehci_td_free_list =  td -> ux_ehci_td_next_free;
 
-            /* Success, return TD pointer.  */
-            return(td);
-        }
+    /* Restore interrupts.  */
+    UX_RESTORE
 
-        /* Look at next TD.  */
-        td++;
-    }
+    /* The TD may have been used, so we reset all fields.  */
+    _ux_utility_memory_set(td, 0, sizeof(UX_EHCI_TD)); /* Use case of memset is verified. */
 
-    /* There is no available TD in the TD list.  */
+    /* This TD is now marked as USED.  */
+    td -> ux_ehci_td_status =  UX_USED;
 
-    /* Release protection.  */
-    _ux_host_mutex_off(&_ux_system -> ux_system_mutex);
+    /* Initialize the link pointer and alternate TD fields.  */
+    td_element =  UX_EHCI_TD_T;
+    td -> ux_ehci_td_link_pointer =  (UX_EHCI_TD *) td_element;
+    td -> ux_ehci_td_alternate_link_pointer =  (UX_EHCI_TD *) td_element;
 
-    /* Error, return a null.  */
-    return(UX_NULL);
+    /* Success, return TD pointer.  */
+    return(td);
 }
-
@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   EHCI Controller Driver                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/* Include necessary system files.  */
+
+#define UX_SOURCE_CODE
+
+#include "ux_api.h"
+#include "ux_hcd_ehci.h"
+#include "ux_host_stack.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _ux_hcd_ehci_request_bulk_tds_add                   PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the TDs of a bulk data buffer to the ED. The     */
+/*    buffer may take more than one TD, an EHCI TD payload is 16K max.    */
+/*    An empty buffer takes one TD, for a ZLP.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hcd_ehci                              Pointer to EHCI controller    */
+/*    ed                                    Pointer to ED                 */
+/*    transfer_request                      Pointer to transfer request   */
+/*    data_pointer                          Pointer to data buffer        */
+/*    payload_length                        Length of data buffer         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _ux_hcd_ehci_request_transfer_add     Add transfer to ED            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    EHCI Controller Driver                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+UINT  _ux_hcd_ehci_request_bulk_tds_add(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed, UX_TRANSFER *transfer_request,
+                                        UCHAR *data_pointer, ULONG payload_length)
+{
+
+ULONG           bulk_packet_payload_length;
+ULONG           pid;
+UINT            status;
+ULONG           zlp_flag;
+
+
+    /* Check for ZLP condition.  */
+    if (payload_length == 0)
+        
+        /* We have a zlp condition.  */
+        zlp_flag = UX_TRUE;
+    else
+    
+        /* We do not have a zlp.  */
+        zlp_flag = UX_FALSE;
+                
+    /* Build all necessary TDs.  */
+    while ((payload_length != 0) || zlp_flag == UX_TRUE)
+    {
+
+        /* Reset ZLP now.  */
+        zlp_flag = UX_FALSE;        
+      
+        /* Check if we are exceeding the max payload. */
+        if (payload_length > UX_EHCI_MAX_PAYLOAD)
+            bulk_packet_payload_length =  UX_EHCI_MAX_PAYLOAD;
+        else
+            bulk_packet_payload_length =  payload_length;
+
+        /* Add this transfer request to the ED.  */
+        if ((transfer_request -> ux_transfer_request_type&UX_REQUEST_DIRECTION) == UX_REQUEST_IN)
+            pid =  UX_EHCI_PID_IN;
+        else            
+            pid =  UX_EHCI_PID_OUT;
+
+        status =  _ux_hcd_ehci_request_transfer_add(hcd_ehci, ed, 0, pid, 0,
+                                    data_pointer, bulk_packet_payload_length, transfer_request);
+
+        if (status != UX_SUCCESS)
+            return(status);
+            
+        /* Adjust the data payload length and the data payload pointer.  */
+        payload_length -=  bulk_packet_payload_length;
+        data_pointer +=  bulk_packet_payload_length;
+    }        
+
+    /* Return successful completion.  */
+    return(UX_SUCCESS);
+}
@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_request_bulk_transfer                  PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -47,6 +47,11 @@
 /*     required to chain multiple tds to accommodate this request. A bulk */ 
 /*     transfer is non blocking, so we return before the request is       */
 /*     completed.                                                         */ 
+/*                                                                        */
+/*     With UX_HOST_TRANSFER_SEGMENTS_ENABLE, a bulk OUT request may      */
+/*     give a list of segments. The TDs of each segment are built in      */
+/*     turn so that a segment that is not a multiple of the max packet    */
+/*     size ends with a short packet, and an empty segment is a ZLP.      */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -59,7 +64,7 @@
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    _ux_hcd_ehci_request_transfer_add     Add transfer to ED            */ 
+/*    _ux_hcd_ehci_request_bulk_tds_add     Add bulk data TDs to ED       */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -72,6 +77,9 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            added transfer segments,    */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_request_bulk_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *transfer_request)
@@ -79,13 +87,13 @@ UINT  _ux_hcd_ehci_request_bulk_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *tra
 
 UX_ENDPOINT     *endpoint;
 UX_EHCI_ED      *ed;
-ULONG           transfer_request_payload_length;
-ULONG           bulk_packet_payload_length;
-UCHAR *         data_pointer;
-ULONG           pid;
 ULONG           td_component;
 UINT            status;
-ULONG           zlp_flag;
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+UX_TRANSFER_SEGMENT
+                *segment;
+ULONG           segment_count;
+#endif
 
 
     /* Get the pointer to the Endpoint.  */
@@ -94,6 +102,16 @@ ULONG           zlp_flag;
     /* Now get the physical ED attached to this endpoint.  */
     ed =  endpoint -> ux_endpoint_ed;
 
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+    /* Segments are for bulk OUT only, an IN short packet ends the transfer.  */
+    segment =  transfer_request -> ux_transfer_request_segments;
+    segment_count =  transfer_request -> ux_transfer_request_segment_count;
+    if ((segment_count != 0) &&
+        ((transfer_request -> ux_transfer_request_type & UX_REQUEST_DIRECTION) == UX_REQUEST_IN))
+        return(UX_FUNCTION_NOT_SUPPORTED);
+#endif
+
     /* The overlay parameters should be reset now.  */
     ed -> ux_ehci_ed_current_td =     UX_NULL;
     ed -> ux_ehci_ed_queue_element =  (UX_EHCI_TD *)UX_EHCI_TD_T;
@@ -106,51 +124,23 @@ ULONG           zlp_flag;
     ed -> ux_ehci_ed_bp3 =            UX_NULL;
     ed -> ux_ehci_ed_bp4 =            UX_NULL;
 
-    /* It may take more than one TD if the transfer_request length is more than the
-       maximum length for an EHCI TD (this is irrelevant of the MaxPacketSize value 
-       in the endpoint descriptor). EHCI data payload has a maximum size of 16K.  */
-    transfer_request_payload_length =  transfer_request -> ux_transfer_request_requested_length;
-    data_pointer =  transfer_request -> ux_transfer_request_data_pointer;
-    
-    /* Check for ZLP condition.  */
-    if (transfer_request_payload_length == 0)
-        
-        /* We have a zlp condition.  */
-        zlp_flag = UX_TRUE;
-    else
-    
-        /* We do not have a zlp.  */
-        zlp_flag = UX_FALSE;
-                
-    /* Build all necessary TDs.  */
-    while ((transfer_request_payload_length != 0) || zlp_flag == UX_TRUE)
-    {
-
-        /* Reset ZLP now.  */
-        zlp_flag = UX_FALSE;        
-      
-        /* Check if we are exceeding the max payload. */
-        if (transfer_request_payload_length > UX_EHCI_MAX_PAYLOAD)
-            bulk_packet_payload_length =  UX_EHCI_MAX_PAYLOAD;
-        else
-            bulk_packet_payload_length =  transfer_request_payload_length;
-
-        /* Add this transfer request to the ED.  */
-        if ((transfer_request -> ux_transfer_request_type&UX_REQUEST_DIRECTION) == UX_REQUEST_IN)
-            pid =  UX_EHCI_PID_IN;
-        else            
-            pid =  UX_EHCI_PID_OUT;
-
-        status =  _ux_hcd_ehci_request_transfer_add(hcd_ehci, ed, 0, pid, 0,
-                                    data_pointer, bulk_packet_payload_length, transfer_request);
-
-        if (status != UX_SUCCESS)
-            return(status);
-            
-        /* Adjust the data payload length and the data payload pointer.  */
-        transfer_request_payload_length -=  bulk_packet_payload_length;
-        data_pointer +=  bulk_packet_payload_length;
-    }        
+#if defined(UX_HOST_TRANSFER_SEGMENTS_ENABLE)
+
+    /* With segments, the TDs are built segment by segment.  */
+    status =  UX_SUCCESS;
+    for (; (segment_count != 0) && (status == UX_SUCCESS); segment_count --, segment ++)
+        status =  _ux_hcd_ehci_request_bulk_tds_add(hcd_ehci, ed, transfer_request,
+                                    segment -> ux_transfer_segment_data_pointer,
+                                    segment -> ux_transfer_segment_length);
+
+    /* Without segments, the TDs are built for the data buffer.  */
+    if (transfer_request -> ux_transfer_request_segment_count == 0)
+#endif
+        status =  _ux_hcd_ehci_request_bulk_tds_add(hcd_ehci, ed, transfer_request,
+                                    transfer_request -> ux_transfer_request_data_pointer,
+                                    transfer_request -> ux_transfer_request_requested_length);
+    if (status != UX_SUCCESS)
+        return(status);
 
     /* Set the IOC bit in the last TD.  */
     ed -> ux_ehci_ed_last_td -> ux_ehci_td_control |=  UX_EHCI_TD_IOC;
@@ -167,4 +157,3 @@ ULONG           zlp_flag;
     /* Return successful completion.  */
     return(UX_SUCCESS);           
 }
-
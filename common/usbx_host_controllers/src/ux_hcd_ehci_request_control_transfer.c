@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_request_control_transfer               PORTABLE C      */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -86,6 +86,9 @@
 /*                                            refined macros names,       */
 /*                                            fixed compile warnings,     */
 /*                                            resulting in version 6.1.2  */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used TD and ED free lists,  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_request_control_transfer(UX_HCD_EHCI *hcd_ehci, UX_TRANSFER *transfer_request)
@@ -154,7 +157,7 @@ UINT            pid;
     {
 
         /* We need to clean the tds attached if any.  */
-        _ux_hcd_ehci_ed_clean(ed);
+        _ux_hcd_ehci_ed_clean(hcd_ehci, ed);
         return(status);
     }
 
@@ -177,7 +180,7 @@ UINT            pid;
         {
 
             /* We need to clean the tds attached if any.  */
-            _ux_hcd_ehci_ed_clean(ed);
+            _ux_hcd_ehci_ed_clean(hcd_ehci, ed);
             return(status);
         }
     }        
@@ -195,7 +198,7 @@ UINT            pid;
     {
 
         /* We need to clean the tds attached if any.  */
-        _ux_hcd_ehci_ed_clean(ed);
+        _ux_hcd_ehci_ed_clean(hcd_ehci, ed);
         return(status);
     }
 
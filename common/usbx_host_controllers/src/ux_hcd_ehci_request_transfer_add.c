@@ -35,7 +35,7 @@
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _ux_hcd_ehci_request_transfer_add                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.x          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Chaoqiong Xiao, Microsoft Corporation                               */
@@ -76,16 +76,22 @@
 /*  05-19-2020     Chaoqiong Xiao           Initial Version 6.0           */
 /*  09-30-2020     Chaoqiong Xiao           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            marked ED pending,          */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ehci_request_transfer_add(UX_HCD_EHCI *hcd_ehci, UX_EHCI_ED *ed, ULONG phase, ULONG pid,
                                     ULONG toggle, UCHAR * buffer_address, ULONG buffer_length, UX_TRANSFER *transfer_request)
 {
 
+UX_INTERRUPT_SAVE_AREA
+
 UX_EHCI_TD              *last_td;
 UX_EHCI_TD              *td;
 UX_EHCI_LINK_POINTER    lp;
 UX_EHCI_POINTER         bp;
+ULONG                   ed_index;
     
 
     /* Obtain a TD for this transaction.  */
@@ -141,6 +147,13 @@ UX_EHCI_POINTER         bp;
         lp.void_ptr = _ux_utility_physical_address(td);
         lp.value |= UX_EHCI_TD_T;
         ed -> ux_ehci_ed_queue_element = lp.td_ptr;
+
+        /* The ED now has pending transfers, let the done queue process look
+           at it.  */
+        ed_index =  (ULONG) (ed - hcd_ehci -> ux_hcd_ehci_ed_list);
+        UX_DISABLE
+        hcd_ehci -> ux_hcd_ehci_ed_pending[ed_index >> 5] |=  1u << (ed_index & 31u);
+        UX_RESTORE
     }
     else
     {
@@ -88,6 +88,9 @@
 /*  07-29-2022     Yajun Xia                Modified comment(s),          */
 /*                                            fixed OHCI PRSC issue,      */
 /*                                            resulting in version 6.1.12 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            set HCD capabilities,       */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 UINT  _ux_hcd_ohci_initialize(UX_HCD *hcd)
@@ -108,6 +111,10 @@ UINT            status;
     hcd -> ux_hcd_available_bandwidth =  UX_OHCI_AVAILABLE_BANDWIDTH;
 #endif
 
+    /* OHCI appends each request behind the tail TD of the ED, several
+       requests can be outstanding on an endpoint.  */
+    hcd -> ux_hcd_capabilities |=  UX_HCD_CAPABILITY_CONCURRENT_TRANSFERS;
+
     /* Allocate memory for this OHCI HCD instance.  */
     hcd_ohci =  _ux_utility_memory_allocate(UX_NO_ALIGN, UX_REGULAR_MEMORY, sizeof(UX_HCD_OHCI));
     if (hcd_ohci == UX_NULL)
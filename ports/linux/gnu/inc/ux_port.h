@@ -26,7 +26,7 @@
 /*  PORT SPECIFIC C INFORMATION                            RELEASE        */ 
 /*                                                                        */ 
 /*    ux_port.h                                           Linux/GNU       */ 
-/*                                                           6.1.10       */
+/*                                                           6.x          */
 /*                                                                        */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -46,6 +46,12 @@
 /*                                            moved tx_api.h include and  */
 /*                                            typedefs from ux_api.h,     */
 /*                                            resulting in version 6.1.10 */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Modified comment(s),          */
+/*                                            used C library for memory   */
+/*                                            utilities,                  */
+/*                                            added trace buffer          */
+/*                                            timestamp,                  */
+/*                                            resulting in version 6.x    */
 /*                                                                        */
 /**************************************************************************/
 
@@ -77,6 +83,22 @@
 #include <string.h>
 
 
+/* Define memory utilities by the C library ones, which are optimized for the running CPU
+   (e.g., SSE2/AVX2 on x86). Copy is done by memmove, a safe superset of the USBX
+   forward byte copy: it gives the same result for any block the USBX copy handles, and
+   also handles overlapping blocks.  */
+
+#ifndef UX_UTILITY_MEMORY_COPY
+#define UX_UTILITY_MEMORY_COPY(d,s,l)                       memmove((d), (s), (l))
+#endif
+#ifndef UX_UTILITY_MEMORY_SET
+#define UX_UTILITY_MEMORY_SET(d,v,l)                        memset((d), (v), (l))
+#endif
+#ifndef UX_UTILITY_MEMORY_COMPARE
+#define UX_UTILITY_MEMORY_COMPARE(s,d,l)                    memcmp((s), (d), (l))
+#endif
+
+
 #if !defined(UX_STANDALONE)
 #include "tx_api.h"
 #else
@@ -240,6 +262,22 @@ ULONG   outpl(ULONG,ULONG);
 #define UX_RESTORE_INTS         tx_interrupt_control(old_interrupt_posture);
 
 
+/* Define the USBX trace buffer timestamp source by the monotonic clock, in nanoseconds.  */
+
+#if defined(UX_ENABLE_TRACE_BUFFER) && !defined(UX_TRACE_BUFFER_TIMESTAMP_GET)
+#include <time.h>
+static inline ULONG64 _ux_port_trace_buffer_timestamp_get(VOID)
+{
+struct timespec     now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((ULONG64) now.tv_sec * 1000000000u + (ULONG64) now.tv_nsec);
+}
+#define UX_TRACE_BUFFER_TIMESTAMP_GET()                     _ux_port_trace_buffer_timestamp_get()
+#define UX_TRACE_BUFFER_TIMESTAMP_FREQUENCY                 1000000000u
+#endif
+
+
 /* Define the version ID of USBX.  This may be utilized by the application.  */
 
 #ifdef  UX_SYSTEM_INIT
@@ -0,0 +1,238 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** USBX Component                                                        */
+/**                                                                       */
+/**   Trace Buffer Decoder                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    ux_trace_buffer_decode                              PORTABLE C      */
+/*                                                           6.x          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Chaoqiong Xiao, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This host program decodes a dump produced by ux_trace_buffer_dump   */
+/*    (UX_ENABLE_TRACE_BUFFER). Events of all cores are merged in         */
+/*    timestamp order and printed one per line, with the time relative   */
+/*    to the first event. Sequence gaps, i.e. events overwritten before   */
+/*    the dump, are reported per core.                                    */
+/*                                                                        */
+/*    Build with any hosted C compiler:                                   */
+/*      cc -O2 -o ux_trace_buffer_decode ux_trace_buffer_decode.c         */
+/*                                                                        */
+/*    Usage:                                                              */
+/*      ux_trace_buffer_decode <dump file>                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  xx-xx-xxxx     Chaoqiong Xiao           Initial Version 6.x           */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* Define the dump format, see ux_api.h and ux_trace_buffer_dump.c.  */
+
+#define TRACE_DUMP_MAGIC                0x42545855u
+#define TRACE_DUMP_VERSION              1
+#define TRACE_DUMP_HEADER_LENGTH        24
+#define TRACE_DUMP_RECORD_BASE_LENGTH   20
+
+
+/* Define the event groups, see UX_TRACE_*_EVENTS_BASE in ux_api.h.  */
+
+typedef struct TRACE_EVENT_GROUP_STRUCT
+{
+    uint32_t        base;
+    const char      *name;
+} TRACE_EVENT_GROUP;
+
+static const TRACE_EVENT_GROUP trace_event_groups[] =
+{
+    { 1000, "USER"          },
+    { 999,  "ERROR"         },
+    { 900,  "DEVICE_CLASS"  },
+    { 850,  "DEVICE_STACK"  },
+    { 650,  "HOST_CLASS"    },
+    { 600,  "HOST_STACK"    },
+    { 0,    "OTHER"         }
+};
+
+typedef struct TRACE_RECORD_STRUCT
+{
+    uint32_t        sequence;
+    uint32_t        event_id;
+    uint64_t        timestamp;
+    uint32_t        core;
+    uint64_t        info[4];
+} TRACE_RECORD;
+
+
+static uint64_t trace_get(const unsigned char *p, unsigned length)
+{
+uint64_t    value = 0;
+
+    while (length--)
+        value = (value << 8) | p[length];
+    return value;
+}
+
+static int trace_record_compare(const void *a, const void *b)
+{
+const TRACE_RECORD  *ra = a;
+const TRACE_RECORD  *rb = b;
+
+    if (ra -> timestamp != rb -> timestamp)
+        return (ra -> timestamp < rb -> timestamp) ? -1 : 1;
+    if (ra -> core != rb -> core)
+        return (ra -> core < rb -> core) ? -1 : 1;
+    return (ra -> sequence < rb -> sequence) ? -1 : (ra -> sequence > rb -> sequence);
+}
+
+static void trace_event_print(uint32_t event_id)
+{
+unsigned    i;
+
+    for (i = 0; event_id < trace_event_groups[i].base; i++);
+    if (event_id >= 999 || trace_event_groups[i].base == 0)
+        printf("%-13s %4u", trace_event_groups[i].name, event_id);
+    else
+        printf("%-13s +%3u", trace_event_groups[i].name, event_id - trace_event_groups[i].base);
+}
+
+int main(int argc, char **argv)
+{
+FILE            *file;
+unsigned char   *dump;
+long            dump_length;
+TRACE_RECORD    *records;
+uint32_t        *next_sequence;
+uint32_t        record_count;
+uint32_t        record_length;
+uint32_t        cores;
+uint32_t        i, j;
+unsigned        info_size;
+uint64_t        frequency;
+uint64_t        start;
+double          time;
+const unsigned char *p;
+
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <dump file>\n", argv[0]);
+        return 2;
+    }
+
+    /* Load the dump.  */
+    file = fopen(argv[1], "rb");
+    if (file == NULL || fseek(file, 0, SEEK_END) != 0 || (dump_length = ftell(file)) < 0)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    rewind(file);
+    dump = malloc((size_t) dump_length + 1);
+    if (dump == NULL || fread(dump, 1, (size_t) dump_length, file) != (size_t) dump_length)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    fclose(file);
+
+    /* Check the header.  */
+    if (dump_length < TRACE_DUMP_HEADER_LENGTH ||
+        trace_get(dump, 4) != TRACE_DUMP_MAGIC ||
+        trace_get(dump + 4, 2) != TRACE_DUMP_VERSION)
+    {
+        fprintf(stderr, "%s: not a USBX trace buffer dump\n", argv[1]);
+        return 1;
+    }
+    info_size = dump[6];
+    cores = dump[7];
+    frequency = trace_get(dump + 12, 8);
+    record_count = (uint32_t) trace_get(dump + 20, 4);
+    record_length = TRACE_DUMP_RECORD_BASE_LENGTH + 4 * info_size;
+    if ((info_size != 4 && info_size != 8) || cores == 0 || frequency == 0 ||
+        (uint64_t) dump_length < TRACE_DUMP_HEADER_LENGTH + (uint64_t) record_count * record_length)
+    {
+        fprintf(stderr, "%s: corrupted dump\n", argv[1]);
+        return 1;
+    }
+    printf("# %u records, %u core(s), %u entries per core, timestamp %llu Hz\n",
+           record_count, cores, (uint32_t) trace_get(dump + 8, 4), (unsigned long long) frequency);
+
+    /* Decode the records.  */
+    records = calloc(record_count + 1, sizeof(TRACE_RECORD));
+    next_sequence = calloc(cores, sizeof(uint32_t));
+    if (records == NULL || next_sequence == NULL)
+    {
+        perror("calloc");
+        return 1;
+    }
+    p = dump + TRACE_DUMP_HEADER_LENGTH;
+    for (i = 0; i < record_count; i++, p += record_length)
+    {
+        records[i].sequence = (uint32_t) trace_get(p, 4);
+        records[i].event_id = (uint32_t) trace_get(p + 4, 4);
+        records[i].timestamp = trace_get(p + 8, 8);
+        records[i].core = (uint32_t) trace_get(p + 16, 4);
+        for (j = 0; j < 4; j++)
+            records[i].info[j] = trace_get(p + TRACE_DUMP_RECORD_BASE_LENGTH + j * info_size, info_size);
+
+        /* Records of a core are dumped in sequence order, report the gaps.  */
+        if (records[i].core < cores)
+        {
+            if (next_sequence[records[i].core] != 0 && records[i].sequence != next_sequence[records[i].core])
+                printf("# core %u: %u event(s) lost before sequence %u\n", records[i].core,
+                       records[i].sequence - next_sequence[records[i].core], records[i].sequence);
+            next_sequence[records[i].core] = records[i].sequence + 1;
+        }
+    }
+
+    /* Merge the cores in time order and print.  */
+    qsort(records, record_count, sizeof(TRACE_RECORD), trace_record_compare);
+    start = record_count ? records[0].timestamp : 0;
+    for (i = 0; i < record_count; i++)
+    {
+        time = (double) (records[i].timestamp - start) / (double) frequency;
+        printf("%14.9f  %2u %10u  ", time, records[i].core, records[i].sequence);
+        trace_event_print(records[i].event_id);
+        for (j = 0; j < 4; j++)
+            printf("  %0*llx", (int) (info_size * 2), (unsigned long long) records[i].info[j]);
+        printf("\n");
+    }
+
+    free(next_sequence);
+    free(records);
+    free(dump);
+    return 0;
+}